@@ -3,20 +3,89 @@
 #include <time.h>
 #include <math.h>
 #include <string.h>
-
-/* ---------------- Utility --- ------------- */
+#include <stdint.h>
+
+#include "../cnn_arch.h"
+#include "../ship_weights.h"
+#include "../cnn_roofline.h"
+
+/*
+ * CPU reference benchmark for the ship detector
+ * Runs exactly the cnn_arch.h network that cnn_network() implements
+ * (no padding, 32 CONV3 channels, 8x4 flatten, 4 outputs) with the
+ * embedded SHIP_DETECTOR_WEIGHTS and test image, in two precisions:
+ *   FP32 - same weights and pixels as floats with the same ReLU clamp
+ *          (0..127) and FC2 saturation (-128..127), but no rounding
+ *   int8 - native int8/int32 C with the HLS semantics (ReLU clamp to 127,
+ *          truncating average pool, saturating FC2); bit-exact with
+ *          cnn_network(), checked against its scores (exit status 1 if not)
+ * Biases are zero, as in the HLS testbenches.
+ *
+ * Each precision also gets a roofline report (ops/byte against achieved
+ * GOPS), and both are written to roofline.csv. The FP32 table is judged
+ * against an FP32 multiply-add peak and the int8 table against an int8 MAC
+ * peak, both under a DRAM bandwidth roof. The peaks are measured on the
+ * machine running the benchmark unless others are given: "pynq" for the
+ * nominal Pynq-Z2 A9 numbers, or "gops,gbps[,int8_gops]".
+ *
+ * Build: gcc -O2 Benchmark.c -o Benchmark -lm
+ * Usage: ./Benchmark [runs] [host | pynq | peak_gops,peak_gbps[,int8_gops]]
+ */
+
+/* ---------------- Geometry ---------------- */
+
+#define H1 (MAX_H - CONV1_K + 1)              /* 126 */
+#define W1 (MAX_W - CONV1_K + 1)
+#define H2 (H1 / POOL1_SIZE)                  /* 63 */
+#define W2 (W1 / POOL1_SIZE)
+#define H3 (H2 - CONV2_K + 1)                 /* 61 */
+#define W3 (W2 - CONV2_K + 1)
+#define H4 (H3 / POOL2_SIZE)                  /* 30 */
+#define W4 (W3 / POOL2_SIZE)
+#define H5 ((H4 - CONV3_K) / CONV3_STRIDE + 1) /* 14 */
+#define W5 ((W4 - CONV3_K) / CONV3_STRIDE + 1)
+#define H6 (H5 / POOL3_SIZE)                  /* 7 */
+#define W6 (W5 / POOL3_SIZE)
+
+/* cnn_network() flattens an 8x4 window of each POOL3 channel; row 7 lies
+ * outside the 7x7 map and reads as zero. */
+#define FLAT_H 8
+#define FLAT_W 4
+
+#define NUM_LAYERS 8
+
+/* ---------------- Utility ---------------- */
 
 static inline float relu(float x) {
+    if (x > 127.0f) return 127.0f;
     return x > 0.0f ? x : 0.0f;
 }
 
+static inline float sat(float x) {
+    if (x > 127.0f) return 127.0f;
+    if (x < -128.0f) return -128.0f;
+    return x;
+}
+
+static inline int8_t relu_i8(int32_t x) {
+    if (x > 127) return 127;
+    if (x < 0) return 0;
+    return (int8_t)x;
+}
+
+static inline int8_t sat_i8(int32_t x) {
+    if (x > 127) return 127;
+    if (x < -128) return -128;
+    return (int8_t)x;
+}
+
 static inline double now_ms() {
     struct timespec t;
     clock_gettime(CLOCK_MONOTONIC, &t);
     return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
 }
 
-/* ---------------- Layers ---------------- */
+/* ---------------- FP32 layers ---------------- */
 
 void conv2d(
     float *in, float *out,
@@ -53,41 +122,127 @@ void conv2d(
 }
 
 void avgpool(float *in, float *out, int C, int H, int W) {
-    int H2 = H / 2, W2 = W / 2;
+    int H2_ = H / 2, W2_ = W / 2;
 
     for (int c = 0; c < C; c++)
-        for (int h = 0; h < H2; h++)
-            for (int w = 0; w < W2; w++) {
+        for (int h = 0; h < H2_; h++)
+            for (int w = 0; w < W2_; w++) {
                 float s = 0.0f;
                 for (int i = 0; i < 2; i++)
                     for (int j = 0; j < 2; j++)
                         s += in[c*H*W + (2*h+i)*W + (2*w+j)];
-                out[c*H2*W2 + h*W2 + w] = 0.25f * s;
+                out[c*H2_*W2_ + h*W2_ + w] = 0.25f * s;
             }
 }
 
 void maxpool(float *in, float *out, int C, int H, int W) {
-    int H2 = H / 2, W2 = W / 2;
+    int H2_ = H / 2, W2_ = W / 2;
 
     for (int c = 0; c < C; c++)
-        for (int h = 0; h < H2; h++)
-            for (int w = 0; w < W2; w++) {
-                float m = -1e9f;
+        for (int h = 0; h < H2_; h++)
+            for (int w = 0; w < W2_; w++) {
+                float m = -1e30f;
                 for (int i = 0; i < 2; i++)
                     for (int j = 0; j < 2; j++) {
                         float v = in[c*H*W + (2*h+i)*W + (2*w+j)];
                         if (v > m) m = v;
                     }
-                out[c*H2*W2 + h*W2 + w] = m;
+                out[c*H2_*W2_ + h*W2_ + w] = m;
             }
 }
 
-void fc(float *in, float *out, float *w, float *b, int N, int M) {
+/* C x H x W map -> FLAT_H x FLAT_W window per channel, zero outside */
+void flatten(float *in, float *out, int C, int H, int W) {
+    int idx = 0;
+    for (int c = 0; c < C; c++)
+        for (int h = 0; h < FLAT_H; h++)
+            for (int w = 0; w < FLAT_W; w++)
+                out[idx++] = (h < H && w < W) ? in[c*H*W + h*W + w] : 0.0f;
+}
+
+void fc(float *in, float *out, float *w, float *b, int N, int M, int apply_relu) {
     for (int o = 0; o < M; o++) {
         float s = b[o];
         for (int i = 0; i < N; i++)
             s += in[i] * w[o*N + i];
-        out[o] = relu(s);
+        out[o] = apply_relu ? relu(s) : sat(s);
+    }
+}
+
+/* ---------------- int8 layers (HLS semantics) ---------------- */
+
+void conv2d_i8(
+    const int8_t *in, int8_t *out, const int8_t *w,
+    int Cin, int Hin, int Win,
+    int Cout, int K, int stride
+) {
+    int Hout = (Hin - K) / stride + 1;
+    int Wout = (Win - K) / stride + 1;
+
+    for (int co = 0; co < Cout; co++) {
+        for (int h = 0; h < Hout; h++) {
+            for (int wo = 0; wo < Wout; wo++) {
+                int32_t sum = 0;
+
+                for (int ci = 0; ci < Cin; ci++) {
+                    for (int kh = 0; kh < K; kh++) {
+                        const int8_t *row = &in[ci*Hin*Win + (h*stride + kh)*Win + wo*stride];
+                        const int8_t *wk = &w[co*Cin*K*K + ci*K*K + kh*K];
+                        for (int kw = 0; kw < K; kw++)
+                            sum += row[kw] * wk[kw];
+                    }
+                }
+                out[co*Hout*Wout + h*Wout + wo] = relu_i8(sum);
+            }
+        }
+    }
+}
+
+void avgpool_i8(const int8_t *in, int8_t *out, int C, int H, int W) {
+    int H2_ = H / 2, W2_ = W / 2;
+
+    for (int c = 0; c < C; c++)
+        for (int h = 0; h < H2_; h++)
+            for (int w = 0; w < W2_; w++) {
+                int32_t s = 0;
+                for (int i = 0; i < 2; i++)
+                    for (int j = 0; j < 2; j++)
+                        s += in[c*H*W + (2*h+i)*W + (2*w+j)];
+                out[c*H2_*W2_ + h*W2_ + w] = (int8_t)(s / 4);
+            }
+}
+
+void maxpool_i8(const int8_t *in, int8_t *out, int C, int H, int W) {
+    int H2_ = H / 2, W2_ = W / 2;
+
+    for (int c = 0; c < C; c++)
+        for (int h = 0; h < H2_; h++)
+            for (int w = 0; w < W2_; w++) {
+                int8_t m = -128;
+                for (int i = 0; i < 2; i++)
+                    for (int j = 0; j < 2; j++) {
+                        int8_t v = in[c*H*W + (2*h+i)*W + (2*w+j)];
+                        if (v > m) m = v;
+                    }
+                out[c*H2_*W2_ + h*W2_ + w] = m;
+            }
+}
+
+void flatten_i8(const int8_t *in, int8_t *out, int C, int H, int W) {
+    int idx = 0;
+    for (int c = 0; c < C; c++)
+        for (int h = 0; h < FLAT_H; h++)
+            for (int w = 0; w < FLAT_W; w++)
+                out[idx++] = (h < H && w < W) ? in[c*H*W + h*W + w] : 0;
+}
+
+void fc_i8(const int8_t *in, int8_t *out, const int8_t *w, const int32_t *b,
+           int N, int M, int apply_relu) {
+    for (int o = 0; o < M; o++) {
+        int32_t s = b[o];
+        for (int i = 0; i < N; i++)
+            s += in[i] * w[o*N + i];
+        out[o] = apply_relu ? relu_i8(s) : sat_i8(s);
     }
 }
 
@@ -108,254 +263,337 @@ long long calculate_fc_ops(int N, int M) {
 }
 
 long long calculate_pool_ops(int C, int H, int W) {
-    int H2 = H / 2, W2 = W / 2;
+    int H2_ = H / 2, W2_ = W / 2;
     // For avgpool: 4 adds + 1 multiply per output
     // For maxpool: 3 comparisons per output
-    return (long long)C * H2 * W2 * 4; // Conservative estimate
+    return (long long)C * H2_ * W2_ * 4; // Conservative estimate
+}
+
+/* Bytes a layer must move at least once: weights, input, output */
+void calculate_conv2d_bytes(roofline_layer_t *l, int Cin, int Hin, int Win,
+                            int Cout, int K, int stride, int pad, int elem) {
+    int Hout = (Hin + 2*pad - K) / stride + 1;
+    int Wout = (Win + 2*pad - K) / stride + 1;
+    l->weight_bytes = (long long)Cout * Cin * K * K * elem;
+    l->in_bytes = (long long)Cin * Hin * Win * elem;
+    l->out_bytes = (long long)Cout * Hout * Wout * elem;
+}
+
+void calculate_pool_bytes(roofline_layer_t *l, int C, int H, int W, int elem) {
+    l->weight_bytes = 0;
+    l->in_bytes = (long long)C * H * W * elem;
+    l->out_bytes = (long long)C * (H / 2) * (W / 2) * elem;
+}
+
+void calculate_fc_bytes(roofline_layer_t *l, int N, int M, int elem) {
+    l->weight_bytes = (long long)M * N * elem;
+    l->in_bytes = (long long)N * elem;
+    l->out_bytes = (long long)M * elem;
+}
+
+static size_t weight_count() {
+    return (size_t)CONV1_OUT_CH*CONV1_IN_CH*CONV1_K*CONV1_K
+         + (size_t)CONV2_OUT_CH*CONV2_IN_CH*CONV2_K*CONV2_K
+         + (size_t)CONV3_OUT_CH*CONV3_IN_CH*CONV3_K*CONV3_K
+         + (size_t)FC1_OUT*FC1_IN + (size_t)FC2_OUT*FC2_IN;
+}
+
+static size_t buffer_count() {
+    return (size_t)CONV1_OUT_CH*H1*W1 + (size_t)CONV1_OUT_CH*H2*W2
+         + (size_t)CONV2_OUT_CH*H3*W3 + (size_t)CONV2_OUT_CH*H4*W4
+         + (size_t)CONV3_OUT_CH*H5*W5 + (size_t)CONV3_OUT_CH*H6*W6
+         + FC1_IN + FC1_OUT + FC2_OUT;
 }
 
 void print_memory_usage() {
+    size_t input = (size_t)CONV1_IN_CH * MAX_H * MAX_W;
+    size_t weights = weight_count();
+    size_t buffers = buffer_count();
+
     printf("\n=== MEMORY USAGE ===\n");
-    printf("Input:           %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 3*128*128, 
-           sizeof(float) * 3*128*128 / 1024.0);
-    
-    printf("\nWeights:\n");
-    printf("  conv1_w:       %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 16*3*3*3, 
-           sizeof(float) * 16*3*3*3 / 1024.0);
-    printf("  conv1_b:       %zu bytes\n", sizeof(float) * 16);
-    printf("  conv2_w:       %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 32*16*3*3, 
-           sizeof(float) * 32*16*3*3 / 1024.0);
-    printf("  conv2_b:       %zu bytes\n", sizeof(float) * 32);
-    printf("  conv3_w:       %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 64*32*3*3, 
-           sizeof(float) * 64*32*3*3 / 1024.0);
-    printf("  conv3_b:       %zu bytes\n", sizeof(float) * 64);
-    printf("  fc1_w:         %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 256*1024, 
-           sizeof(float) * 256*1024 / 1024.0);
-    printf("  fc1_b:         %zu bytes\n", sizeof(float) * 256);
-    printf("  fc2_w:         %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 20*256, 
-           sizeof(float) * 20*256 / 1024.0);
-    printf("  fc2_b:         %zu bytes\n", sizeof(float) * 20);
-    
-    size_t total_weights = sizeof(float) * (16*3*3*3 + 16 + 32*16*3*3 + 32 + 
-                                             64*32*3*3 + 64 + 256*1024 + 256 + 20*256 + 20);
-    printf("  Total weights: %zu bytes (%.2f KB)\n", total_weights, total_weights / 1024.0);
-    
-    printf("\nIntermediate Buffers:\n");
-    printf("  buf1:          %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 16*128*128, 
-           sizeof(float) * 16*128*128 / 1024.0);
-    printf("  buf2:          %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 16*64*64, 
-           sizeof(float) * 16*64*64 / 1024.0);
-    printf("  buf3:          %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 32*32*32, 
-           sizeof(float) * 32*32*32 / 1024.0);
-    printf("  buf4:          %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 32*16*16, 
-           sizeof(float) * 32*16*16 / 1024.0);
-    printf("  buf5:          %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 64*8*8, 
-           sizeof(float) * 64*8*8 / 1024.0);
-    printf("  buf6:          %zu bytes (%.2f KB)\n", 
-           sizeof(float) * 64*4*4, 
-           sizeof(float) * 64*4*4 / 1024.0);
-    printf("  fc1_out:       %zu bytes\n", sizeof(float) * 256);
-    printf("  output:        %zu bytes\n", sizeof(float) * 20);
-    
-    size_t total_buffers = sizeof(float) * (16*128*128 + 16*64*64 + 32*32*32 + 
-                                             32*16*16 + 64*8*8 + 64*4*4 + 256 + 20);
-    printf("  Total buffers: %zu bytes (%.2f KB)\n", total_buffers, total_buffers / 1024.0);
-    
-    size_t total_memory = sizeof(float) * 3*128*128 + total_weights + total_buffers;
-    printf("\nTOTAL MEMORY:    %zu bytes (%.2f MB)\n", 
-           total_memory, 
-           total_memory / (1024.0 * 1024.0));
+    printf("%-16s %12s %12s\n", "", "FP32", "int8");
+    printf("%-16s %9.2f KB %9.2f KB\n", "Input:", input * 4 / 1024.0, input / 1024.0);
+    printf("%-16s %9.2f KB %9.2f KB\n", "Weights:", weights * 4 / 1024.0, weights / 1024.0);
+    printf("%-16s %9.2f KB %9.2f KB\n", "Buffers:", buffers * 4 / 1024.0, buffers / 1024.0);
+    printf("%-16s %9.2f KB %9.2f KB\n", "TOTAL:",
+           (input + weights + buffers) * 4 / 1024.0, (input + weights + buffers) / 1024.0);
+}
+
+/* ---------------- Model ---------------- */
+
+/* int8 weights straight from the blob, FP32 copies of the same values */
+static const int8_t *conv1_q, *conv2_q, *conv3_q, *fc1_q, *fc2_q;
+static float conv1_w[CONV1_OUT_CH*CONV1_IN_CH*CONV1_K*CONV1_K], conv1_b[CONV1_OUT_CH];
+static float conv2_w[CONV2_OUT_CH*CONV2_IN_CH*CONV2_K*CONV2_K], conv2_b[CONV2_OUT_CH];
+static float conv3_w[CONV3_OUT_CH*CONV3_IN_CH*CONV3_K*CONV3_K], conv3_b[CONV3_OUT_CH];
+static float fc1_w[FC1_OUT*FC1_IN], fc1_b[FC1_OUT];
+static float fc2_w[FC2_OUT*FC2_IN], fc2_b[FC2_OUT];
+static int32_t fc1_bq[FC1_OUT], fc2_bq[FC2_OUT];
+
+static float input_f[CONV1_IN_CH*MAX_H*MAX_W];
+static int8_t input_q[CONV1_IN_CH*MAX_H*MAX_W];
+
+/* cnn_network() scores on the embedded image (testbench_embedded output);
+ * update together with ship_weights.h */
+static const int8_t cnn_network_scores[FC2_OUT] = { -128, 127, 127, -128 };
+
+static void load_model() {
+    const int8_t *p = SHIP_DETECTOR_WEIGHTS;
+    conv1_q = p; p += sizeof(conv1_w) / sizeof(float);
+    conv2_q = p; p += sizeof(conv2_w) / sizeof(float);
+    conv3_q = p; p += sizeof(conv3_w) / sizeof(float);
+    fc1_q = p;   p += sizeof(fc1_w) / sizeof(float);
+    fc2_q = p;
+
+    for (size_t i = 0; i < sizeof(conv1_w) / sizeof(float); i++) conv1_w[i] = conv1_q[i];
+    for (size_t i = 0; i < sizeof(conv2_w) / sizeof(float); i++) conv2_w[i] = conv2_q[i];
+    for (size_t i = 0; i < sizeof(conv3_w) / sizeof(float); i++) conv3_w[i] = conv3_q[i];
+    for (size_t i = 0; i < sizeof(fc1_w) / sizeof(float); i++) fc1_w[i] = fc1_q[i];
+    for (size_t i = 0; i < sizeof(fc2_w) / sizeof(float); i++) fc2_w[i] = fc2_q[i];
+    memset(conv1_b, 0, sizeof(conv1_b));
+    memset(conv2_b, 0, sizeof(conv2_b));
+    memset(conv3_b, 0, sizeof(conv3_b));
+    memset(fc1_b, 0, sizeof(fc1_b));
+    memset(fc2_b, 0, sizeof(fc2_b));
+    memset(fc1_bq, 0, sizeof(fc1_bq));
+    memset(fc2_bq, 0, sizeof(fc2_bq));
+
+    /* HWC uint8 -> CHW, centred to -128..127 (as load_embedded_input) */
+    for (int h = 0; h < MAX_H; h++)
+        for (int w = 0; w < MAX_W; w++)
+            for (int c = 0; c < CONV1_IN_CH; c++) {
+                int v = SHIP_DETECTOR_INPUT[(h*MAX_W + w)*CONV1_IN_CH + c] - 128;
+                input_q[c*MAX_H*MAX_W + h*MAX_W + w] = (int8_t)v;
+                input_f[c*MAX_H*MAX_W + h*MAX_W + w] = (float)v;
+            }
+}
+
+/* ---------------- Inference ---------------- */
+
+static void run_fp32(float *output, double *layer_times) {
+    static float buf1[CONV1_OUT_CH*H1*W1];
+    static float buf2[CONV1_OUT_CH*H2*W2];
+    static float buf3[CONV2_OUT_CH*H3*W3];
+    static float buf4[CONV2_OUT_CH*H4*W4];
+    static float buf5[CONV3_OUT_CH*H5*W5];
+    static float buf6[CONV3_OUT_CH*H6*W6];
+    static float flat[FC1_IN];
+    static float fc1_out[FC1_OUT];
+    double t[NUM_LAYERS + 1];
+
+    t[0] = now_ms();
+    conv2d(input_f, buf1, conv1_w, conv1_b, CONV1_IN_CH, MAX_H, MAX_W, CONV1_OUT_CH, CONV1_K, 1, 0);
+    t[1] = now_ms();
+    avgpool(buf1, buf2, CONV1_OUT_CH, H1, W1);
+    t[2] = now_ms();
+    conv2d(buf2, buf3, conv2_w, conv2_b, CONV2_IN_CH, H2, W2, CONV2_OUT_CH, CONV2_K, 1, 0);
+    t[3] = now_ms();
+    avgpool(buf3, buf4, CONV2_OUT_CH, H3, W3);
+    t[4] = now_ms();
+    conv2d(buf4, buf5, conv3_w, conv3_b, CONV3_IN_CH, H4, W4, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE, 0);
+    t[5] = now_ms();
+    maxpool(buf5, buf6, CONV3_OUT_CH, H5, W5);
+    t[6] = now_ms();
+    flatten(buf6, flat, CONV3_OUT_CH, H6, W6);
+    fc(flat, fc1_out, fc1_w, fc1_b, FC1_IN, FC1_OUT, 1);
+    t[7] = now_ms();
+    fc(fc1_out, output, fc2_w, fc2_b, FC2_IN, FC2_OUT, 0);
+    t[8] = now_ms();
+
+    for (int i = 0; i < NUM_LAYERS; i++)
+        layer_times[i] += t[i + 1] - t[i];
+}
+
+static void run_int8(int8_t *output, double *layer_times) {
+    static int8_t buf1[CONV1_OUT_CH*H1*W1];
+    static int8_t buf2[CONV1_OUT_CH*H2*W2];
+    static int8_t buf3[CONV2_OUT_CH*H3*W3];
+    static int8_t buf4[CONV2_OUT_CH*H4*W4];
+    static int8_t buf5[CONV3_OUT_CH*H5*W5];
+    static int8_t buf6[CONV3_OUT_CH*H6*W6];
+    static int8_t flat[FC1_IN];
+    static int8_t fc1_out[FC1_OUT];
+    double t[NUM_LAYERS + 1];
+
+    t[0] = now_ms();
+    conv2d_i8(input_q, buf1, conv1_q, CONV1_IN_CH, MAX_H, MAX_W, CONV1_OUT_CH, CONV1_K, 1);
+    t[1] = now_ms();
+    avgpool_i8(buf1, buf2, CONV1_OUT_CH, H1, W1);
+    t[2] = now_ms();
+    conv2d_i8(buf2, buf3, conv2_q, CONV2_IN_CH, H2, W2, CONV2_OUT_CH, CONV2_K, 1);
+    t[3] = now_ms();
+    avgpool_i8(buf3, buf4, CONV2_OUT_CH, H3, W3);
+    t[4] = now_ms();
+    conv2d_i8(buf4, buf5, conv3_q, CONV3_IN_CH, H4, W4, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE);
+    t[5] = now_ms();
+    maxpool_i8(buf5, buf6, CONV3_OUT_CH, H5, W5);
+    t[6] = now_ms();
+    flatten_i8(buf6, flat, CONV3_OUT_CH, H6, W6);
+    fc_i8(flat, fc1_out, fc1_q, fc1_bq, FC1_IN, FC1_OUT, 1);
+    t[7] = now_ms();
+    fc_i8(fc1_out, output, fc2_q, fc2_bq, FC2_IN, FC2_OUT, 0);
+    t[8] = now_ms();
+
+    for (int i = 0; i < NUM_LAYERS; i++)
+        layer_times[i] += t[i + 1] - t[i];
+}
+
+/* ---------------- Roofline ---------------- */
+
+/* Per-layer ops and traffic at `elem` bytes per value, with measured times */
+static void network_roofline(roofline_layer_t *l, const char *const *names,
+                             const long long *ops, const double *ms, int elem) {
+    calculate_conv2d_bytes(&l[0], CONV1_IN_CH, MAX_H, MAX_W, CONV1_OUT_CH, CONV1_K, 1, 0, elem);
+    calculate_pool_bytes(&l[1], CONV1_OUT_CH, H1, W1, elem);
+    calculate_conv2d_bytes(&l[2], CONV2_IN_CH, H2, W2, CONV2_OUT_CH, CONV2_K, 1, 0, elem);
+    calculate_pool_bytes(&l[3], CONV2_OUT_CH, H3, W3, elem);
+    calculate_conv2d_bytes(&l[4], CONV3_IN_CH, H4, W4, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE, 0, elem);
+    calculate_pool_bytes(&l[5], CONV3_OUT_CH, H5, W5, elem);
+    calculate_fc_bytes(&l[6], FC1_IN, FC1_OUT, elem);
+    calculate_fc_bytes(&l[7], FC2_IN, FC2_OUT, elem);
+    for (int i = 0; i < NUM_LAYERS; i++) {
+        l[i].name = names[i];
+        l[i].ops = ops[i];
+        l[i].ms = ms[i];
+    }
 }
 
 /* ---------------- Main ---------------- */
 
-int main() {
-    srand(42);
-
-    printf("=== NEURAL NETWORK BENCHMARK (ARM/Pynq-Z2) ===\n");
-    printf("Board: Pynq-Z2 (Zynq-7000 ARM Cortex-A9)\n");
-    printf("Precision: FP32 (single precision float)\n\n");
-
-    /* Input */
-    static float input[3*128*128];
-
-    /* Weights - FIX: Initialize bias arrays to zero */
-    static float conv1_w[16*3*3*3], conv1_b[16];
-    static float conv2_w[32*16*3*3], conv2_b[32];
-    static float conv3_w[64*32*3*3], conv3_b[64];
-    static float fc1_w[256*1024], fc1_b[256];
-    static float fc2_w[20*256], fc2_b[20];
-
-    /* Buffers */
-    static float buf1[16*128*128];
-    static float buf2[16*64*64];
-    static float buf3[32*32*32];
-    static float buf4[32*16*16];
-    static float buf5[64*8*8];
-    static float buf6[64*4*4];
-    static float fc1_out[256];
-    static float output[20];
-
-    /* Random init */
-    for (int i = 0; i < 3*128*128; i++)
-        input[i] = (float)rand() / RAND_MAX;
-
-    for (int i = 0; i < 16*3*3*3; i++) conv1_w[i] = ((float)rand()/RAND_MAX)-0.5f;
-    for (int i = 0; i < 16; i++) conv1_b[i] = 0.0f; // FIX: Initialize biases
-    
-    for (int i = 0; i < 32*16*3*3; i++) conv2_w[i] = ((float)rand()/RAND_MAX)-0.5f;
-    for (int i = 0; i < 32; i++) conv2_b[i] = 0.0f;
-    
-    for (int i = 0; i < 64*32*3*3; i++) conv3_w[i] = ((float)rand()/RAND_MAX)-0.5f;
-    for (int i = 0; i < 64; i++) conv3_b[i] = 0.0f;
-    
-    for (int i = 0; i < 256*1024; i++) fc1_w[i] = ((float)rand()/RAND_MAX)-0.5f;
-    for (int i = 0; i < 256; i++) fc1_b[i] = 0.0f;
-    
-    for (int i = 0; i < 20*256; i++) fc2_w[i] = ((float)rand()/RAND_MAX)-0.5f;
-    for (int i = 0; i < 20; i++) fc2_b[i] = 0.0f;
-
-    printf("=== NETWORK ARCHITECTURE ===\n");
-    printf("Layer 1: Conv2D (3x128x128 -> 16x128x128, K=3, S=1, P=1) + ReLU\n");
-    printf("Layer 2: AvgPool (16x128x128 -> 16x64x64, 2x2)\n");
-    printf("Layer 3: Conv2D (16x64x64 -> 32x32x32, K=3, S=2, P=1) + ReLU\n");
-    printf("Layer 4: AvgPool (32x32x32 -> 32x16x16, 2x2)\n");
-    printf("Layer 5: Conv2D (32x16x16 -> 64x8x8, K=3, S=2, P=1) + ReLU\n");
-    printf("Layer 6: MaxPool (64x8x8 -> 64x4x4, 2x2)\n");
-    printf("Layer 7: FC (1024 -> 256) + ReLU\n");
-    printf("Layer 8: FC (256 -> 20) + ReLU\n");
+int main(int argc, char **argv) {
+    int runs = (argc > 1) ? atoi(argv[1]) : 10;
+    const char *peaks_arg = (argc > 2) ? argv[2] : "host";
+    roofline_peaks_t peaks;
+    if (runs < 1) runs = 1;
+    if (!roofline_parse_peaks(peaks_arg, &peaks)) {
+        fprintf(stderr, "peaks: expected host, pynq or peak_gops,peak_gbps[,int8_gops] (got %s)\n", peaks_arg);
+        return 2;
+    }
+
+    printf("=== SHIP DETECTOR CPU REFERENCE BENCHMARK ===\n");
+    printf("Board: Pynq-Z2 (Zynq-7000 ARM Cortex-A9) or host CPU\n");
+    printf("Model: SHIP_DETECTOR_WEIGHTS (%zu weights), embedded test image\n", weight_count());
+    printf("Runs:  1 warmup + %d timed per precision\n\n", runs);
+
+    load_model();
+
+    printf("=== NETWORK ARCHITECTURE (cnn_arch.h) ===\n");
+    printf("Layer 1: Conv2D (%dx%dx%d -> %dx%dx%d, K=%d, S=1, P=0) + ReLU\n",
+           CONV1_IN_CH, MAX_H, MAX_W, CONV1_OUT_CH, H1, W1, CONV1_K);
+    printf("Layer 2: AvgPool (%dx%dx%d -> %dx%dx%d, 2x2)\n", CONV1_OUT_CH, H1, W1, CONV1_OUT_CH, H2, W2);
+    printf("Layer 3: Conv2D (%dx%dx%d -> %dx%dx%d, K=%d, S=1, P=0) + ReLU\n",
+           CONV2_IN_CH, H2, W2, CONV2_OUT_CH, H3, W3, CONV2_K);
+    printf("Layer 4: AvgPool (%dx%dx%d -> %dx%dx%d, 2x2)\n", CONV2_OUT_CH, H3, W3, CONV2_OUT_CH, H4, W4);
+    printf("Layer 5: Conv2D (%dx%dx%d -> %dx%dx%d, K=%d, S=%d, P=0) + ReLU\n",
+           CONV3_IN_CH, H4, W4, CONV3_OUT_CH, H5, W5, CONV3_K, CONV3_STRIDE);
+    printf("Layer 6: MaxPool (%dx%dx%d -> %dx%dx%d, 2x2)\n", CONV3_OUT_CH, H5, W5, CONV3_OUT_CH, H6, W6);
+    printf("Layer 7: Flatten (%dx%dx%d window) + FC (%d -> %d) + ReLU\n",
+           CONV3_OUT_CH, FLAT_H, FLAT_W, FC1_IN, FC1_OUT);
+    printf("Layer 8: FC (%d -> %d)\n", FC2_IN, FC2_OUT);
 
     // Calculate theoretical operations
+    long long layer_ops[NUM_LAYERS];
+    layer_ops[0] = calculate_conv2d_ops(CONV1_IN_CH, MAX_H, MAX_W, CONV1_OUT_CH, CONV1_K, 1, 0);
+    layer_ops[1] = calculate_pool_ops(CONV1_OUT_CH, H1, W1);
+    layer_ops[2] = calculate_conv2d_ops(CONV2_IN_CH, H2, W2, CONV2_OUT_CH, CONV2_K, 1, 0);
+    layer_ops[3] = calculate_pool_ops(CONV2_OUT_CH, H3, W3);
+    layer_ops[4] = calculate_conv2d_ops(CONV3_IN_CH, H4, W4, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE, 0);
+    layer_ops[5] = calculate_pool_ops(CONV3_OUT_CH, H5, W5);
+    layer_ops[6] = calculate_fc_ops(FC1_IN, FC1_OUT);
+    layer_ops[7] = calculate_fc_ops(FC2_IN, FC2_OUT);
+    static const char *names[NUM_LAYERS] = {
+        "Conv1", "AvgPool1", "Conv2", "AvgPool2", "Conv3", "MaxPool", "FC1", "FC2"
+    };
+
+    long long total_ops = 0;
     printf("\n=== THEORETICAL OPERATIONS ===\n");
-    long long conv1_ops = calculate_conv2d_ops(3, 128, 128, 16, 3, 1, 1);
-    long long pool1_ops = calculate_pool_ops(16, 128, 128);
-    long long conv2_ops = calculate_conv2d_ops(16, 64, 64, 32, 3, 2, 1);
-    long long pool2_ops = calculate_pool_ops(32, 32, 32);
-    long long conv3_ops = calculate_conv2d_ops(32, 16, 16, 64, 3, 2, 1);
-    long long pool3_ops = calculate_pool_ops(64, 8, 8);
-    long long fc1_ops = calculate_fc_ops(1024, 256);
-    long long fc2_ops = calculate_fc_ops(256, 20);
-    
-    printf("Conv1:    %15lld FLOPs\n", conv1_ops);
-    printf("AvgPool1: %15lld FLOPs\n", pool1_ops);
-    printf("Conv2:    %15lld FLOPs\n", conv2_ops);
-    printf("AvgPool2: %15lld FLOPs\n", pool2_ops);
-    printf("Conv3:    %15lld FLOPs\n", conv3_ops);
-    printf("MaxPool:  %15lld FLOPs\n", pool3_ops);
-    printf("FC1:      %15lld FLOPs\n", fc1_ops);
-    printf("FC2:      %15lld FLOPs\n", fc2_ops);
-    
-    long long total_ops = conv1_ops + pool1_ops + conv2_ops + pool2_ops + 
-                          conv3_ops + pool3_ops + fc1_ops + fc2_ops;
-    printf("TOTAL:    %15lld FLOPs (%.2f MFLOPs)\n", 
-           total_ops, total_ops / 1e6);
+    for (int i = 0; i < NUM_LAYERS; i++) {
+        printf("%-9s %15lld ops\n", names[i], layer_ops[i]);
+        total_ops += layer_ops[i];
+    }
+    printf("TOTAL:    %15lld ops (%.2f MOPs)\n", total_ops, total_ops / 1e6);
 
     print_memory_usage();
 
     printf("\n=== RUNNING INFERENCE ===\n");
-    
-    double t0, t1;
-    double layer_times[8];
-
-    // Layer 1: Conv2D
-    t0 = now_ms();
-    conv2d(input, buf1, conv1_w, conv1_b, 3, 128, 128, 16, 3, 1, 1);
-    t1 = now_ms();
-    layer_times[0] = t1 - t0;
-
-    // Layer 2: AvgPool
-    t0 = now_ms();
-    avgpool(buf1, buf2, 16, 128, 128);
-    t1 = now_ms();
-    layer_times[1] = t1 - t0;
-
-    // Layer 3: Conv2D
-    t0 = now_ms();
-    conv2d(buf2, buf3, conv2_w, conv2_b, 16, 64, 64, 32, 3, 2, 1);
-    t1 = now_ms();
-    layer_times[2] = t1 - t0;
-
-    // Layer 4: AvgPool
-    t0 = now_ms();
-    avgpool(buf3, buf4, 32, 32, 32);
-    t1 = now_ms();
-    layer_times[3] = t1 - t0;
-
-    // Layer 5: Conv2D
-    t0 = now_ms();
-    conv2d(buf4, buf5, conv3_w, conv3_b, 32, 16, 16, 64, 3, 2, 1);
-    t1 = now_ms();
-    layer_times[4] = t1 - t0;
-
-    // Layer 6: MaxPool
-    t0 = now_ms();
-    maxpool(buf5, buf6, 64, 8, 8);
-    t1 = now_ms();
-    layer_times[5] = t1 - t0;
-
-    // Layer 7: FC
-    t0 = now_ms();
-    fc(buf6, fc1_out, fc1_w, fc1_b, 1024, 256);
-    t1 = now_ms();
-    layer_times[6] = t1 - t0;
-
-    // Layer 8: FC
-    t0 = now_ms();
-    fc(fc1_out, output, fc2_w, fc2_b, 256, 20);
-    t1 = now_ms();
-    layer_times[7] = t1 - t0;
-
-    double total_time = 0.0;
-    for (int i = 0; i < 8; i++)
-        total_time += layer_times[i];
-
-    printf("\n=== LAYER-WISE PERFORMANCE ===\n");
-    printf("Conv1:    %.3f ms  (%.1f%%)\n", layer_times[0], 100.0*layer_times[0]/total_time);
-    printf("AvgPool1: %.3f ms  (%.1f%%)\n", layer_times[1], 100.0*layer_times[1]/total_time);
-    printf("Conv2:    %.3f ms  (%.1f%%)\n", layer_times[2], 100.0*layer_times[2]/total_time);
-    printf("AvgPool2: %.3f ms  (%.1f%%)\n", layer_times[3], 100.0*layer_times[3]/total_time);
-    printf("Conv3:    %.3f ms  (%.1f%%)\n", layer_times[4], 100.0*layer_times[4]/total_time);
-    printf("MaxPool:  %.3f ms  (%.1f%%)\n", layer_times[5], 100.0*layer_times[5]/total_time);
-    printf("FC1:      %.3f ms  (%.1f%%)\n", layer_times[6], 100.0*layer_times[6]/total_time);
-    printf("FC2:      %.3f ms  (%.1f%%)\n", layer_times[7], 100.0*layer_times[7]/total_time);
+
+    float out_f[FC2_OUT];
+    int8_t out_q[FC2_OUT];
+    double t_f[NUM_LAYERS], t_q[NUM_LAYERS], scratch[NUM_LAYERS];
+
+    memset(scratch, 0, sizeof(scratch));
+    run_fp32(out_f, scratch);
+    run_int8(out_q, scratch);
+
+    memset(t_f, 0, sizeof(t_f));
+    memset(t_q, 0, sizeof(t_q));
+    for (int r = 0; r < runs; r++) {
+        run_fp32(out_f, t_f);
+        run_int8(out_q, t_q);
+    }
+
+    double total_f = 0.0, total_q = 0.0;
+    for (int i = 0; i < NUM_LAYERS; i++) {
+        t_f[i] /= runs;
+        t_q[i] /= runs;
+        total_f += t_f[i];
+        total_q += t_q[i];
+    }
+
+    printf("\n=== LAYER-WISE PERFORMANCE (mean of %d runs) ===\n", runs);
+    printf("%-9s %10s %7s %10s %7s %8s\n", "Layer", "FP32 ms", "share", "int8 ms", "share", "int8 x");
+    for (int i = 0; i < NUM_LAYERS; i++)
+        printf("%-9s %10.3f %6.1f%% %10.3f %6.1f%% %7.2fx\n", names[i],
+               t_f[i], 100.0 * t_f[i] / total_f, t_q[i], 100.0 * t_q[i] / total_q,
+               t_q[i] > 0.0 ? t_f[i] / t_q[i] : 0.0);
 
     printf("\n=== OVERALL PERFORMANCE ===\n");
-    printf("Total Inference Time:  %.3f ms\n", total_time);
-    printf("Throughput:            %.2f inferences/sec\n", 1000.0 / total_time);
-    printf("Performance:           %.2f GFLOPS\n", (total_ops / 1e9) / (total_time / 1000.0));
-    printf("Average Latency:       %.3f ms\n", total_time);
+    printf("%-22s %10s %10s\n", "", "FP32", "int8");
+    printf("%-22s %10.3f %10.3f\n", "Inference time (ms):", total_f, total_q);
+    printf("%-22s %10.2f %10.2f\n", "Throughput (inf/s):", 1000.0 / total_f, 1000.0 / total_q);
+    printf("%-22s %10.3f %10.3f\n", "Performance (GOPS):",
+           (total_ops / 1e9) / (total_f / 1000.0), (total_ops / 1e9) / (total_q / 1000.0));
 
     printf("\n=== OUTPUT VERIFICATION ===\n");
-    printf("Output (first 10): ");
-    for (int i = 0; i < 10 && i < 20; i++)
-        printf("%.4f ", output[i]);
-    printf("\n");
-    printf("Output (last 10):  ");
-    for (int i = 10; i < 20; i++)
-        printf("%.4f ", output[i]);
-    printf("\n");
-
-    // Find max output for classification
-    float max_val = output[0];
-    int max_idx = 0;
-    for (int i = 1; i < 20; i++) {
-        if (output[i] > max_val) {
-            max_val = output[i];
-            max_idx = i;
-        }
+    printf("FP32: ");
+    for (int i = 0; i < FC2_OUT; i++) printf("%.4g ", out_f[i]);
+    printf("\nint8: ");
+    int mismatches = 0;
+    for (int i = 0; i < FC2_OUT; i++) {
+        printf("%d ", out_q[i]);
+        if (out_q[i] != cnn_network_scores[i]) mismatches++;
+    }
+    printf("  (cnn_network(): ");
+    for (int i = 0; i < FC2_OUT; i++) printf("%d ", cnn_network_scores[i]);
+    printf("-> %s)\n", mismatches ? "MISMATCH" : "match");
+
+    // Find max output for classification (first index wins ties, as in the testbench)
+    int class_f = 0, class_q = 0;
+    for (int i = 1; i < FC2_OUT; i++) {
+        if (out_f[i] > out_f[class_f]) class_f = i;
+        if (out_q[i] > out_q[class_q]) class_q = i;
+    }
+    printf("Predicted class: FP32 %d, int8 %d%s\n", class_f, class_q,
+           class_f == class_q ? "" : "  (int8 rounding changes the decision)");
+
+    roofline_layer_t roof_f[NUM_LAYERS], roof_q[NUM_LAYERS];
+    network_roofline(roof_f, names, layer_ops, t_f, 4);
+    network_roofline(roof_q, names, layer_ops, t_q, 1);
+    roofline_print(stdout, "FP32", roof_f, NUM_LAYERS, roofline_fp32(peaks));
+    roofline_print(stdout, "int8", roof_q, NUM_LAYERS, roofline_int8(peaks));
+
+    FILE *csv = fopen("roofline.csv", "w");
+    if (csv) {
+        roofline_write_csv_header(csv);
+        roofline_write_csv(csv, "fp32", roof_f, NUM_LAYERS, roofline_fp32(peaks));
+        roofline_write_csv(csv, "int8", roof_q, NUM_LAYERS, roofline_int8(peaks));
+        fclose(csv);
+        printf("\nRoofline data written to roofline.csv\n");
     }
-    printf("Predicted class: %d (confidence: %.4f)\n", max_idx, max_val);
 
+    if (mismatches) {
+        printf("\nint8 scores differ from cnn_network()\n");
+        return 1;
+    }
     return 0;
 }
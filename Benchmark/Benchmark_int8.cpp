@@ -0,0 +1,925 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <string.h>
+#include <math.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "../cnn_types.h"
+#include "../cnn_utils.h"
+#include "../embedded_weight_loader.h"
+#include "../ship_weights.h"
+#include "../ship_gate_weights.h"
+#include "../cnn_cache.h"
+#include "../cnn_conv.h"
+#include "../cnn_pool.h"
+#include "../cnn_fc.h"
+
+/*
+ * int8 benchmark for the HLS network in C-simulation
+ * Build: g++ -O2 -pthread -I<Vivado HLS include> Benchmark_int8.cpp ../cnn_network.cpp \
+ *            ../cnn_network_delta.cpp ../cnn_network_int4.cpp ../cnn_network_pipeline.cpp
+ * Usage: ./Benchmark_int8 [gate_threshold] [num_tiles] [ship_every] [cache_entries]
+ */
+
+/* ---------------- Network entry points ---------------- */
+
+extern void cnn_network(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+extern void cnn_network_cascade(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    weight_t gate_weights[GATE_OUT][GATE_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    bias_t gate_bias[GATE_OUT],
+    int gate_threshold,
+    bool *rejected,
+    int H,
+    int W
+);
+
+extern void cnn_network_delta(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W,
+    bool reset,
+    int dirty_box[4]
+);
+
+extern void cnn_network_int4(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    wpack_t conv1_weights[CONV1_OUT_CH][WPACK_LEN(CONV1_IN_CH * CONV1_K * CONV1_K)],
+    wpack_t conv2_weights[CONV2_OUT_CH][WPACK_LEN(CONV2_IN_CH * CONV2_K * CONV2_K)],
+    wpack_t conv3_weights[CONV3_OUT_CH][WPACK_LEN(CONV3_IN_CH * CONV3_K * CONV3_K)],
+    wpack_t fc1_weights[FC1_OUT][WPACK_LEN(FC1_IN)],
+    wpack_t fc2_weights[FC2_OUT][WPACK_LEN(FC2_IN)],
+    wscale4_t w4_scales[INT4_LAYERS],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+extern void cnn_network_pipeline(
+    data_t frames[PIPE_MAX_FRAMES][CONV1_IN_CH][MAX_H][MAX_W],
+    data_t scores[PIPE_MAX_FRAMES][FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int num_frames,
+    int H,
+    int W
+);
+
+/* Layer-group stages of cnn_network_pipeline() */
+extern void pipe_stage_conv1(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    act_t output[CONV1_OUT_CH][MAX_H][MAX_W],
+    weight_t weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    int H,
+    int W
+);
+extern void pipe_stage_conv2(
+    act_t input[CONV2_IN_CH][MAX_H][MAX_W],
+    act_t output[CONV2_OUT_CH][MAX_H][MAX_W],
+    weight_t weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    int H,
+    int W
+);
+extern void pipe_stage_conv3(
+    act_t input[CONV3_IN_CH][MAX_H][MAX_W],
+    act_t output[FC1_IN],
+    weight_t weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    int H,
+    int W
+);
+extern void pipe_stage_fc(
+    act_t input[FC1_IN],
+    data_t output[FC2_OUT],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT]
+);
+
+/* ---------------- Utility ---------------- */
+
+static inline double now_ms() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+/* ---------------- Model and inputs ---------------- */
+
+static weight_t conv1_w[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K];
+static weight_t conv2_w[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K];
+static weight_t conv3_w[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K];
+static weight_t fc1_w[FC1_OUT][FC1_IN];
+static weight_t fc2_w[FC2_OUT][FC2_IN];
+static weight_t gate_w[GATE_OUT][GATE_IN];
+static bias_t fc1_b[FC1_OUT];
+static bias_t fc2_b[FC2_OUT];
+static bias_t gate_b[GATE_OUT];
+
+/* FC1 weights inside the embedded blob (after the three conv layers) */
+#define SHIP_DETECTOR_FC1 (SHIP_DETECTOR_WEIGHTS + \
+    CONV1_OUT_CH * CONV1_IN_CH * CONV1_K * CONV1_K + \
+    CONV2_OUT_CH * CONV2_IN_CH * CONV2_K * CONV2_K + \
+    CONV3_OUT_CH * CONV3_IN_CH * CONV3_K * CONV3_K)
+
+static data_t ship_tile[CONV1_IN_CH][MAX_H][MAX_W];
+static data_t tile[CONV1_IN_CH][MAX_H][MAX_W];
+
+static void load_model() {
+    EmbeddedWeightLoader loader(SHIP_DETECTOR_WEIGHTS);
+    loader.load_conv_weights<CONV1_OUT_CH, CONV1_IN_CH, CONV1_K>(conv1_w);
+    loader.load_conv_weights<CONV2_OUT_CH, CONV2_IN_CH, CONV2_K>(conv2_w);
+    loader.load_conv_weights<CONV3_OUT_CH, CONV3_IN_CH, CONV3_K>(conv3_w);
+    loader.load_fc_weights<FC1_OUT, FC1_IN>(fc1_w);
+    loader.load_fc_weights<FC2_OUT, FC2_IN>(fc2_w);
+    for (int i = 0; i < FC1_OUT; i++) fc1_b[i] = 0;
+    for (int i = 0; i < FC2_OUT; i++) fc2_b[i] = 0;
+
+    EmbeddedWeightLoader gate_loader(SHIP_DETECTOR_GATE_WEIGHTS);
+    gate_loader.load_fc_weights<GATE_OUT, GATE_IN>(gate_w);
+    gate_loader.load_bias<GATE_OUT>(gate_b);
+
+    load_embedded_input(SHIP_DETECTOR_INPUT, ship_tile, MAX_H, MAX_W);
+}
+
+/* Open-water tile: dark blue-green with low-amplitude noise */
+static void make_sea_tile(data_t t[CONV1_IN_CH][MAX_H][MAX_W]) {
+    static const int base[CONV1_IN_CH] = { 20, 45, 70 };
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int h = 0; h < MAX_H; h++)
+            for (int w = 0; w < MAX_W; w++)
+                t[c][h][w] = (data_t)(base[c] + (rand() % 17) - 8 - 128);
+}
+
+/* Ship image shifted by (dy, dx) with mirrored borders; n = 0 is unshifted */
+static int mirror(int i, int n) {
+    i %= 2 * n;
+    if (i < 0) i += 2 * n;
+    return i < n ? i : 2 * n - 1 - i;
+}
+
+static void make_ship_crop(data_t t[CONV1_IN_CH][MAX_H][MAX_W], int dy, int dx) {
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int h = 0; h < MAX_H; h++)
+            for (int w = 0; w < MAX_W; w++)
+                t[c][h][w] = ship_tile[c][mirror(h + dy, MAX_H)][mirror(w + dx, MAX_W)];
+}
+
+/* Open water the gate was not trained on (as tools/train_gate.py holds
+ * out): grey-green base, stronger noise, swell along the rows, sun glint */
+static void make_swell_tile(data_t t[CONV1_IN_CH][MAX_H][MAX_W]) {
+    int base[CONV1_IN_CH] = { 45 + rand() % 46, 70 + rand() % 41, 40 + rand() % 81 };
+    int amp = 12 + rand() % 17, swell = 6 + rand() % 15, period = 6 + rand() % 19;
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int h = 0; h < MAX_H; h++) {
+            int wave = (int)(swell * sin(2 * M_PI * h / period));
+            for (int w = 0; w < MAX_W; w++) {
+                int v = base[c] + wave + rand() % (2 * amp + 1) - amp;
+                if (rand() % 100 == 0) v = 255;
+                t[c][h][w] = (data_t)((v < 0 ? 0 : v > 255 ? 255 : v) - 128);
+            }
+        }
+}
+
+/* The ship image at half size on held-out open water */
+static void make_small_ship_tile(data_t t[CONV1_IN_CH][MAX_H][MAX_W]) {
+    make_swell_tile(t);
+    int oy = rand() % (MAX_H / 2 + 1), ox = rand() % (MAX_W / 2 + 1);
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int h = 0; h < MAX_H / 2; h++)
+            for (int w = 0; w < MAX_W / 2; w++)
+                t[c][oy + h][ox + w] = ship_tile[c][2 * h][2 * w];
+}
+
+/* ---------------- Cascade benchmark ---------------- */
+
+/* Scored on held-out tiles: shifted ship crops and half-size ships for
+ * recall, swell tiles for the skip rate */
+
+static void bench_cascade(int threshold, int num_tiles, int ship_every) {
+    data_t out_full[FC2_OUT];
+    data_t out_cascade[FC2_OUT];
+
+    double t_full = 0.0, t_cascade = 0.0;
+    double t_rejected = 0.0, t_accepted = 0.0;
+    int rejected_tiles = 0, ship_tiles = 0, ships_rejected = 0, mismatches = 0;
+
+    for (int n = 0; n < num_tiles; n++) {
+        bool is_ship = (ship_every > 0) && (n % ship_every == 0);
+        if (is_ship) {
+            if (ship_tiles % 2 == 0) make_ship_crop(tile, 13 * n, 29 * n);
+            else make_small_ship_tile(tile);
+            ship_tiles++;
+        } else {
+            make_swell_tile(tile);
+        }
+
+        double t0 = now_ms();
+        cnn_network(tile, out_full, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w,
+                    fc1_b, fc2_b, MAX_H, MAX_W);
+        double t1 = now_ms();
+
+        bool rejected = false;
+        cnn_network_cascade(tile, out_cascade, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w, gate_w,
+                            fc1_b, fc2_b, gate_b, threshold, &rejected, MAX_H, MAX_W);
+        double t2 = now_ms();
+
+        t_full += t1 - t0;
+        t_cascade += t2 - t1;
+        if (rejected) {
+            rejected_tiles++;
+            t_rejected += t2 - t1;
+            if (is_ship) ships_rejected++;
+        } else {
+            t_accepted += t2 - t1;
+            for (int i = 0; i < FC2_OUT; i++)
+                if (out_full[i] != out_cascade[i]) mismatches++;
+        }
+    }
+
+    int accepted_tiles = num_tiles - rejected_tiles;
+
+    printf("\n=== EARLY-EXIT CASCADE ===\n");
+    printf("Gate:             GAP(POOL1) -> FC %dx%d, threshold %d\n", GATE_IN, GATE_OUT, threshold);
+    printf("Tiles:            %d held-out (%d ship, %d sea)\n", num_tiles, ship_tiles, num_tiles - ship_tiles);
+    printf("Rejected early:   %d (skip rate %.1f%%)\n", rejected_tiles, 100.0 * rejected_tiles / num_tiles);
+    if (ship_tiles > 0)
+        printf("Ship recall:      %d of %d (%.1f%%)\n", ship_tiles - ships_rejected, ship_tiles,
+               100.0 * (ship_tiles - ships_rejected) / ship_tiles);
+    printf("Full network:     %.3f ms/tile\n", t_full / num_tiles);
+    printf("Cascade:          %.3f ms/tile\n", t_cascade / num_tiles);
+    if (rejected_tiles > 0)
+        printf("  rejected tiles: %.3f ms/tile\n", t_rejected / rejected_tiles);
+    if (accepted_tiles > 0)
+        printf("  accepted tiles: %.3f ms/tile\n", t_accepted / accepted_tiles);
+    printf("Latency savings:  %.1f%%\n", 100.0 * (t_full - t_cascade) / t_full);
+    printf("Accepted outputs: %s\n", mismatches == 0 ? "identical to cnn_network()" : "MISMATCH");
+}
+
+/* ---------------- Result cache benchmark ---------------- */
+
+/* Re-tasked passes: every unique tile is requested `repeats` times,
+ * interleaved so that repeats arrive after other tiles in between. */
+static void bench_cache(size_t cache_entries, int unique_tiles, int repeats) {
+    static data_t tiles[8][CONV1_IN_CH][MAX_H][MAX_W];
+    data_t out_ref[8][FC2_OUT];
+    data_t out[FC2_OUT];
+
+    if (unique_tiles > 8) unique_tiles = 8;
+    memcpy(tiles[0], ship_tile, sizeof(tiles[0]));
+    for (int u = 1; u < unique_tiles; u++) make_sea_tile(tiles[u]);
+
+    InferenceCache cache(cache_entries,
+                         InferenceCache::version_of(SHIP_DETECTOR_WEIGHTS, TOTAL_WEIGHTS));
+
+    double t_hit = 0.0, t_miss = 0.0, t_hash = 0.0;
+    int mismatches = 0;
+
+    for (int r = 0; r < repeats; r++) {
+        for (int u = 0; u < unique_tiles; u++) {
+            double t0 = now_ms();
+            bool hit = cnn_network_cached(cache, tiles[u], out, conv1_w, conv2_w, conv3_w,
+                                          fc1_w, fc2_w, fc1_b, fc2_b, MAX_H, MAX_W);
+            double t1 = now_ms();
+
+            if (hit) {
+                t_hit += t1 - t0;
+                for (int i = 0; i < FC2_OUT; i++)
+                    if (out[i] != out_ref[u][i]) mismatches++;
+            } else {
+                t_miss += t1 - t0;
+                if (r == 0) memcpy(out_ref[u], out, sizeof(out));
+            }
+        }
+    }
+
+    /* Hash cost alone on the raw 49152-byte tile */
+    const int hash_iters = 1000;
+    uint64_t sink = 0;
+    double t0 = now_ms();
+    for (int i = 0; i < hash_iters; i++)
+        sink += TileHasher::hash_bytes(SHIP_DETECTOR_INPUT, INPUT_SIZE, (uint64_t)i);
+    t_hash = (now_ms() - t0) / hash_iters;
+
+    printf("\n=== TILE RESULT CACHE ===\n");
+    printf("Capacity:         %zu entries (%zu bytes in use)\n", cache_entries, cache.memory_bytes());
+    printf("Requests:         %d (%d unique x %d passes)\n", unique_tiles * repeats, unique_tiles, repeats);
+    printf("Hits / misses:    %llu / %llu (hit rate %.1f%%), %llu evictions\n",
+           (unsigned long long)cache.hits(), (unsigned long long)cache.misses(),
+           100.0 * cache.hit_rate(), (unsigned long long)cache.evictions());
+    if (cache.misses() > 0)
+        printf("Miss latency:     %.3f ms\n", t_miss / cache.misses());
+    if (cache.hits() > 0)
+        printf("Hit latency:      %.1f us\n", 1000.0 * t_hit / cache.hits());
+    printf("Hash (49152 B):   %.1f us (checksum %016llx)\n", 1000.0 * t_hash, (unsigned long long)sink);
+    printf("Hit outputs:      %s\n", mismatches == 0 ? "identical to cnn_network()" : "MISMATCH");
+}
+
+/* ---------------- Temporal delta benchmark ---------------- */
+
+/* Port monitoring: static scene with one small vessel drifting across it */
+static void bench_delta(int frames) {
+    static data_t frame[CONV1_IN_CH][MAX_H][MAX_W];
+    data_t out_full[FC2_OUT];
+    data_t out_delta[FC2_OUT];
+    int dirty_box[4];
+
+    double t_full = 0.0, t_delta = 0.0;
+    long long dirty_pixels = 0;
+    int mismatches = 0;
+
+    for (int f = 0; f < frames; f++) {
+        memcpy(frame, ship_tile, sizeof(frame));
+        int y = 40 + (f % 8);
+        int x = 10 + 3 * f % (MAX_W - 22);
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int h = y; h < y + 6; h++)
+                for (int w = x; w < x + 12; w++)
+                    frame[c][h][w] = (data_t)(100 - 30 * c);
+
+        double t0 = now_ms();
+        cnn_network(frame, out_full, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w,
+                    fc1_b, fc2_b, MAX_H, MAX_W);
+        double t1 = now_ms();
+        cnn_network_delta(frame, out_delta, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w,
+                          fc1_b, fc2_b, MAX_H, MAX_W, f == 0, dirty_box);
+        double t2 = now_ms();
+
+        /* The first frame is a full recompute for both */
+        if (f > 0) {
+            t_full += t1 - t0;
+            t_delta += t2 - t1;
+            dirty_pixels += (long long)(dirty_box[2] - dirty_box[0]) * (dirty_box[3] - dirty_box[1]);
+        }
+        for (int i = 0; i < FC2_OUT; i++)
+            if (out_full[i] != out_delta[i]) mismatches++;
+    }
+
+    int n = frames - 1;
+    printf("\n=== TEMPORAL DELTA INFERENCE ===\n");
+    printf("Frames:           %d (first is a full recompute)\n", frames);
+    printf("Changed region:   %.0f pixels/frame (%.1f%% of tile)\n",
+           (double)dirty_pixels / n, 100.0 * dirty_pixels / n / (MAX_H * MAX_W));
+    printf("Full network:     %.3f ms/frame\n", t_full / n);
+    printf("Delta network:    %.3f ms/frame\n", t_delta / n);
+    printf("Speedup:          %.2fx\n", t_full / t_delta);
+    printf("Delta outputs:    %s\n", mismatches == 0 ? "identical to cnn_network()" : "MISMATCH");
+}
+
+/* ---------------- Frame pipeline ---------------- */
+
+/* Ping-pong buffer between two stage threads: frame f uses slot f & 1, so
+ * the producer can fill frame n+1 while the consumer still reads frame n */
+template<typename T>
+struct PingPong {
+    T slot[2];
+    bool full[2];
+    std::mutex m;
+    std::condition_variable cv;
+
+    PingPong() { full[0] = full[1] = false; }
+
+    T& wait_empty(int f) {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [&] { return !full[f & 1]; });
+        return slot[f & 1];
+    }
+    T& wait_full(int f) {
+        std::unique_lock<std::mutex> lock(m);
+        cv.wait(lock, [&] { return full[f & 1]; });
+        return slot[f & 1];
+    }
+    void set(int f, bool v) {
+        { std::lock_guard<std::mutex> lock(m); full[f & 1] = v; }
+        cv.notify_all();
+    }
+};
+
+typedef act_t pool1_buf_t[CONV1_OUT_CH][MAX_H][MAX_W];
+typedef act_t pool2_buf_t[CONV2_OUT_CH][MAX_H][MAX_W];
+typedef act_t flat_buf_t[FC1_IN];
+
+static data_t pipe_frames[PIPE_MAX_FRAMES][CONV1_IN_CH][MAX_H][MAX_W];
+static PingPong<pool1_buf_t> link1;
+static PingPong<pool2_buf_t> link2;
+static PingPong<flat_buf_t> link3;
+
+static int pipe_h2, pipe_w2, pipe_h4, pipe_w4;
+
+static void pipe_thread_conv1(int frames) {
+    for (int f = 0; f < frames; f++) {
+        pool1_buf_t &out = link1.wait_empty(f);
+        pipe_stage_conv1(pipe_frames[f], out, conv1_w, MAX_H, MAX_W);
+        link1.set(f, true);
+    }
+}
+
+static void pipe_thread_conv2(int frames) {
+    for (int f = 0; f < frames; f++) {
+        pool1_buf_t &in = link1.wait_full(f);
+        pool2_buf_t &out = link2.wait_empty(f);
+        pipe_stage_conv2(in, out, conv2_w, pipe_h2, pipe_w2);
+        link1.set(f, false);
+        link2.set(f, true);
+    }
+}
+
+static void pipe_thread_conv3(int frames) {
+    for (int f = 0; f < frames; f++) {
+        pool2_buf_t &in = link2.wait_full(f);
+        flat_buf_t &out = link3.wait_empty(f);
+        pipe_stage_conv3(in, out, conv3_w, pipe_h4, pipe_w4);
+        link2.set(f, false);
+        link3.set(f, true);
+    }
+}
+
+static void pipe_thread_fc(int frames, data_t scores[PIPE_MAX_FRAMES][FC2_OUT]) {
+    for (int f = 0; f < frames; f++) {
+        flat_buf_t &in = link3.wait_full(f);
+        pipe_stage_fc(in, scores[f], fc1_w, fc2_w, fc1_b, fc2_b);
+        link3.set(f, false);
+    }
+}
+
+/* Host emulation of cnn_network_pipeline(): one thread per stage, linked
+ * by ping-pong buffers. Throughput should approach 1 / max(stage) with at
+ * least PIPE_STAGES cores. */
+static void bench_pipeline(int frames) {
+    static data_t ref[PIPE_MAX_FRAMES][FC2_OUT];
+    static data_t out_hls[PIPE_MAX_FRAMES][FC2_OUT];
+    static data_t out_threads[PIPE_MAX_FRAMES][FC2_OUT];
+    static pool1_buf_t p1;
+    static pool2_buf_t p2;
+    static flat_buf_t flat;
+
+    if (frames > PIPE_MAX_FRAMES) frames = PIPE_MAX_FRAMES;
+    for (int f = 0; f < frames; f++) {
+        if (f % 2 == 0) memcpy(pipe_frames[f], ship_tile, sizeof(pipe_frames[f]));
+        else make_sea_tile(pipe_frames[f]);
+    }
+    pipe_h2 = pool_out_size(conv_out_size(MAX_H, CONV1_K, 1), POOL1_SIZE, POOL1_SIZE);
+    pipe_w2 = pool_out_size(conv_out_size(MAX_W, CONV1_K, 1), POOL1_SIZE, POOL1_SIZE);
+    pipe_h4 = pool_out_size(conv_out_size(pipe_h2, CONV2_K, 1), POOL2_SIZE, POOL2_SIZE);
+    pipe_w4 = pool_out_size(conv_out_size(pipe_w2, CONV2_K, 1), POOL2_SIZE, POOL2_SIZE);
+
+    /* Sequential: one frame at a time, timing each stage */
+    double stage_ms[PIPE_STAGES] = { 0 };
+    double t0 = now_ms();
+    for (int f = 0; f < frames; f++) {
+        double t[PIPE_STAGES + 1];
+        t[0] = now_ms();
+        pipe_stage_conv1(pipe_frames[f], p1, conv1_w, MAX_H, MAX_W);
+        t[1] = now_ms();
+        pipe_stage_conv2(p1, p2, conv2_w, pipe_h2, pipe_w2);
+        t[2] = now_ms();
+        pipe_stage_conv3(p2, flat, conv3_w, pipe_h4, pipe_w4);
+        t[3] = now_ms();
+        pipe_stage_fc(flat, ref[f], fc1_w, fc2_w, fc1_b, fc2_b);
+        t[4] = now_ms();
+        for (int s = 0; s < PIPE_STAGES; s++) stage_ms[s] += t[s + 1] - t[s];
+    }
+    double t_seq = now_ms() - t0;
+
+    /* Threaded: all stages in flight on consecutive frames */
+    t0 = now_ms();
+    std::thread th1(pipe_thread_conv1, frames);
+    std::thread th2(pipe_thread_conv2, frames);
+    std::thread th3(pipe_thread_conv3, frames);
+    std::thread th4(pipe_thread_fc, frames, out_threads);
+    th1.join();
+    th2.join();
+    th3.join();
+    th4.join();
+    double t_pipe = now_ms() - t0;
+
+    /* The HLS top itself (sequential in C-simulation) */
+    cnn_network_pipeline(pipe_frames, out_hls, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w,
+                         fc1_b, fc2_b, frames, MAX_H, MAX_W);
+
+    int mismatches = 0;
+    for (int f = 0; f < frames; f++) {
+        data_t out_net[FC2_OUT];
+        cnn_network(pipe_frames[f], out_net, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w,
+                    fc1_b, fc2_b, MAX_H, MAX_W);
+        for (int i = 0; i < FC2_OUT; i++)
+            if (out_net[i] != ref[f][i] || out_net[i] != out_threads[f][i] ||
+                out_net[i] != out_hls[f][i]) mismatches++;
+    }
+
+    static const char *names[PIPE_STAGES] = { "CONV1+pool", "CONV2+pool", "CONV3+pool+flat", "FC1+FC2" };
+    double sum = 0.0, slowest = 0.0;
+    for (int s = 0; s < PIPE_STAGES; s++) {
+        sum += stage_ms[s] / frames;
+        if (stage_ms[s] / frames > slowest) slowest = stage_ms[s] / frames;
+    }
+
+    printf("\n=== FRAME PIPELINE (%d stages, ping-pong buffers) ===\n", PIPE_STAGES);
+    printf("Frames:           %d, %u hardware threads\n", frames, std::thread::hardware_concurrency());
+    for (int s = 0; s < PIPE_STAGES; s++)
+        printf("  %-16s %8.3f ms/frame\n", names[s], stage_ms[s] / frames);
+    printf("Sequential:       %.1f frames/s (sum of stages %.3f ms)\n", 1000.0 * frames / t_seq, sum);
+    printf("Pipelined:        %.1f frames/s (bound %.1f from slowest stage)\n",
+           1000.0 * frames / t_pipe, 1000.0 / slowest);
+    printf("Speedup:          %.2fx (ideal %.2fx)\n", t_seq / t_pipe, sum / slowest);
+    printf("Pipeline outputs: %s\n", mismatches == 0 ? "identical to cnn_network()" : "MISMATCH");
+}
+
+/* ---------------- Conv loop tiling ---------------- */
+
+/* Times conv_layer_simple() (plain and DSP-packed) against
+ * conv_layer_tiled() on one layer; returns mismatching outputs */
+template<int IN_CH, int OUT_CH, int K, int STRIDE>
+static int bench_conv_layer(const char *name, data_t in[IN_CH][MAX_H][MAX_W],
+                            weight_t w[OUT_CH][IN_CH][K][K], int h, int reps) {
+    static data_t out_ref[OUT_CH][MAX_H][MAX_W];
+    static data_t out[OUT_CH][MAX_H][MAX_W];
+    int oh = conv_out_size(h, K, STRIDE);
+    int tiles = (oh + CONV_TILE_ROWS - 1) / CONV_TILE_ROWS;
+
+    double t0 = now_ms();
+    for (int r = 0; r < reps; r++)
+        conv_layer_simple<IN_CH, OUT_CH, K, STRIDE, MAX_H, MAX_W, MAX_H, MAX_W, default_precision, false>(
+            in, out_ref, w, h, h);
+    double t_simple = (now_ms() - t0) / reps;
+
+    t0 = now_ms();
+    for (int r = 0; r < reps; r++)
+        conv_layer_simple<IN_CH, OUT_CH, K, STRIDE, MAX_H, MAX_W, MAX_H, MAX_W, default_precision, true>(
+            in, out, w, h, h);
+    double t_packed = (now_ms() - t0) / reps;
+    int mismatches = 0;
+    for (int o = 0; o < OUT_CH; o++)
+        for (int i = 0; i < oh; i++)
+            for (int j = 0; j < oh; j++)
+                if (out[o][i][j] != out_ref[o][i][j]) mismatches++;
+
+    t0 = now_ms();
+    for (int r = 0; r < reps; r++)
+        conv_layer_tiled<IN_CH, OUT_CH, K, STRIDE, CONV_TILE_ROWS, CONV_TILE_OC>(in, out, w, h, h);
+    double t_tiled = (now_ms() - t0) / reps;
+    for (int o = 0; o < OUT_CH; o++)
+        for (int i = 0; i < oh; i++)
+            for (int j = 0; j < oh; j++)
+                if (out[o][i][j] != out_ref[o][i][j]) mismatches++;
+
+    /* Reads of the full input map: once per MAC vs once per row tile */
+    long long reads_simple = (long long)OUT_CH * oh * oh * IN_CH * K * K;
+    long long reads_tiled = (long long)tiles * ((CONV_TILE_ROWS - 1) * STRIDE + K) * h * IN_CH;
+    printf("%-6s %10.3f %10.3f %10.3f %7.2fx %12lld %12lld %7.1fx\n", name,
+           t_simple, t_packed, t_tiled, t_simple / t_tiled,
+           reads_simple, reads_tiled, (double)reads_simple / reads_tiled);
+    return mismatches;
+}
+
+static void bench_conv_tiling(int reps) {
+    static data_t conv1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t conv2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static data_t pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    int h1 = conv_out_size(MAX_H, CONV1_K, 1);
+    int h2 = pool_out_size(h1, POOL1_SIZE, POOL1_SIZE);
+    int h3 = conv_out_size(h2, CONV2_K, 1);
+    int h4 = pool_out_size(h3, POOL2_SIZE, POOL2_SIZE);
+
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1>(ship_tile, conv1_out, conv1_w, MAX_H, MAX_W);
+    avg_pool<CONV1_OUT_CH, POOL1_SIZE>(conv1_out, pool1_out, h1, h1);
+    conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1>(pool1_out, conv2_out, conv2_w, h2, h2);
+    avg_pool<CONV2_OUT_CH, POOL2_SIZE>(conv2_out, pool2_out, h3, h3);
+
+    printf("\n=== CONV LOOP TILING (%d rows x %d channels per tile, %d reps) ===\n",
+           CONV_TILE_ROWS, CONV_TILE_OC, reps);
+    printf("%-6s %10s %10s %10s %8s %12s %12s %8s\n", "Layer", "simple ms", "packed ms", "tiled ms",
+           "speedup", "map reads", "tiled reads", "fewer");
+    int mismatches = 0;
+    mismatches += bench_conv_layer<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1>("conv1", ship_tile, conv1_w, MAX_H, reps);
+    mismatches += bench_conv_layer<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1>("conv2", pool1_out, conv2_w, h2, reps);
+    mismatches += bench_conv_layer<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE>("conv3", pool2_out, conv3_w, h4, reps);
+    printf("Tiled outputs:    %s\n", mismatches == 0 ? "identical to conv_layer_simple()" : "MISMATCH");
+}
+
+/* ---------------- FC1 kernel variants ---------------- */
+
+typedef fc_block_sparse<FC1_OUT, FC1_IN, FC1_SPARSE_BLOCK, FC1_SPARSE_MAX_BLOCKS> fc1_sparse_t;
+
+/* FC inputs of the embedded ship image: flattened POOL3 and FC1 output */
+static data_t fc1_in[FC1_IN];
+static data_t fc2_in[FC2_IN];
+
+static void compute_ship_features() {
+    static data_t conv1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t conv2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static data_t pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static data_t conv3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static data_t pool3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    int h1 = conv_out_size(MAX_H, CONV1_K, 1);
+    int h2 = pool_out_size(h1, POOL1_SIZE, POOL1_SIZE);
+    int h3 = conv_out_size(h2, CONV2_K, 1);
+    int h4 = pool_out_size(h3, POOL2_SIZE, POOL2_SIZE);
+    int h5 = conv_out_size(h4, CONV3_K, CONV3_STRIDE);
+
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1>(ship_tile, conv1_out, conv1_w, MAX_H, MAX_W);
+    avg_pool<CONV1_OUT_CH, POOL1_SIZE>(conv1_out, pool1_out, h1, h1);
+    conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1>(pool1_out, conv2_out, conv2_w, h2, h2);
+    avg_pool<CONV2_OUT_CH, POOL2_SIZE>(conv2_out, pool2_out, h3, h3);
+    conv_layer_simple<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE>(pool2_out, conv3_out, conv3_w, h4, h4);
+    max_pool<CONV3_OUT_CH, POOL3_SIZE>(conv3_out, pool3_out, h5, h5);
+    flatten<CONV3_OUT_CH, 8, 4>(pool3_out, fc1_in);
+    fc_layer<FC1_IN, FC1_OUT>(fc1_in, fc2_in, fc1_w, fc1_b, true);
+}
+
+static int count_zeros(const data_t *x, int n) {
+    int zeros = 0;
+    for (int i = 0; i < n; i++)
+        if (x[i] == 0) zeros++;
+    return zeros;
+}
+
+static int compare_int(const void *a, const void *b) {
+    return *(const int *)a - *(const int *)b;
+}
+
+/* Magnitude pruning: zero the `sparsity` fraction of blocks with smallest L1 */
+static void prune_fc1_blocks(double sparsity, int8_t blob[FC1_OUT * FC1_IN]) {
+    const int blocks = FC1_OUT * FC1_IN / FC1_SPARSE_BLOCK;
+    static int l1[FC1_OUT * FC1_IN / FC1_SPARSE_BLOCK];
+    static int sorted[FC1_OUT * FC1_IN / FC1_SPARSE_BLOCK];
+
+    for (int b = 0; b < blocks; b++) {
+        l1[b] = 0;
+        for (int k = 0; k < FC1_SPARSE_BLOCK; k++)
+            l1[b] += abs((int)SHIP_DETECTOR_FC1[b * FC1_SPARSE_BLOCK + k]);
+        sorted[b] = l1[b];
+    }
+    qsort(sorted, blocks, sizeof(int), compare_int);
+    int cut = (int)(sparsity * blocks);
+    int threshold = (cut > 0) ? sorted[cut - 1] : -1;
+
+    int dropped = 0;
+    for (int b = 0; b < blocks; b++) {
+        bool drop = l1[b] <= threshold && dropped < cut;
+        if (drop) dropped++;
+        for (int k = 0; k < FC1_SPARSE_BLOCK; k++)
+            blob[b * FC1_SPARSE_BLOCK + k] = drop ? 0 : SHIP_DETECTOR_FC1[b * FC1_SPARSE_BLOCK + k];
+    }
+}
+
+static double time_fc1_dense(weight_t w[FC1_OUT][FC1_IN], data_t out[FC1_OUT], int reps) {
+    double t0 = now_ms();
+    for (int r = 0; r < reps; r++)
+        fc_layer<FC1_IN, FC1_OUT>(fc1_in, out, w, fc1_b, true);
+    return (now_ms() - t0) / reps;
+}
+
+static double time_fc1_sparse(const fc1_sparse_t &w, data_t out[FC1_OUT], int reps) {
+    double t0 = now_ms();
+    for (int r = 0; r < reps; r++)
+        fc_layer_sparse(fc1_in, out, w, fc1_b, true);
+    return (now_ms() - t0) / reps;
+}
+
+static void bench_fc_variants(int reps) {
+    static int8_t pruned_blob[FC1_OUT * FC1_IN];
+    static weight_t pruned[FC1_OUT][FC1_IN];
+    static fc1_sparse_t sparse;
+    data_t out_dense[FC1_OUT], out_variant[FC1_OUT];
+    static const double sparsities[] = { 0.0, 0.5, 0.75, 0.9, 0.95 };
+
+    compute_ship_features();
+    double t_dense = time_fc1_dense(fc1_w, out_dense, reps);
+
+    printf("\n=== FC1 KERNEL VARIANTS (%dx%d, %d reps) ===\n", FC1_OUT, FC1_IN, reps);
+    printf("%-28s %10s %8s %12s %s\n", "Variant", "ms/call", "speedup", "model bytes", "check");
+    printf("%-28s %10.4f %7.2fx %12d %s\n", "dense fc_layer", t_dense, 1.0, FC1_OUT * FC1_IN, "ref");
+
+    for (unsigned s = 0; s < sizeof(sparsities) / sizeof(sparsities[0]); s++) {
+        prune_fc1_blocks(sparsities[s], pruned_blob);
+        for (int o = 0; o < FC1_OUT; o++)
+            for (int i = 0; i < FC1_IN; i++)
+                pruned[o][i] = pruned_blob[o * FC1_IN + i];
+
+        std::streambuf *saved = std::cout.rdbuf(NULL);   /* silence the loader */
+        EmbeddedWeightLoader loader(pruned_blob);
+        bool fits = loader.load_fc_weights_sparse(sparse);
+        std::cout.rdbuf(saved);
+
+        char name[64];
+        snprintf(name, sizeof(name), "block-sparse %2.0f%% pruned", 100.0 * sparsities[s]);
+        if (!fits) {
+            printf("%-28s %10s %8s %12s over FC1_SPARSE_MAX_BLOCKS (%d)\n", name, "-", "-", "-",
+                   FC1_SPARSE_MAX_BLOCKS);
+            continue;
+        }
+
+        time_fc1_dense(pruned, out_dense, 1);
+        double t = time_fc1_sparse(sparse, out_variant, reps);
+        bool exact = memcmp(out_dense, out_variant, sizeof(out_dense)) == 0;
+
+        printf("%-28s %10.4f %7.2fx %12zu %s\n", name, t, t_dense / t,
+               pack_fc_block_sparse(sparse, (int8_t *)NULL), exact ? "exact" : "MISMATCH");
+    }
+
+    /* Activation sparsity: skip zero inputs (dense weights) */
+    time_fc1_dense(fc1_w, out_dense, 1);
+    double t0 = now_ms();
+    for (int r = 0; r < reps; r++)
+        fc_layer_skip_zero<FC1_IN, FC1_OUT>(fc1_in, out_variant, fc1_w, fc1_b, true);
+    double t_skip = (now_ms() - t0) / reps;
+    bool exact = memcmp(out_dense, out_variant, sizeof(out_dense)) == 0;
+    printf("%-28s %10.4f %7.2fx %12d %s\n", "zero-skip activations", t_skip, t_dense / t_skip,
+           FC1_OUT * FC1_IN, exact ? "exact" : "MISMATCH");
+
+    /* FC2 sees the post-ReLU FC1 output */
+    data_t out2_dense[FC2_OUT], out2_skip[FC2_OUT];
+    const int reps2 = reps * 20;
+    t0 = now_ms();
+    for (int r = 0; r < reps2; r++)
+        fc_layer<FC2_IN, FC2_OUT>(fc2_in, out2_dense, fc2_w, fc2_b, false);
+    double t2_dense = (now_ms() - t0) / reps2;
+    t0 = now_ms();
+    for (int r = 0; r < reps2; r++)
+        fc_layer_skip_zero<FC2_IN, FC2_OUT>(fc2_in, out2_skip, fc2_w, fc2_b, false);
+    double t2_skip = (now_ms() - t0) / reps2;
+
+    printf("\nActivation sparsity on the embedded ship image:\n");
+    printf("  FC1 input: %4d/%d zeros   dense %.4f ms, zero-skip %.4f ms (%.2fx)\n",
+           count_zeros(fc1_in, FC1_IN), FC1_IN, t_dense, t_skip, t_dense / t_skip);
+    printf("  FC2 input: %4d/%d zeros    dense %.4f ms, zero-skip %.4f ms (%.2fx) %s\n",
+           count_zeros(fc2_in, FC2_IN), FC2_IN, t2_dense, t2_skip, t2_dense / t2_skip,
+           memcmp(out2_dense, out2_skip, sizeof(out2_dense)) == 0 ? "exact" : "MISMATCH");
+}
+
+/* ---------------- int4 weights ---------------- */
+
+#define CONV1_KSIZE (CONV1_IN_CH * CONV1_K * CONV1_K)
+#define CONV2_KSIZE (CONV2_IN_CH * CONV2_K * CONV2_K)
+#define CONV3_KSIZE (CONV3_IN_CH * CONV3_K * CONV3_K)
+
+static wpack_t conv1_w4[CONV1_OUT_CH][WPACK_LEN(CONV1_KSIZE)];
+static wpack_t conv2_w4[CONV2_OUT_CH][WPACK_LEN(CONV2_KSIZE)];
+static wpack_t conv3_w4[CONV3_OUT_CH][WPACK_LEN(CONV3_KSIZE)];
+static wpack_t fc1_w4[FC1_OUT][WPACK_LEN(FC1_IN)];
+static wpack_t fc2_w4[FC2_OUT][WPACK_LEN(FC2_IN)];
+static wscale4_t w4_scales[INT4_LAYERS];
+
+/* Quantize the int8 model into an int4 model file and load it back */
+static size_t load_model_int4() {
+    static const int rows[5] = { CONV1_OUT_CH, CONV2_OUT_CH, CONV3_OUT_CH, FC1_OUT, FC2_OUT };
+    static const int cols[5] = { CONV1_KSIZE, CONV2_KSIZE, CONV3_KSIZE, FC1_IN, FC2_IN };
+    static int8_t blob[FC1_OUT * FC1_IN];
+
+    size_t src = 0, bytes = 0;
+    for (int l = 0; l < 5; l++) {
+        bytes += pack_weights_int4(SHIP_DETECTOR_WEIGHTS + src, rows[l], cols[l], blob + bytes);
+        src += (size_t)rows[l] * cols[l];
+    }
+
+    std::streambuf *saved = std::cout.rdbuf(NULL);   /* silence the loader */
+    EmbeddedWeightLoader loader(blob);
+    loader.load_weights_int4<CONV1_OUT_CH, CONV1_KSIZE>(conv1_w4, w4_scales[0]);
+    loader.load_weights_int4<CONV2_OUT_CH, CONV2_KSIZE>(conv2_w4, w4_scales[1]);
+    loader.load_weights_int4<CONV3_OUT_CH, CONV3_KSIZE>(conv3_w4, w4_scales[2]);
+    loader.load_weights_int4<FC1_OUT, FC1_IN>(fc1_w4, w4_scales[3]);
+    loader.load_weights_int4<FC2_OUT, FC2_IN>(fc2_w4, w4_scales[4]);
+    std::cout.rdbuf(saved);
+    return bytes;
+}
+
+static int argmax(const data_t *x, int n) {
+    int best = 0;
+    for (int i = 1; i < n; i++)
+        if (x[i] > x[best]) best = i;
+    return best;
+}
+
+static void bench_int4(int num_tiles, int reps) {
+    size_t bytes8 = 0;
+    bytes8 += CONV1_OUT_CH * CONV1_KSIZE + CONV2_OUT_CH * CONV2_KSIZE + CONV3_OUT_CH * CONV3_KSIZE;
+    bytes8 += FC1_OUT * FC1_IN + FC2_OUT * FC2_IN;
+    size_t bytes4 = load_model_int4();
+
+    /* Whole network: accuracy against the int8 model, and latency */
+    data_t out8[FC2_OUT], out4[FC2_OUT];
+    double t8 = 0.0, t4 = 0.0;
+    int same_class = 0, same_scores = 0;
+    long long score_err = 0;
+
+    int ship_tiles = 0;
+
+    for (int n = 0; n < num_tiles; n++) {
+        if (n % 2 == 0) {
+            make_ship_crop(tile, 13 * n, 29 * n);
+            ship_tiles++;
+        } else {
+            make_sea_tile(tile);
+        }
+
+        double t0 = now_ms();
+        cnn_network(tile, out8, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w,
+                    fc1_b, fc2_b, MAX_H, MAX_W);
+        double t1 = now_ms();
+        cnn_network_int4(tile, out4, conv1_w4, conv2_w4, conv3_w4, fc1_w4, fc2_w4, w4_scales,
+                         fc1_b, fc2_b, MAX_H, MAX_W);
+        double t2 = now_ms();
+        t8 += t1 - t0;
+        t4 += t2 - t1;
+
+        bool same = true;
+        for (int i = 0; i < FC2_OUT; i++) {
+            score_err += abs((int)out8[i] - (int)out4[i]);
+            if (out8[i] != out4[i]) same = false;
+        }
+        if (same) same_scores++;
+        if (argmax(out8, FC2_OUT) == argmax(out4, FC2_OUT)) same_class++;
+    }
+
+    /* FC1 alone on the ship image features (weight-bandwidth bound) */
+    data_t fc1_out8[FC1_OUT], fc1_out4[FC1_OUT];
+    compute_ship_features();
+    double t_fc8 = time_fc1_dense(fc1_w, fc1_out8, reps);
+    double t0 = now_ms();
+    for (int r = 0; r < reps; r++)
+        fc_layer_int4<FC1_IN, FC1_OUT>(fc1_in, fc1_out4, fc1_w4, w4_scales[3], fc1_b, true);
+    double t_fc4 = (now_ms() - t0) / reps;
+    long long fc1_err = 0;
+    for (int o = 0; o < FC1_OUT; o++)
+        fc1_err += abs((int)fc1_out8[o] - (int)fc1_out4[o]);
+
+    printf("\n=== INT4 WEIGHTS vs INT8 ===\n");
+    printf("Weight bytes:     %zu int8 -> %zu int4 (%.1f%%)\n", bytes8, bytes4, 100.0 * bytes4 / bytes8);
+    printf("Network:          int8 %.3f ms/tile, int4 %.3f ms/tile (%.2fx)\n",
+           t8 / num_tiles, t4 / num_tiles, t8 / t4);
+    printf("FC1 kernel:       int8 %.4f ms, int4 %.4f ms (%.2fx)\n", t_fc8, t_fc4, t_fc8 / t_fc4);
+    printf("Tiles:            %d (%d shifted ship crops, %d sea)\n", num_tiles, ship_tiles,
+           num_tiles - ship_tiles);
+    printf("Same class:       %d of %d\n", same_class, num_tiles);
+    printf("Identical scores: %d of %d (mean |diff| %.2f)\n",
+           same_scores, num_tiles, (double)score_err / (num_tiles * FC2_OUT));
+    printf("FC1 activations:  mean |diff| %.2f on the ship image\n", (double)fc1_err / FC1_OUT);
+}
+
+/* ---------------- Main ---------------- */
+
+int main(int argc, char **argv) {
+    int threshold = (argc > 1) ? atoi(argv[1]) : GATE_THRESHOLD_DEFAULT;
+    int num_tiles = (argc > 2) ? atoi(argv[2]) : 40;
+    int ship_every = (argc > 3) ? atoi(argv[3]) : 20;   /* 5% ship tiles */
+    size_t cache_entries = (argc > 4) ? (size_t)atol(argv[4]) : 1024;
+
+    srand(42);
+
+    printf("=== INT8 NETWORK BENCHMARK (C-simulation) ===\n");
+    printf("Precision: int8 data/weights, int32 accumulation\n\n");
+
+    load_model();
+
+    bench_cascade(threshold, num_tiles, ship_every);
+    bench_cache(cache_entries, 8, 4);
+    bench_delta(10);
+    bench_pipeline(PIPE_MAX_FRAMES);
+    bench_conv_tiling(3);
+    bench_fc_variants(200);
+    bench_int4(num_tiles, 200);
+
+    return 0;
+}
@@ -0,0 +1,500 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <math.h>
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "../cnn_types.h"
+#include "../cnn_utils.h"
+#include "../embedded_weight_loader.h"
+#include "../ship_weights.h"
+#include "../ship_gate_weights.h"
+#include "../cnn_fc.h"
+#include "../cnn_perf.h"
+#include "../cnn_roofline.h"
+
+/*
+ * Statistical latency benchmark for the int8 network and its kernels
+ * Each case runs `warmup` untimed calls, then `reps` timed calls; latency
+ * is reported as mean/p50/p90/p99/max and throughput from the mean.
+ *
+ * Build: g++ -O2 -I<Vivado HLS include> Benchmark_stats.cpp ../cnn_network.cpp \
+ *            ../cnn_network_int4.cpp
+ * Usage: ./Benchmark_stats [-w warmup] [-n reps] [-c cpu] [-f filter] [-p]
+ *                          [-r host|pynq|peak_gops,peak_gbps]
+ *                          [-s save.txt] [-b baseline.txt] [-t tolerance_pct]
+ *
+ * -s saves the p50 of every case; -b compares against such a file and
+ * exits with status 1 if any p50 is slower than baseline by more than the
+ * tolerance (default 10%), or 2 if the baseline cannot be read or has no
+ * entry for any case that ran.
+ * -p adds a second pass under Linux perf_event counters (cnn_perf.h) and
+ * reports cycles, IPC, L1D/LLC misses per MAC and branch misses per call.
+ * -r prints a roofline table (cnn_roofline.h) of every case at its p50,
+ * against the int8 MAC and DRAM peaks measured on this host (after
+ * pinning), the nominal Pynq-Z2 A9 peaks, or the given GOPS and GB/s.
+ */
+
+/* ---------------- Network entry points ---------------- */
+
+extern void cnn_network(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+extern void cnn_network_cascade(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    weight_t gate_weights[GATE_OUT][GATE_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    bias_t gate_bias[GATE_OUT],
+    int gate_threshold,
+    bool *rejected,
+    int H,
+    int W
+);
+
+extern void cnn_network_int4(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    wpack_t conv1_weights[CONV1_OUT_CH][WPACK_LEN(CONV1_IN_CH * CONV1_K * CONV1_K)],
+    wpack_t conv2_weights[CONV2_OUT_CH][WPACK_LEN(CONV2_IN_CH * CONV2_K * CONV2_K)],
+    wpack_t conv3_weights[CONV3_OUT_CH][WPACK_LEN(CONV3_IN_CH * CONV3_K * CONV3_K)],
+    wpack_t fc1_weights[FC1_OUT][WPACK_LEN(FC1_IN)],
+    wpack_t fc2_weights[FC2_OUT][WPACK_LEN(FC2_IN)],
+    wscale4_t w4_scales[INT4_LAYERS],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+/* ---------------- Utility ---------------- */
+
+static inline double now_ms() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+/* Pin the process to one CPU to avoid migrations between samples */
+static bool pin_to_cpu(int cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+    return false;
+#endif
+}
+
+/* ---------------- Model and inputs ---------------- */
+
+#define CONV1_KSIZE (CONV1_IN_CH * CONV1_K * CONV1_K)
+#define CONV2_KSIZE (CONV2_IN_CH * CONV2_K * CONV2_K)
+#define CONV3_KSIZE (CONV3_IN_CH * CONV3_K * CONV3_K)
+
+/* Output sizes of the valid-convolution trunk (as in cnn_network) */
+#define H1 (MAX_H - CONV1_K + 1)
+#define W1 (MAX_W - CONV1_K + 1)
+#define H3 (H1 / POOL1_SIZE - CONV2_K + 1)
+#define W3 (W1 / POOL1_SIZE - CONV2_K + 1)
+#define H5 ((H3 / POOL2_SIZE - CONV3_K) / CONV3_STRIDE + 1)
+#define W5 ((W3 / POOL2_SIZE - CONV3_K) / CONV3_STRIDE + 1)
+
+#define CONV1_MACS ((long long)CONV1_OUT_CH * H1 * W1 * CONV1_IN_CH * CONV1_K * CONV1_K)
+#define CONV2_MACS ((long long)CONV2_OUT_CH * H3 * W3 * CONV2_IN_CH * CONV2_K * CONV2_K)
+#define CONV3_MACS ((long long)CONV3_OUT_CH * H5 * W5 * CONV3_IN_CH * CONV3_K * CONV3_K)
+#define FC1_MACS   ((long long)FC1_OUT * FC1_IN)
+#define FC2_MACS   ((long long)FC2_OUT * FC2_IN)
+#define NETWORK_MACS (CONV1_MACS + CONV2_MACS + CONV3_MACS + FC1_MACS + FC2_MACS)
+
+#define NETWORK_WEIGHTS (CONV1_OUT_CH * CONV1_KSIZE + CONV2_OUT_CH * CONV2_KSIZE + \
+                         CONV3_OUT_CH * CONV3_KSIZE + FC1_OUT * FC1_IN + FC2_OUT * FC2_IN)
+#define NETWORK_WEIGHTS4 (CONV1_OUT_CH * WPACK_LEN(CONV1_KSIZE) + CONV2_OUT_CH * WPACK_LEN(CONV2_KSIZE) + \
+                          CONV3_OUT_CH * WPACK_LEN(CONV3_KSIZE) + FC1_OUT * WPACK_LEN(FC1_IN) + \
+                          FC2_OUT * WPACK_LEN(FC2_IN))
+#define TILE_BYTES (CONV1_IN_CH * MAX_H * MAX_W)
+
+static weight_t conv1_w[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K];
+static weight_t conv2_w[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K];
+static weight_t conv3_w[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K];
+static weight_t fc1_w[FC1_OUT][FC1_IN];
+static weight_t fc2_w[FC2_OUT][FC2_IN];
+static weight_t gate_w[GATE_OUT][GATE_IN];
+static bias_t fc1_b[FC1_OUT];
+static bias_t fc2_b[FC2_OUT];
+static bias_t gate_b[GATE_OUT];
+
+static wpack_t conv1_w4[CONV1_OUT_CH][WPACK_LEN(CONV1_KSIZE)];
+static wpack_t conv2_w4[CONV2_OUT_CH][WPACK_LEN(CONV2_KSIZE)];
+static wpack_t conv3_w4[CONV3_OUT_CH][WPACK_LEN(CONV3_KSIZE)];
+static wpack_t fc1_w4[FC1_OUT][WPACK_LEN(FC1_IN)];
+static wpack_t fc2_w4[FC2_OUT][WPACK_LEN(FC2_IN)];
+static wscale4_t w4_scales[INT4_LAYERS];
+
+static data_t ship_tile[CONV1_IN_CH][MAX_H][MAX_W];
+static data_t sea_tile[CONV1_IN_CH][MAX_H][MAX_W];
+static data_t fc1_in[FC1_IN];
+static data_t out[FC2_OUT];
+static data_t fc1_out[FC1_OUT];
+
+static void load_model() {
+    static const int rows[5] = { CONV1_OUT_CH, CONV2_OUT_CH, CONV3_OUT_CH, FC1_OUT, FC2_OUT };
+    static const int cols[5] = { CONV1_KSIZE, CONV2_KSIZE, CONV3_KSIZE, FC1_IN, FC2_IN };
+    static int8_t blob4[FC1_OUT * FC1_IN];
+
+    std::streambuf *saved = std::cout.rdbuf(NULL);   /* silence the loaders */
+
+    EmbeddedWeightLoader loader(SHIP_DETECTOR_WEIGHTS);
+    loader.load_conv_weights<CONV1_OUT_CH, CONV1_IN_CH, CONV1_K>(conv1_w);
+    loader.load_conv_weights<CONV2_OUT_CH, CONV2_IN_CH, CONV2_K>(conv2_w);
+    loader.load_conv_weights<CONV3_OUT_CH, CONV3_IN_CH, CONV3_K>(conv3_w);
+    loader.load_fc_weights<FC1_OUT, FC1_IN>(fc1_w);
+    loader.load_fc_weights<FC2_OUT, FC2_IN>(fc2_w);
+    for (int i = 0; i < FC1_OUT; i++) fc1_b[i] = 0;
+    for (int i = 0; i < FC2_OUT; i++) fc2_b[i] = 0;
+
+    EmbeddedWeightLoader gate_loader(SHIP_DETECTOR_GATE_WEIGHTS);
+    gate_loader.load_fc_weights<GATE_OUT, GATE_IN>(gate_w);
+    gate_loader.load_bias<GATE_OUT>(gate_b);
+
+    size_t src = 0, bytes = 0;
+    for (int l = 0; l < 5; l++) {
+        bytes += pack_weights_int4(SHIP_DETECTOR_WEIGHTS + src, rows[l], cols[l], blob4 + bytes);
+        src += (size_t)rows[l] * cols[l];
+    }
+    EmbeddedWeightLoader loader4(blob4);
+    loader4.load_weights_int4<CONV1_OUT_CH, CONV1_KSIZE>(conv1_w4, w4_scales[0]);
+    loader4.load_weights_int4<CONV2_OUT_CH, CONV2_KSIZE>(conv2_w4, w4_scales[1]);
+    loader4.load_weights_int4<CONV3_OUT_CH, CONV3_KSIZE>(conv3_w4, w4_scales[2]);
+    loader4.load_weights_int4<FC1_OUT, FC1_IN>(fc1_w4, w4_scales[3]);
+    loader4.load_weights_int4<FC2_OUT, FC2_IN>(fc2_w4, w4_scales[4]);
+
+    load_embedded_input(SHIP_DETECTOR_INPUT, ship_tile, MAX_H, MAX_W);
+    std::cout.rdbuf(saved);
+
+    /* Open water for the cascade; FC1 input with the post-ReLU zero pattern */
+    srand(42);
+    static const int base[CONV1_IN_CH] = { 20, 45, 70 };
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int h = 0; h < MAX_H; h++)
+            for (int w = 0; w < MAX_W; w++)
+                sea_tile[c][h][w] = (data_t)(base[c] + (rand() % 17) - 8 - 128);
+    for (int i = 0; i < FC1_IN; i++) {
+        int v = rand() % 256 - 128;
+        fc1_in[i] = (data_t)(v < 0 ? 0 : v);
+    }
+}
+
+/* ---------------- Cases ---------------- */
+
+static void run_network() {
+    cnn_network(ship_tile, out, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w,
+                fc1_b, fc2_b, MAX_H, MAX_W);
+}
+
+static void run_network_int4() {
+    cnn_network_int4(ship_tile, out, conv1_w4, conv2_w4, conv3_w4, fc1_w4, fc2_w4, w4_scales,
+                     fc1_b, fc2_b, MAX_H, MAX_W);
+}
+
+static bool cascade_rejected;
+
+static void run_cascade_sea() {
+    cnn_network_cascade(sea_tile, out, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w, gate_w,
+                        fc1_b, fc2_b, gate_b, GATE_THRESHOLD_DEFAULT, &cascade_rejected,
+                        MAX_H, MAX_W);
+}
+
+static void run_fc1_dense() {
+    fc_layer<FC1_IN, FC1_OUT>(fc1_in, fc1_out, fc1_w, fc1_b, true);
+}
+
+static void run_fc1_skip_zero() {
+    fc_layer_skip_zero<FC1_IN, FC1_OUT>(fc1_in, fc1_out, fc1_w, fc1_b, true);
+}
+
+static void run_fc1_int4() {
+    fc_layer_int4<FC1_IN, FC1_OUT>(fc1_in, fc1_out, fc1_w4, w4_scales[3], fc1_b, true);
+}
+
+struct BenchCase {
+    const char *name;
+    void (*run)();
+    int rep_scale;   /* fast kernels get more samples */
+    long long macs;  /* nominal MACs per call, for misses per MAC */
+    long long weight_bytes, in_bytes, out_bytes;   /* compulsory traffic */
+};
+
+static BenchCase cases[] = {
+    { "cnn_network",      run_network,       1,  NETWORK_MACS,
+      NETWORK_WEIGHTS,  TILE_BYTES, FC2_OUT },
+    { "cnn_network_int4", run_network_int4,  1,  NETWORK_MACS,
+      NETWORK_WEIGHTS4, TILE_BYTES, FC2_OUT },
+    { "cascade_sea_tile", run_cascade_sea,   1,  0, 0, TILE_BYTES, FC2_OUT },   /* charge_cascade() */
+    { "fc1_dense",        run_fc1_dense,     20, FC1_MACS,
+      FC1_OUT * FC1_IN, FC1_IN, FC1_OUT },
+    { "fc1_skip_zero",    run_fc1_skip_zero, 20, FC1_MACS,
+      FC1_OUT * FC1_IN, FC1_IN, FC1_OUT },
+    { "fc1_int4",         run_fc1_int4,      20, FC1_MACS,
+      FC1_OUT * WPACK_LEN(FC1_IN), FC1_IN, FC1_OUT },
+};
+#define NUM_CASES ((int)(sizeof(cases) / sizeof(cases[0])))
+
+/* The cascade case is charged for the work that actually runs on its tile:
+ * CONV1 and the gate if the gate rejects it, the whole network as well if not */
+static void charge_cascade() {
+    for (int c = 0; c < NUM_CASES; c++) {
+        if (cases[c].run != run_cascade_sea) continue;
+        run_cascade_sea();
+        cases[c].macs = CONV1_MACS + (long long)GATE_OUT * GATE_IN;
+        cases[c].weight_bytes = CONV1_OUT_CH * CONV1_KSIZE + GATE_OUT * GATE_IN;
+        if (!cascade_rejected) {
+            cases[c].macs += NETWORK_MACS - CONV1_MACS;
+            cases[c].weight_bytes += NETWORK_WEIGHTS - CONV1_OUT_CH * CONV1_KSIZE;
+        }
+        printf("cascade_sea_tile: %s by the gate, charged %lld MACs\n\n",
+               cascade_rejected ? "rejected" : "accepted", cases[c].macs);
+    }
+}
+
+/* ---------------- Statistics ---------------- */
+
+struct BenchStats {
+    int samples;
+    double mean, stddev, p50, p90, p99, max;
+};
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/* Nearest-rank percentile of a sorted array */
+static double percentile(const double *sorted, int n, double p) {
+    int rank = (int)ceil(p / 100.0 * n);
+    if (rank < 1) rank = 1;
+    return sorted[rank - 1];
+}
+
+static BenchStats measure(void (*run)(), int warmup, int reps) {
+    double *t = (double *)malloc(reps * sizeof(double));
+    BenchStats s;
+
+    for (int i = 0; i < warmup; i++) run();
+    for (int i = 0; i < reps; i++) {
+        double t0 = now_ms();
+        run();
+        t[i] = now_ms() - t0;
+    }
+
+    double sum = 0.0, sq = 0.0;
+    for (int i = 0; i < reps; i++) sum += t[i];
+    s.mean = sum / reps;
+    for (int i = 0; i < reps; i++) sq += (t[i] - s.mean) * (t[i] - s.mean);
+    s.stddev = (reps > 1) ? sqrt(sq / (reps - 1)) : 0.0;
+
+    qsort(t, reps, sizeof(double), compare_double);
+    s.samples = reps;
+    s.p50 = percentile(t, reps, 50.0);
+    s.p90 = percentile(t, reps, 90.0);
+    s.p99 = percentile(t, reps, 99.0);
+    s.max = t[reps - 1];
+    free(t);
+    return s;
+}
+
+/* Counter totals over `reps` calls, after `warmup` uncounted calls */
+static bool measure_counters(PerfGroup &perf, void (*run)(), int warmup, int reps,
+                             PerfCounters &total) {
+    PerfCounters start;
+
+    for (int i = 0; i < warmup; i++) run();
+    if (!perf.read(start)) return false;
+    for (int i = 0; i < reps; i++) run();
+    if (!perf.read(total)) return false;
+    total -= start;
+    return true;
+}
+
+/* ---------------- Baseline files ---------------- */
+
+/* One "name p50_ms" line per case */
+static void save_baseline(const char *path, const BenchStats *stats, const bool *ran) {
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        fprintf(stderr, "cannot write baseline %s\n", path);
+        return;
+    }
+    for (int c = 0; c < NUM_CASES; c++)
+        if (ran[c]) fprintf(f, "%s %.6f\n", cases[c].name, stats[c].p50);
+    fclose(f);
+    printf("\nBaseline saved to %s\n", path);
+}
+
+/* Returns the number of regressions, or -1 if the baseline cannot be read
+ * or matches none of the cases that ran */
+static int compare_baseline(const char *path, const BenchStats *stats, const bool *ran, double tolerance) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot read baseline %s\n", path);
+        return -1;
+    }
+
+    char name[64];
+    double base;
+    int regressions = 0;
+    int matched = 0;
+    printf("\n=== BASELINE COMPARISON (%s, tolerance %.0f%%) ===\n", path, tolerance);
+    printf("%-20s %12s %12s %9s %s\n", "Case", "base p50", "now p50", "change", "status");
+    while (fscanf(f, "%63s %lf", name, &base) == 2) {
+        for (int c = 0; c < NUM_CASES; c++) {
+            if (!ran[c] || strcmp(name, cases[c].name) != 0) continue;
+            matched++;
+            double change = 100.0 * (stats[c].p50 - base) / base;
+            bool slower = change > tolerance;
+            if (slower) regressions++;
+            printf("%-20s %12.4f %12.4f %+8.1f%% %s\n", name, base, stats[c].p50, change,
+                   slower ? "REGRESSION" : (change < -tolerance ? "faster" : "ok"));
+        }
+    }
+    fclose(f);
+    if (matched == 0) {
+        fprintf(stderr, "baseline %s has no entry for the cases that ran\n", path);
+        return -1;
+    }
+    return regressions;
+}
+
+/* ---------------- Main ---------------- */
+
+int main(int argc, char **argv) {
+    int warmup = 3;
+    int reps = 30;
+    int cpu = -1;
+    const char *filter = NULL;
+    const char *save_path = NULL;
+    const char *baseline_path = NULL;
+    double tolerance = 10.0;
+    bool counters = false;
+    const char *roofline = NULL;
+    roofline_peaks_t peaks = roofline_pynq_peaks();
+
+    for (int i = 1; i < argc; i++) {
+        if (i + 1 < argc && strcmp(argv[i], "-w") == 0) warmup = atoi(argv[++i]);
+        else if (i + 1 < argc && strcmp(argv[i], "-n") == 0) reps = atoi(argv[++i]);
+        else if (i + 1 < argc && strcmp(argv[i], "-c") == 0) cpu = atoi(argv[++i]);
+        else if (i + 1 < argc && strcmp(argv[i], "-f") == 0) filter = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "-s") == 0) save_path = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "-b") == 0) baseline_path = argv[++i];
+        else if (i + 1 < argc && strcmp(argv[i], "-t") == 0) tolerance = atof(argv[++i]);
+        else if (strcmp(argv[i], "-p") == 0) counters = true;
+        else if (i + 1 < argc && strcmp(argv[i], "-r") == 0) roofline = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [-w warmup] [-n reps] [-c cpu] [-f filter] [-p] "
+                            "[-r host|pynq|peak_gops,peak_gbps[,int8_gops]] "
+                            "[-s save.txt] [-b baseline.txt] [-t tolerance_pct]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (reps < 1) reps = 1;
+
+    printf("=== INT8 NETWORK LATENCY STATISTICS (C-simulation) ===\n");
+    printf("Warmup %d, %d samples per case (x20 for single kernels)", warmup, reps);
+    if (cpu >= 0) printf(", CPU %d %s", cpu, pin_to_cpu(cpu) ? "pinned" : "(pinning failed)");
+    printf("\n\n");
+
+    if (roofline && !roofline_parse_peaks(roofline, &peaks)) {
+        fprintf(stderr, "-r expects host, pynq or peak_gops,peak_gbps[,int8_gops] (e.g. %.1f,%.1f,%.1f)\n",
+                ROOFLINE_PEAK_GOPS_PYNQ, ROOFLINE_PEAK_GBPS_PYNQ, ROOFLINE_PEAK_INT8_GOPS_PYNQ);
+        return 2;
+    }
+
+    load_model();
+    charge_cascade();
+
+    BenchStats stats[NUM_CASES];
+    bool ran[NUM_CASES];
+
+    printf("%-20s %7s %10s %10s %10s %10s %10s %10s %10s\n", "Case", "samples",
+           "mean ms", "stddev", "p50", "p90", "p99", "max", "calls/s");
+    for (int c = 0; c < NUM_CASES; c++) {
+        ran[c] = (filter == NULL) || strstr(cases[c].name, filter) != NULL;
+        if (!ran[c]) continue;
+
+        const BenchStats &s = stats[c] = measure(cases[c].run, warmup * cases[c].rep_scale,
+                                                 reps * cases[c].rep_scale);
+        printf("%-20s %7d %10.4f %10.4f %10.4f %10.4f %10.4f %10.4f %10.1f\n",
+               cases[c].name, s.samples, s.mean, s.stddev, s.p50, s.p90, s.p99, s.max,
+               1000.0 / s.mean);
+    }
+
+    if (counters) {
+        PerfGroup perf;
+        if (!perf.open()) {
+            printf("\nHardware counters unavailable (no PMU, or perf_event_paranoid > 2)\n");
+        } else {
+            printf("\n=== HARDWARE COUNTERS (user space, per call) ===\n");
+            printf("%-20s %12s %6s %12s %10s %10s %12s\n", "Case", "cycles", "IPC",
+                   "MACs", "L1D/MAC", "LLC/MAC", "br-miss");
+            for (int c = 0; c < NUM_CASES; c++) {
+                if (!ran[c]) continue;
+                int n = reps * cases[c].rep_scale;
+                PerfCounters t;
+                if (!measure_counters(perf, cases[c].run, warmup * cases[c].rep_scale, n, t))
+                    continue;
+                long long macs = cases[c].macs * n;
+                printf("%-20s %12llu %6.2f %12lld %10.5f %10.5f %12llu\n", cases[c].name,
+                       t.v[PERF_CYCLES] / n, t.ipc(), cases[c].macs,
+                       t.per_mac(PERF_L1D_MISSES, macs), t.per_mac(PERF_LLC_MISSES, macs),
+                       t.v[PERF_BRANCH_MISSES] / n);
+            }
+        }
+    }
+
+    if (roofline) {
+        roofline_layer_t layers[NUM_CASES];
+        int n = 0;
+        for (int c = 0; c < NUM_CASES; c++) {
+            if (!ran[c]) continue;
+            roofline_layer_t l = { cases[c].name, 2 * cases[c].macs, cases[c].weight_bytes,
+                                   cases[c].in_bytes, cases[c].out_bytes, stats[c].p50 };
+            layers[n++] = l;
+        }
+        roofline_print(stdout, "int8 cases at p50", layers, n, roofline_int8(peaks));
+    }
+
+    if (save_path) save_baseline(save_path, stats, ran);
+    if (baseline_path) {
+        int regressions = compare_baseline(baseline_path, stats, ran, tolerance);
+        if (regressions < 0) return 2;
+        if (regressions > 0) {
+            printf("\n%d regression(s) beyond %.0f%%\n", regressions, tolerance);
+            return 1;
+        }
+        printf("\nNo regressions beyond %.0f%%\n", tolerance);
+    }
+
+    return 0;
+}
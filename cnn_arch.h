@@ -0,0 +1,48 @@
+#ifndef CNN_ARCH_H
+#define CNN_ARCH_H
+
+// Plain-C layer geometry of the ship detector. Included by cnn_types.h;
+// C code (Benchmark/Benchmark.c) includes it directly.
+
+#define MAX_H 128
+#define MAX_W 128
+
+// Layer 1: CONV1 + ReLU (3->16 channels, 3x3 kernel)
+#define CONV1_IN_CH 3
+#define CONV1_OUT_CH 16
+#define CONV1_K 3
+
+// Layer 2: AvgPool (2x2, stride 2)
+#define POOL1_SIZE 2
+
+// Layer 3: CONV2 + ReLU (16->32 channels, 3x3 kernel)
+#define CONV2_IN_CH 16
+#define CONV2_OUT_CH 32
+#define CONV2_K 3
+
+// Layer 4: AvgPool (2x2, stride 2)
+#define POOL2_SIZE 2
+
+// Layer 5: CONV3 + ReLU (32->32 channels, 3x3 kernel, stride 2)
+#define CONV3_IN_CH 32
+#define CONV3_OUT_CH 32
+#define CONV3_K 3
+#define CONV3_STRIDE 2
+
+// Layer 6: MaxPool (2x2, stride 2)
+#define POOL3_SIZE 2
+
+// Layer 7: Flatten -> FC1 (1024->256)
+#define FC1_IN 1024
+#define FC1_OUT 256
+#define FC1_SPARSE_BLOCK 16   // Inputs per block in the block-sparse format
+#define FC1_SPARSE_MAX_BLOCKS 4096  // Block budget: 1/4 of FC1 (>= 75% pruned)
+
+// Layer 8: Dropout (keep for compatibility, p=0.5)
+// No-op in inference
+
+// Layer 9: FC2 (256->4)
+#define FC2_IN 256
+#define FC2_OUT 4
+
+#endif // CNN_ARCH_H
@@ -5,76 +5,291 @@
 #include "cnn_utils.h"
 
 // Conv layer with line buffer (for streaming)
-// Supports: 3x3 kernel, stride 1 or 2
-template<int IN_CH, int OUT_CH, int K, int STRIDE>
+// Supports: K x K kernel (K >= 2), any stride
+// The input stream is pixel-interleaved (row-major, IN_CH values per pixel)
+// and the output stream is too (OUT_CH values per output pixel). Every
+// input row is kept in the K-1 line buffers, but the window is only
+// shifted on rows that complete an output row, and the OUT_CH MAC loop
+// only runs at output positions. Those are tracked with counters (next
+// output row/column) rather than a modulo in the II=1 loop, so stride 2
+// runs the MAC loop on a quarter of the positions stride 1 does. For II=1
+// on the MAC loop, the caller partitions weights on dims 2-4.
+// Matches conv_layer_simple() for the same precision.
+
+#ifndef __SYNTHESIS__
+// MAC-loop counters of conv_layer_stream() (C simulation only)
+struct ConvStreamStats {
+    long long mac_iterations;   // iterations of the OUT_CH MAC loop
+    long long macs;
+};
+
+inline ConvStreamStats& conv_stream_stats() {
+    static ConvStreamStats s = { 0, 0 };
+    return s;
+}
+#endif
+
+template<int IN_CH, int OUT_CH, int K, int STRIDE, int IN_W = MAX_W,
+         typename P = default_precision>
 void conv_layer_stream(
-    hls::stream<data_t> &in,
-    hls::stream<data_t> &out,
-    weight_t weights[OUT_CH][IN_CH][K][K],
+    hls::stream<typename P::in_type> &in,
+    hls::stream<typename P::out_type> &out,
+    typename P::weight_type weights[OUT_CH][IN_CH][K][K],
     int H,
     int W
 ) {
-    // Line buffers for each input channel
-    data_t linebuf[IN_CH][K-1][MAX_W];
+    // Line buffers: linebuf[i] holds input row (row - K + 1 + i)
+    static typename P::in_type linebuf[K-1][IN_CH][IN_W];
 #pragma HLS ARRAY_PARTITION variable=linebuf complete dim=1
-#pragma HLS ARRAY_PARTITION variable=linebuf complete dim=2
-    
-    // Sliding window
-    data_t window[IN_CH][K][K];
+
+    // Sliding window, column K-1 is the newest
+    typename P::in_type window[K][K][IN_CH];
 #pragma HLS ARRAY_PARTITION variable=window complete dim=0
-    
-    int out_h = conv_out_size(H, K, STRIDE);
-    int out_w = conv_out_size(W, K, STRIDE);
-    
-    for (int ch = 0; ch < IN_CH; ch++) {
-        for (int row = 0; row < H; row++) {
-            for (int col = 0; col < W; col++) {
+
+    int next_row = K - 1;   // input row that completes the next output row
+    for (int row = 0; row < H; row++) {
+        bool out_row = (row == next_row);
+        if (out_row) next_row += STRIDE;
+
+        int next_col = K - 1;
+        for (int col = 0; col < W; col++) {
+            bool out_col = out_row && (col == next_col);
+            if (out_col) next_col += STRIDE;
+
+            for (int ic = 0; ic < IN_CH; ic++) {
 #pragma HLS PIPELINE II=1
-                
-                data_t pixel = in.read();
-                
+                typename P::in_type pixel = in.read();
+
+                if (out_row) {
+                    for (int i = 0; i < K; i++) {
+                        for (int j = 0; j < K-1; j++) {
+                            window[i][j][ic] = window[i][j+1][ic];
+                        }
+                    }
+                    for (int i = 0; i < K-1; i++) {
+                        window[i][K-1][ic] = linebuf[i][ic][col];
+                    }
+                    window[K-1][K-1][ic] = pixel;
+                }
+
                 // Shift line buffers
                 for (int i = 0; i < K-2; i++) {
-                    linebuf[ch][i][col] = linebuf[ch][i+1][col];
+                    linebuf[i][ic][col] = linebuf[i+1][ic][col];
                 }
-                if (K > 1) {
-                    linebuf[ch][K-2][col] = pixel;
+                linebuf[K-2][ic][col] = pixel;
+            }
+
+            if (out_col) {
+                for (int oc = 0; oc < OUT_CH; oc++) {
+#pragma HLS PIPELINE II=1
+                    typename P::acc_type sum = 0;
+
+                    for (int ic = 0; ic < IN_CH; ic++) {
+                        for (int i = 0; i < K; i++) {
+                            for (int j = 0; j < K; j++) {
+                                sum += window[i][j][ic] * weights[oc][ic][i][j];
+                            }
+                        }
+                    }
+
+#ifndef __SYNTHESIS__
+                    conv_stream_stats().mac_iterations++;
+                    conv_stream_stats().macs += IN_CH * K * K;
+#endif
+                    // ReLU activation
+                    out.write((typename P::out_type)relu(sum));
                 }
+            }
+        }
+    }
+}
+
+// Single-row conv for row-streaming (line buffer ring)
+// linebuf holds K input rows as a ring; row kh of the window sits in slot
+// (top + kh) % K. Computes one output row into slot out_slot of outbuf.
+template<int IN_CH, int OUT_CH, int K, int STRIDE, int IN_W, int OUT_ROWS, int OUT_W,
+         typename P = default_precision>
+void conv_layer_row(
+    typename P::in_type linebuf[IN_CH][K][IN_W],
+    typename P::out_type outbuf[OUT_CH][OUT_ROWS][OUT_W],
+    typename P::weight_type weights[OUT_CH][IN_CH][K][K],
+    int top,
+    int out_slot,
+    int W
+) {
+    int out_w = conv_out_size(W, K, STRIDE);
+
+    // Resolve ring slots once per row, not per pixel
+    int slot[K];
+#pragma HLS ARRAY_PARTITION variable=slot complete
+    for (int kh = 0; kh < K; kh++) {
+        slot[kh] = (top + kh) % K;
+    }
+
+    for (int oc = 0; oc < OUT_CH; oc++) {
+        for (int ow = 0; ow < out_w; ow++) {
+#pragma HLS PIPELINE II=1
+
+            typename P::acc_type sum = 0;
+
+            for (int ic = 0; ic < IN_CH; ic++) {
+                for (int kh = 0; kh < K; kh++) {
+                    for (int kw = 0; kw < K; kw++) {
+                        int iw = ow * STRIDE + kw;
+                        sum += linebuf[ic][slot[kh]][iw] * weights[oc][ic][kh][kw];
+                    }
+                }
+            }
+
+            outbuf[oc][out_slot][ow] = (typename P::out_type)relu(sum);
+        }
+    }
+}
+
+// Simplified Conv layer (buffer-based, easier to debug)
+// Buffer dimensions default to MAX_H x MAX_W; scene mode passes larger maps.
+// With DSP_PACK, each iteration computes two horizontally adjacent output
+// pixels, which share every weight, with one multiplier per MAC pair
+// (dsp_pack). Outputs are identical either way.
+template<int IN_CH, int OUT_CH, int K, int STRIDE,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename P = default_precision, bool DSP_PACK = CONV_DSP_PACK>
+void conv_layer_simple(
+    typename P::in_type input[IN_CH][IN_H][IN_W],
+    typename P::out_type output[OUT_CH][OUT_H][OUT_W],
+    typename P::weight_type weights[OUT_CH][IN_CH][K][K],
+    int H,
+    int W
+) {
+    typedef dsp_pack<typename P::in_type, typename P::weight_type> pack_t;
+    const int PIXELS = DSP_PACK ? 2 : 1;
+
+    int out_h = conv_out_size(H, K, STRIDE);
+    int out_w = conv_out_size(W, K, STRIDE);
+    
+    for (int oc = 0; oc < OUT_CH; oc++) {
+        for (int oh = 0; oh < out_h; oh++) {
+            for (int ow = 0; ow < out_w; ow += PIXELS) {
+#pragma HLS PIPELINE II=1
                 
-                // Check if we can compute convolution
-                bool valid_row = (STRIDE == 1) ? (row >= K-1) : ((row >= K-1) && ((row - K + 1) % STRIDE == 0));
-                bool valid_col = (STRIDE == 1) ? (col >= K-1) : ((col >= K-1) && ((col - K + 1) % STRIDE == 0));
-                
-                if (valid_row && valid_col) {
-                    // Fill window
-                    for (int i = 0; i < K-1; i++) {
-                        for (int j = 0; j < K; j++) {
-                            int offset = col - K + 1 + j;
-                            window[ch][i][j] = linebuf[ch][i][offset];
+                typename P::acc_type sum = 0;
+
+                if (DSP_PACK) {
+                    // Second pixel of the pair, if the row has one
+                    bool pair = (ow + 1 < out_w);
+                    typename P::acc_type sum_hi = 0;
+                    dsp_acc_t chain = 0;
+                    int n = 0;
+
+                    for (int ic = 0; ic < IN_CH; ic++) {
+                        for (int kh = 0; kh < K; kh++) {
+                            for (int kw = 0; kw < K; kw++) {
+                                int ih = oh * STRIDE + kh;
+                                int iw = ow * STRIDE + kw;
+                                typename P::in_type hi = pair ? input[ic][ih][iw + STRIDE]
+                                                              : (typename P::in_type)0;
+                                chain += weights[oc][ic][kh][kw] * pack_t::pack(hi, input[ic][ih][iw]);
+                                if (++n == pack_t::chain) {
+                                    pack_t::accumulate(chain, sum_hi, sum);
+                                    chain = 0;
+                                    n = 0;
+                                }
+                            }
                         }
                     }
-                    for (int j = 0; j < K; j++) {
-                        window[ch][K-1][j] = (j == K-1) ? pixel : linebuf[ch][K-2][col - K + 1 + j];
+                    pack_t::accumulate(chain, sum_hi, sum);
+
+                    if (pair) {
+                        output[oc][oh][ow + 1] = (typename P::out_type)relu(sum_hi);
+                    }
+                } else {
+                    for (int ic = 0; ic < IN_CH; ic++) {
+                        for (int kh = 0; kh < K; kh++) {
+                            for (int kw = 0; kw < K; kw++) {
+                                int ih = oh * STRIDE + kh;
+                                int iw = ow * STRIDE + kw;
+                                sum += input[ic][ih][iw] * weights[oc][ic][kh][kw];
+                            }
+                        }
+                    }
+                }
+                
+                output[oc][oh][ow] = (typename P::out_type)relu(sum);
+            }
+        }
+    }
+}
+
+// Loop-tiled conv layer
+// conv_layer_simple() walks the whole input map once per output channel.
+// Here the output is produced TILE_ROWS rows at a time: the input rows
+// that tile needs ((TILE_ROWS - 1) * STRIDE + K) are copied once into
+// in_tile, and each window read from it feeds TILE_OC output channels.
+// The full map is read once per row tile (plus the K - STRIDE halo rows)
+// instead of OUT_CH times, and in_tile OUT_CH / TILE_OC times.
+// Matches conv_layer_simple() for the same precision.
+template<int IN_CH, int OUT_CH, int K, int STRIDE, int TILE_ROWS, int TILE_OC,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename P = default_precision>
+void conv_layer_tiled(
+    typename P::in_type input[IN_CH][IN_H][IN_W],
+    typename P::out_type output[OUT_CH][OUT_H][OUT_W],
+    typename P::weight_type weights[OUT_CH][IN_CH][K][K],
+    int H,
+    int W
+) {
+    const int TILE_IN_ROWS = (TILE_ROWS - 1) * STRIDE + K;
+    static typename P::in_type in_tile[IN_CH][TILE_IN_ROWS][IN_W];
+    typename P::weight_type w_tile[IN_CH][K][K][TILE_OC];   // channel tile innermost
+#pragma HLS ARRAY_PARTITION variable=w_tile complete dim=4
+
+    int out_h = conv_out_size(H, K, STRIDE);
+    int out_w = conv_out_size(W, K, STRIDE);
+
+    for (int oh0 = 0; oh0 < out_h; oh0 += TILE_ROWS) {
+        int rows = (out_h - oh0 < TILE_ROWS) ? out_h - oh0 : TILE_ROWS;
+        int in_rows = (rows - 1) * STRIDE + K;
+
+        // Input rows of this tile, read once
+        for (int ic = 0; ic < IN_CH; ic++) {
+            for (int r = 0; r < in_rows; r++) {
+                for (int iw = 0; iw < W; iw++) {
+#pragma HLS PIPELINE II=1
+                    in_tile[ic][r][iw] = input[ic][oh0 * STRIDE + r][iw];
+                }
+            }
+        }
+
+        for (int oc0 = 0; oc0 < OUT_CH; oc0 += TILE_OC) {
+            // Kernels of this channel tile; channels past OUT_CH stay zero
+            for (int t = 0; t < TILE_OC; t++) {
+                for (int ic = 0; ic < IN_CH; ic++) {
+                    for (int kh = 0; kh < K; kh++) {
+                        for (int kw = 0; kw < K; kw++) {
+#pragma HLS PIPELINE II=1
+                            w_tile[ic][kh][kw][t] = (oc0 + t < OUT_CH)
+                                ? weights[oc0 + t][ic][kh][kw] : (typename P::weight_type)0;
+                        }
                     }
-                    
-                    // Process only when all channels are ready
-                    if (ch == IN_CH - 1) {
-                        // Compute all output channels
-                        for (int oc = 0; oc < OUT_CH; oc++) {
-#pragma HLS PIPELINE
-                            acc_t sum = 0;
-                            
-                            for (int ic = 0; ic < IN_CH; ic++) {
-                                for (int i = 0; i < K; i++) {
-                                    for (int j = 0; j < K; j++) {
-                                        sum += window[ic][i][j] * weights[oc][ic][i][j];
-                                    }
+                }
+            }
+
+            for (int r = 0; r < rows; r++) {
+                for (int ow = 0; ow < out_w; ow++) {
+#pragma HLS PIPELINE II=1
+                    // Every window value feeds all TILE_OC channels (the
+                    // unrolled reads of in_tile are shared across t)
+                    for (int t = 0; t < TILE_OC; t++) {
+                        typename P::acc_type sum = 0;
+                        for (int ic = 0; ic < IN_CH; ic++) {
+                            for (int kh = 0; kh < K; kh++) {
+                                for (int kw = 0; kw < K; kw++) {
+                                    sum += in_tile[ic][r * STRIDE + kh][ow * STRIDE + kw] * w_tile[ic][kh][kw][t];
                                 }
                             }
-                            
-                            // ReLU activation
-                            data_t result = relu(sum);
-                            out.write(result);
+                        }
+                        if (oc0 + t < OUT_CH) {
+                            output[oc0 + t][oh0 + r][ow] = (typename P::out_type)relu(sum);
                         }
                     }
                 }
@@ -83,25 +298,129 @@ void conv_layer_stream(
     }
 }
 
-// Simplified Conv layer (buffer-based, easier to debug)
-template<int IN_CH, int OUT_CH, int K, int STRIDE>
-void conv_layer_simple(
-    data_t input[IN_CH][MAX_H][MAX_W],
-    data_t output[OUT_CH][MAX_H][MAX_W],
-    weight_t weights[OUT_CH][IN_CH][K][K],
+// Conv layer on an on-chip weight ROM
+// Same arithmetic as conv_layer_simple(). The pipelined pixel loop reads
+// UNROLL input channels and their K x K kernels per cycle (UNROLL * K * K
+// MACs), so a pixel takes IN_CH / UNROLL cycles: II=1 when UNROLL == IN_CH.
+// This only holds if the caller partitions the arrays so every MAC of a
+// cycle has its own bank:
+//   weights: dim 2 cyclic UNROLL, dims 3-4 complete
+//   input:   dim 1 cyclic UNROLL, dims 2-3 cyclic K (any K consecutive
+//            rows/columns fall in distinct banks, for any stride)
+template<int IN_CH, int OUT_CH, int K, int STRIDE, int UNROLL,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename P = default_precision>
+void conv_layer_rom(
+    typename P::in_type input[IN_CH][IN_H][IN_W],
+    typename P::out_type output[OUT_CH][OUT_H][OUT_W],
+    const typename P::weight_type weights[OUT_CH][IN_CH][K][K],
     int H,
     int W
 ) {
     int out_h = conv_out_size(H, K, STRIDE);
     int out_w = conv_out_size(W, K, STRIDE);
-    
+
     for (int oc = 0; oc < OUT_CH; oc++) {
         for (int oh = 0; oh < out_h; oh++) {
             for (int ow = 0; ow < out_w; ow++) {
 #pragma HLS PIPELINE II=1
-                
-                acc_t sum = 0;
-                
+
+                typename P::acc_type sum = 0;
+
+                for (int ic0 = 0; ic0 < IN_CH; ic0 += UNROLL) {
+                    for (int u = 0; u < UNROLL; u++) {
+                        for (int kh = 0; kh < K; kh++) {
+                            for (int kw = 0; kw < K; kw++) {
+                                int ic = ic0 + u;
+                                int ih = oh * STRIDE + kh;
+                                int iw = ow * STRIDE + kw;
+                                sum += input[ic][ih][iw] * weights[oc][ic][kh][kw];
+                            }
+                        }
+                    }
+                }
+
+                output[oc][oh][ow] = (typename P::out_type)relu(sum);
+            }
+        }
+    }
+}
+
+// Conv layer on packed int4 weights
+// Each output channel's IN_CH x K x K kernel is one packed row in
+// (ic, kh, kw) order. Weights stay packed in memory; the current
+// channel's kernel is unpacked into registers once and reused for every
+// output pixel. Matches conv_layer_simple() with every weight multiplied by
+// the layer's scale.
+template<int IN_CH, int OUT_CH, int K, int STRIDE,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename P = int4_precision>
+void conv_layer_int4(
+    typename P::in_type input[IN_CH][IN_H][IN_W],
+    typename P::out_type output[OUT_CH][OUT_H][OUT_W],
+    wpack_t weights[OUT_CH][WPACK_LEN(IN_CH * K * K)],
+    wscale4_t scale,
+    int H,
+    int W
+) {
+    int out_h = conv_out_size(H, K, STRIDE);
+    int out_w = conv_out_size(W, K, STRIDE);
+
+    typename P::weight_type kernel[IN_CH][K][K];
+#pragma HLS ARRAY_PARTITION variable=kernel complete dim=0
+
+    for (int oc = 0; oc < OUT_CH; oc++) {
+        for (int ic = 0; ic < IN_CH; ic++) {
+            for (int kh = 0; kh < K; kh++) {
+                for (int kw = 0; kw < K; kw++) {
+                    kernel[ic][kh][kw] = weight4_at(weights[oc], (ic * K + kh) * K + kw);
+                }
+            }
+        }
+
+        for (int oh = 0; oh < out_h; oh++) {
+            for (int ow = 0; ow < out_w; ow++) {
+#pragma HLS PIPELINE II=1
+
+                typename P::acc_type sum = 0;
+
+                for (int ic = 0; ic < IN_CH; ic++) {
+                    for (int kh = 0; kh < K; kh++) {
+                        for (int kw = 0; kw < K; kw++) {
+                            int ih = oh * STRIDE + kh;
+                            int iw = ow * STRIDE + kw;
+                            sum += input[ic][ih][iw] * kernel[ic][kh][kw];
+                        }
+                    }
+                }
+
+                output[oc][oh][ow] = (typename P::out_type)relu((acc_t)sum * scale);
+            }
+        }
+    }
+}
+
+// Conv layer restricted to an output rectangle [oh0, oh1) x [ow0, ow1)
+// Outputs outside the rectangle are left untouched (delta inference).
+template<int IN_CH, int OUT_CH, int K, int STRIDE,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename P = default_precision>
+void conv_layer_rect(
+    typename P::in_type input[IN_CH][IN_H][IN_W],
+    typename P::out_type output[OUT_CH][OUT_H][OUT_W],
+    typename P::weight_type weights[OUT_CH][IN_CH][K][K],
+    int oh0,
+    int oh1,
+    int ow0,
+    int ow1
+) {
+    for (int oc = 0; oc < OUT_CH; oc++) {
+        for (int oh = oh0; oh < oh1; oh++) {
+            for (int ow = ow0; ow < ow1; ow++) {
+#pragma HLS PIPELINE II=1
+
+                typename P::acc_type sum = 0;
+
                 for (int ic = 0; ic < IN_CH; ic++) {
                     for (int kh = 0; kh < K; kh++) {
                         for (int kw = 0; kw < K; kw++) {
@@ -111,8 +430,8 @@ void conv_layer_simple(
                         }
                     }
                 }
-                
-                output[oc][oh][ow] = relu(sum);
+
+                output[oc][oh][ow] = (typename P::out_type)relu(sum);
             }
         }
     }
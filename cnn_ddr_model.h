@@ -0,0 +1,85 @@
+#ifndef CNN_DDR_MODEL_H
+#define CNN_DDR_MODEL_H
+
+// Transfer schedule model for tiled weight streaming (host only)
+// Replays the fetch/compute timeline of fc_layer_ddr() in cycles: tile t
+// can be fetched once tile t-1 has arrived and its buffer is free again
+// (tile t - buffers has been computed); it is computed once it has arrived
+// and tile t-1 is done. Used to check that double buffering hides the DDR
+// transfers, i.e. that the layer runs at the bus bandwidth.
+
+#include "cnn_types.h"
+
+struct DdrLink {
+    double clock_mhz;        // kernel / m_axi clock
+    int bus_bytes;           // m_axi data width
+    int burst_beats;         // beats per AXI burst
+    int burst_latency;       // cycles before the first beat of a burst
+};
+
+// Default: 64-bit m_axi at 100 MHz, 256-beat bursts, ~40-cycle DDR latency
+inline DdrLink ddr_link_default() {
+    DdrLink link = { 100.0, 8, 256, 40 };
+    return link;
+}
+
+struct DdrSchedule {
+    int tiles;
+    long long fetch_cycles;      // per tile
+    long long compute_cycles;    // per tile
+    long long total_cycles;
+    long long stall_cycles;      // compute idle, waiting for weights
+    double ms;
+    double gbps;                 // weight bytes / total time
+};
+
+// Cycles to burst-read `bytes` over the link
+inline long long ddr_fetch_cycles(const DdrLink& link, long long bytes) {
+    long long beats = (bytes + link.bus_bytes - 1) / link.bus_bytes;
+    long long bursts = (beats + link.burst_beats - 1) / link.burst_beats;
+    return beats + bursts * link.burst_latency;
+}
+
+inline DdrSchedule ddr_schedule(
+    const DdrLink& link,
+    int tiles,
+    long long tile_bytes,
+    long long compute_cycles,
+    int buffers
+) {
+    static const int MAX_TILES = 4096;
+    static long long fetch_end[MAX_TILES], compute_end[MAX_TILES];
+
+    DdrSchedule s;
+    s.tiles = tiles < MAX_TILES ? tiles : MAX_TILES;
+    s.fetch_cycles = ddr_fetch_cycles(link, tile_bytes);
+    s.compute_cycles = compute_cycles;
+
+    for (int t = 0; t < s.tiles; t++) {
+        long long fetch_start = (t > 0) ? fetch_end[t - 1] : 0;
+        if (t >= buffers && compute_end[t - buffers] > fetch_start) {
+            fetch_start = compute_end[t - buffers];   // buffer still in use
+        }
+        fetch_end[t] = fetch_start + s.fetch_cycles;
+
+        long long compute_start = fetch_end[t];
+        if (t > 0 && compute_end[t - 1] > compute_start) compute_start = compute_end[t - 1];
+        compute_end[t] = compute_start + compute_cycles;
+    }
+
+    s.total_cycles = s.tiles > 0 ? compute_end[s.tiles - 1] : 0;
+    s.stall_cycles = s.total_cycles - (long long)s.tiles * compute_cycles;
+    s.ms = s.total_cycles / (link.clock_mhz * 1e3);
+    s.gbps = s.total_cycles > 0
+        ? (double)s.tiles * tile_bytes * link.clock_mhz * 1e6 / s.total_cycles / 1e9 : 0.0;
+    return s;
+}
+
+// FC1 as implemented by fc_layer_ddr<FC1_IN, FC1_OUT, FC1_TILE_ROWS>
+inline DdrSchedule fc1_ddr_schedule(const DdrLink& link, int buffers) {
+    long long tile_bytes = (long long)FC1_TILE_ROWS * FC1_IN;
+    long long compute = (long long)FC1_TILE_ROWS * (FC1_IN / WWORD_WEIGHTS);
+    return ddr_schedule(link, FC1_OUT / FC1_TILE_ROWS, tile_bytes, compute, buffers);
+}
+
+#endif // CNN_DDR_MODEL_H
@@ -5,10 +5,10 @@
 #include "cnn_utils.h"
 
 // Flatten operation
-template<int CHANNELS, int H, int W>
+template<int CHANNELS, int H, int W, typename T = data_t>
 void flatten(
-    data_t input[CHANNELS][MAX_H][MAX_W],
-    data_t output[CHANNELS * H * W]
+    T input[CHANNELS][MAX_H][MAX_W],
+    T output[CHANNELS * H * W]
 ) {
     int idx = 0;
     for (int c = 0; c < CHANNELS; c++) {
@@ -21,40 +21,238 @@ void flatten(
     }
 }
 
+// FC output stage: ReLU clamp, or saturate to int8 for the final layer
+inline data_t fc_output(acc_t sum, bool apply_relu) {
+    if (apply_relu) {
+        return relu(sum);
+    }
+    if (sum > 127) sum = 127;
+    if (sum < -128) sum = -128;
+    return (data_t)sum;
+}
+
 // Fully Connected Layer
-template<int IN_FEATURES, int OUT_FEATURES>
+template<int IN_FEATURES, int OUT_FEATURES, typename P = default_precision>
 void fc_layer(
-    data_t input[IN_FEATURES],
-    data_t output[OUT_FEATURES],
-    weight_t weights[OUT_FEATURES][IN_FEATURES],
-    acc_t bias[OUT_FEATURES],
+    typename P::in_type input[IN_FEATURES],
+    typename P::out_type output[OUT_FEATURES],
+    typename P::weight_type weights[OUT_FEATURES][IN_FEATURES],
+    bias_t bias[OUT_FEATURES],
     bool apply_relu = true
 ) {
     for (int out = 0; out < OUT_FEATURES; out++) {
 #pragma HLS PIPELINE II=1
         
-        acc_t sum = bias[out];
+        typename P::acc_type sum = bias[out];
         
         for (int in = 0; in < IN_FEATURES; in++) {
             sum += input[in] * weights[out][in];
         }
         
-        if (apply_relu) {
-            output[out] = relu(sum);
+        output[out] = (typename P::out_type)fc_output(sum, apply_relu);
+    }
+}
+
+// Fully Connected Layer on packed int4 weights
+// Each byte holds two weights of a row; they are unpacked in the MAC loop.
+// The int4 partial sum is multiplied by the layer's scale before the bias,
+// so the output matches fc_layer() with weights[out][in] * scale.
+template<int IN_FEATURES, int OUT_FEATURES, typename P = int4_precision>
+void fc_layer_int4(
+    typename P::in_type input[IN_FEATURES],
+    typename P::out_type output[OUT_FEATURES],
+    wpack_t weights[OUT_FEATURES][WPACK_LEN(IN_FEATURES)],
+    wscale4_t scale,
+    bias_t bias[OUT_FEATURES],
+    bool apply_relu = true
+) {
+    for (int out = 0; out < OUT_FEATURES; out++) {
+#pragma HLS PIPELINE II=1
+
+        typename P::acc_type sum = 0;
+
+        // One packed byte (two MACs) per iteration
+        for (int b = 0; b < IN_FEATURES / 2; b++) {
+            wpack_t byte = weights[out][b];
+            sum += input[2 * b] * (typename P::weight_type)byte.range(3, 0);
+            sum += input[2 * b + 1] * (typename P::weight_type)byte.range(7, 4);
+        }
+        if (IN_FEATURES % 2) {
+            sum += input[IN_FEATURES - 1] * weight4_at(weights[out], IN_FEATURES - 1);
+        }
+
+        acc_t scaled = (acc_t)sum * scale;
+        output[out] = (typename P::out_type)fc_output(bias[out] + scaled, apply_relu);
+    }
+}
+
+// Fully Connected Layer with zero-activation skipping
+// After ReLU many inputs are exactly zero. The non-zero inputs are
+// compacted once, then each output only touches their weight columns.
+// Bit-exact with fc_layer(); pays off when most inputs are zero.
+template<int IN_FEATURES, int OUT_FEATURES, typename P = default_precision>
+void fc_layer_skip_zero(
+    typename P::in_type input[IN_FEATURES],
+    typename P::out_type output[OUT_FEATURES],
+    typename P::weight_type weights[OUT_FEATURES][IN_FEATURES],
+    bias_t bias[OUT_FEATURES],
+    bool apply_relu = true
+) {
+    int nz_index[IN_FEATURES];
+    typename P::in_type nz_value[IN_FEATURES];
+    int nnz = 0;
+
+    for (int in = 0; in < IN_FEATURES; in++) {
+#pragma HLS PIPELINE II=1
+        if (input[in] != 0) {
+            nz_index[nnz] = in;
+            nz_value[nnz] = input[in];
+            nnz++;
+        }
+    }
+
+    for (int out = 0; out < OUT_FEATURES; out++) {
+        typename P::acc_type sum = bias[out];
+
+        for (int k = 0; k < nnz; k++) {
+#pragma HLS PIPELINE II=1
+            sum += nz_value[k] * weights[out][nz_index[k]];
+        }
+
+        output[out] = (typename P::out_type)fc_output(sum, apply_relu);
+    }
+}
+
+// Block-sparse FC weights (block CSR)
+// Each output row keeps only its non-zero blocks of BLOCK consecutive
+// inputs: blocks row_ptr[out]..row_ptr[out+1]-1 hold their input block
+// index in col_block[] and their weights in values[]. Arrays hold at most
+// MAX_NNZ_BLOCKS blocks (the pruning budget, not the dense matrix); the
+// loaders refuse matrices that keep more. nnz_blocks says how many are in use.
+template<int OUT_FEATURES, int IN_FEATURES, int BLOCK, int MAX_NNZ_BLOCKS>
+struct fc_block_sparse {
+    static const int BLOCKS_PER_ROW = IN_FEATURES / BLOCK;
+
+    int nnz_blocks;
+    int row_ptr[OUT_FEATURES + 1];
+    int col_block[MAX_NNZ_BLOCKS];
+    weight_t values[MAX_NNZ_BLOCKS][BLOCK];
+};
+
+// Fully Connected Layer on block-sparse weights
+// Zero blocks are skipped entirely; results are bit-exact with fc_layer()
+// on the equivalent dense matrix.
+template<int IN_FEATURES, int OUT_FEATURES, int BLOCK, int MAX_NNZ_BLOCKS,
+         typename P = default_precision>
+void fc_layer_sparse(
+    typename P::in_type input[IN_FEATURES],
+    typename P::out_type output[OUT_FEATURES],
+    const fc_block_sparse<OUT_FEATURES, IN_FEATURES, BLOCK, MAX_NNZ_BLOCKS> &weights,
+    bias_t bias[OUT_FEATURES],
+    bool apply_relu = true
+) {
+    for (int out = 0; out < OUT_FEATURES; out++) {
+        typename P::acc_type sum = bias[out];
+
+        for (int b = weights.row_ptr[out]; b < weights.row_ptr[out + 1]; b++) {
+#pragma HLS PIPELINE II=1
+            int base = weights.col_block[b] * BLOCK;
+            for (int k = 0; k < BLOCK; k++) {
+#pragma HLS UNROLL
+                sum += input[base + k] * (typename P::weight_type)weights.values[b][k];
+            }
+        }
+
+        output[out] = (typename P::out_type)fc_output(sum, apply_relu);
+    }
+}
+
+// Fetch output rows [tile * TILE, (tile + 1) * TILE) of a DDR weight
+// matrix into an on-chip tile buffer: one burst of TILE * IN / 8 words
+template<int IN_FEATURES, int TILE>
+void fc_ddr_fetch(
+    const wword_t *weights,
+    weight_t buf[TILE][IN_FEATURES],
+    int tile
+) {
+    const int words = IN_FEATURES / WWORD_WEIGHTS;
+    const wword_t *src = weights + tile * TILE * words;
+    for (int r = 0; r < TILE; r++) {
+        for (int w = 0; w < words; w++) {
+#pragma HLS PIPELINE II=1
+            wword_t word = src[r * words + w];
+            for (int b = 0; b < WWORD_WEIGHTS; b++) {
+#pragma HLS UNROLL
+                buf[r][w * WWORD_WEIGHTS + b] = (weight_t)word.range(8 * b + 7, 8 * b);
+            }
+        }
+    }
+}
+
+// Outputs of one tile, WWORD_WEIGHTS MACs per cycle (matches the fetch rate)
+template<int IN_FEATURES, int TILE, typename P>
+void fc_ddr_compute(
+    typename P::in_type input[IN_FEATURES],
+    typename P::out_type output[],
+    weight_t buf[TILE][IN_FEATURES],
+    bias_t bias[],
+    int tile,
+    bool apply_relu
+) {
+    for (int r = 0; r < TILE; r++) {
+        int out = tile * TILE + r;
+        typename P::acc_type sum = bias[out];
+        for (int in = 0; in < IN_FEATURES; in += WWORD_WEIGHTS) {
+#pragma HLS PIPELINE II=1
+            for (int b = 0; b < WWORD_WEIGHTS; b++) {
+                sum += input[in + b] * buf[r][in + b];
+            }
+        }
+        output[out] = (typename P::out_type)fc_output(sum, apply_relu);
+    }
+}
+
+// Fully Connected Layer on weights streamed from external memory
+// The matrix stays in DDR as wword_t words (see FC1_TILE_ROWS). Tiles of
+// TILE output rows are double-buffered: while tile t is computed from one
+// buffer, tile t+1 is burst-read into the other. Fetch and compute both
+// move WWORD_WEIGHTS weights per cycle, so the layer runs at the m_axi
+// bandwidth with only the first fetch exposed (see cnn_ddr_model.h).
+// Bit-exact with fc_layer().
+template<int IN_FEATURES, int OUT_FEATURES, int TILE, typename P = default_precision>
+void fc_layer_ddr(
+    typename P::in_type input[IN_FEATURES],
+    typename P::out_type output[OUT_FEATURES],
+    const wword_t *weights,
+    bias_t bias[OUT_FEATURES],
+    bool apply_relu = true
+) {
+    static weight_t ping[TILE][IN_FEATURES];
+    static weight_t pong[TILE][IN_FEATURES];
+#pragma HLS ARRAY_PARTITION variable=ping cyclic factor=WWORD_WEIGHTS dim=2
+#pragma HLS ARRAY_PARTITION variable=pong cyclic factor=WWORD_WEIGHTS dim=2
+#pragma HLS ARRAY_PARTITION variable=input cyclic factor=WWORD_WEIGHTS
+
+    const int tiles = OUT_FEATURES / TILE;
+
+    fc_ddr_fetch<IN_FEATURES, TILE>(weights, ping, 0);
+    for (int t = 0; t < tiles; t++) {
+        // Distinct buffers in each branch let fetch and compute overlap
+        if (t % 2 == 0) {
+            if (t + 1 < tiles) fc_ddr_fetch<IN_FEATURES, TILE>(weights, pong, t + 1);
+            fc_ddr_compute<IN_FEATURES, TILE, P>(input, output, ping, bias, t, apply_relu);
         } else {
-            // For final layer, just clamp without ReLU
-            if (sum > 127) sum = 127;
-            if (sum < -128) sum = -128;
-            output[out] = (data_t)sum;
+            if (t + 1 < tiles) fc_ddr_fetch<IN_FEATURES, TILE>(weights, ping, t + 1);
+            fc_ddr_compute<IN_FEATURES, TILE, P>(input, output, pong, bias, t, apply_relu);
         }
     }
 }
 
 // Dropout layer (no-op during inference)
-template<int FEATURES>
+template<int FEATURES, typename T = data_t>
 void dropout(
-    data_t input[FEATURES],
-    data_t output[FEATURES]
+    T input[FEATURES],
+    T output[FEATURES]
 ) {
     for (int i = 0; i < FEATURES; i++) {
 #pragma HLS PIPELINE II=1
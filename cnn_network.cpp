@@ -3,58 +3,68 @@
 #include "cnn_conv.h"
 #include "cnn_pool.h"
 #include "cnn_fc.h"
+#include "cnn_profile.h"
 
-// Main CNN Network
-void cnn_network(
+// Layers 1-2: CONV1 + ReLU (3->16, 3x3), AvgPool (2x2)
+// Shared by cnn_network() and cnn_network_cascade().
+static void cnn_network_head(
     data_t input[CONV1_IN_CH][MAX_H][MAX_W],
-    data_t output[FC2_OUT],
-    
-    // Layer weights
+    act_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W],
     weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
-    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
-    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
-    weight_t fc1_weights[FC1_OUT][FC1_IN],
-    weight_t fc2_weights[FC2_OUT][FC2_IN],
-    
-    // Biases
-    acc_t fc1_bias[FC1_OUT],
-    acc_t fc2_bias[FC2_OUT],
-    
-    // Input dimensions
     int H,
     int W
 ) {
-#pragma HLS INTERFACE bram port=input
-#pragma HLS INTERFACE bram port=output
-#pragma HLS INTERFACE bram port=conv1_weights
-#pragma HLS INTERFACE bram port=conv2_weights
-#pragma HLS INTERFACE bram port=conv3_weights
-#pragma HLS INTERFACE bram port=fc1_weights
-#pragma HLS INTERFACE bram port=fc2_weights
-#pragma HLS INTERFACE bram port=fc1_bias
-#pragma HLS INTERFACE bram port=fc2_bias
-#pragma HLS INTERFACE s_axilite port=H
-#pragma HLS INTERFACE s_axilite port=W
-#pragma HLS INTERFACE s_axilite port=return
+    static act_t conv1_out[CONV1_OUT_CH][MAX_H][MAX_W];
 
-    // Intermediate feature maps
-    static data_t conv1_out[CONV1_OUT_CH][MAX_H][MAX_W];
-    static data_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
-    static data_t conv2_out[CONV2_OUT_CH][MAX_H][MAX_W];
-    static data_t pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
-    static data_t conv3_out[CONV3_OUT_CH][MAX_H][MAX_W];
-    static data_t pool3_out[CONV3_OUT_CH][MAX_H][MAX_W];
-    static data_t flattened[FC1_IN];
-    static data_t fc1_out[FC1_OUT];
-    static data_t dropout_out[FC1_OUT];
-    
-    // Calculate dimensions at each stage
     int h1 = conv_out_size(H, CONV1_K, 1);      // 128->126
     int w1 = conv_out_size(W, CONV1_K, 1);
+
+    // Layer 1: CONV1 + ReLU (3->16, 3x3)
+    {
+        CNN_PROFILE_LAYER("conv1", (long long)CONV1_OUT_CH * h1 * w1 * CONV1_IN_CH * CONV1_K * CONV1_K);
+        conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                          MAX_H, MAX_W, MAX_H, MAX_W, conv1_precision>(
+            input, conv1_out, conv1_weights, H, W
+        );
+    }
     
-    int h2 = pool_out_size(h1, POOL1_SIZE, POOL1_SIZE);  // 126->63
-    int w2 = pool_out_size(w1, POOL1_SIZE, POOL1_SIZE);
+    // Layer 2: AvgPool (2x2), 126->63 (the map size is only needed for the profile)
+    {
+#ifdef CNN_PROFILE
+        int h2 = pool_out_size(h1, POOL1_SIZE, POOL1_SIZE);
+        int w2 = pool_out_size(w1, POOL1_SIZE, POOL1_SIZE);
+#endif
+        CNN_PROFILE_LAYER("pool1", (long long)CONV1_OUT_CH * h2 * w2 * POOL1_SIZE * POOL1_SIZE);
+        avg_pool<CONV1_OUT_CH, POOL1_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+            conv1_out, pool1_out, h1, w1
+        );
+    }
+}
+
+// Layers 3-10: CONV2 .. FC2 on the h2 x w2 POOL1 map
+// Shared by cnn_network() and cnn_network_cascade().
+static void cnn_network_tail(
+    act_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int h2,
+    int w2
+) {
+    // Intermediate feature maps (post-ReLU, see the *_precision types)
+    static act_t conv2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static act_t pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static act_t conv3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t pool3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t flattened[FC1_IN];
+    static act_t fc1_out[FC1_OUT];
+    static act_t dropout_out[FC1_OUT];
     
+    // Calculate dimensions at each stage
     int h3 = conv_out_size(h2, CONV2_K, 1);      // 63->61
     int w3 = conv_out_size(w2, CONV2_K, 1);
     
@@ -64,53 +74,194 @@ void cnn_network(
     int h5 = conv_out_size(h4, CONV3_K, CONV3_STRIDE);   // 30->14
     int w5 = conv_out_size(w4, CONV3_K, CONV3_STRIDE);
     
-    int h6 = pool_out_size(h5, POOL3_SIZE, POOL3_SIZE);  // 14->7 (but diagram shows 8x4)
-    int w6 = pool_out_size(w5, POOL3_SIZE, POOL3_SIZE);
-    
-    // Layer 1: CONV1 + ReLU (3->16, 3x3)
-    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1>(
-        input, conv1_out, conv1_weights, H, W
-    );
-    
-    // Layer 2: AvgPool (2x2)
-    avg_pool<CONV1_OUT_CH, POOL1_SIZE>(
-        conv1_out, pool1_out, h1, w1
-    );
-    
     // Layer 3: CONV2 + ReLU (16->32, 3x3)
-    conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1>(
-        pool1_out, conv2_out, conv2_weights, h2, w2
-    );
+    {
+        CNN_PROFILE_LAYER("conv2", (long long)CONV2_OUT_CH * h3 * w3 * CONV2_IN_CH * CONV2_K * CONV2_K);
+        conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1,
+                          MAX_H, MAX_W, MAX_H, MAX_W, conv2_precision>(
+            pool1_out, conv2_out, conv2_weights, h2, w2
+        );
+    }
     
     // Layer 4: AvgPool (2x2)
-    avg_pool<CONV2_OUT_CH, POOL2_SIZE>(
-        conv2_out, pool2_out, h3, w3
-    );
+    {
+        CNN_PROFILE_LAYER("pool2", (long long)CONV2_OUT_CH * h4 * w4 * POOL2_SIZE * POOL2_SIZE);
+        avg_pool<CONV2_OUT_CH, POOL2_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+            conv2_out, pool2_out, h3, w3
+        );
+    }
     
     // Layer 5: CONV3 + ReLU (32->32, 3x3, stride 2)
-    conv_layer_simple<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE>(
-        pool2_out, conv3_out, conv3_weights, h4, w4
-    );
+    {
+        CNN_PROFILE_LAYER("conv3", (long long)CONV3_OUT_CH * h5 * w5 * CONV3_IN_CH * CONV3_K * CONV3_K);
+        conv_layer_simple<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE,
+                          MAX_H, MAX_W, MAX_H, MAX_W, conv3_precision>(
+            pool2_out, conv3_out, conv3_weights, h4, w4
+        );
+    }
     
-    // Layer 6: MaxPool (2x2)
-    max_pool<CONV3_OUT_CH, POOL3_SIZE>(
-        conv3_out, pool3_out, h5, w5
-    );
+    // Layer 6: MaxPool (2x2), 14->7 (but diagram shows 8x4)
+    {
+#ifdef CNN_PROFILE
+        int h6 = pool_out_size(h5, POOL3_SIZE, POOL3_SIZE);
+        int w6 = pool_out_size(w5, POOL3_SIZE, POOL3_SIZE);
+#endif
+        CNN_PROFILE_LAYER("pool3", (long long)CONV3_OUT_CH * h6 * w6 * POOL3_SIZE * POOL3_SIZE);
+        max_pool<CONV3_OUT_CH, POOL3_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+            conv3_out, pool3_out, h5, w5
+        );
+    }
     
     // Layer 7: Flatten
     // Note: The diagram shows 8x4x4=1024, adjust h6/w6 accordingly
-    flatten<CONV3_OUT_CH, 8, 4>(pool3_out, flattened);
+    {
+        CNN_PROFILE_LAYER("flatten", 0);
+        flatten<CONV3_OUT_CH, 8, 4, act_t>(pool3_out, flattened);
+    }
     
     // Layer 8: FC1 (1024->256) + ReLU
-    fc_layer<FC1_IN, FC1_OUT>(
-        flattened, fc1_out, fc1_weights, fc1_bias, true
-    );
+    {
+        CNN_PROFILE_LAYER("fc1", (long long)FC1_OUT * FC1_IN);
+        fc_layer<FC1_IN, FC1_OUT, fc1_precision>(
+            flattened, fc1_out, fc1_weights, fc1_bias, true
+        );
+    }
     
     // Layer 9: Dropout (no-op in inference)
-    dropout<FC1_OUT>(fc1_out, dropout_out);
+    {
+        CNN_PROFILE_LAYER("dropout", 0);
+        dropout<FC1_OUT, act_t>(fc1_out, dropout_out);
+    }
     
     // Layer 10: FC2 (256->4) - Output layer
-    fc_layer<FC2_IN, FC2_OUT>(
-        dropout_out, output, fc2_weights, fc2_bias, false
-    );
+    {
+        CNN_PROFILE_LAYER("fc2", (long long)FC2_OUT * FC2_IN);
+        fc_layer<FC2_IN, FC2_OUT, fc2_precision>(
+            dropout_out, output, fc2_weights, fc2_bias, false
+        );
+    }
+}
+
+// Main CNN Network
+void cnn_network(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    
+    // Layer weights
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    
+    // Input dimensions
+    int H,
+    int W
+) {
+#pragma HLS INTERFACE bram port=input
+#pragma HLS INTERFACE bram port=output
+#pragma HLS INTERFACE bram port=conv1_weights
+#pragma HLS INTERFACE bram port=conv2_weights
+#pragma HLS INTERFACE bram port=conv3_weights
+#pragma HLS INTERFACE bram port=fc1_weights
+#pragma HLS INTERFACE bram port=fc2_weights
+#pragma HLS INTERFACE bram port=fc1_bias
+#pragma HLS INTERFACE bram port=fc2_bias
+#pragma HLS INTERFACE s_axilite port=H
+#pragma HLS INTERFACE s_axilite port=W
+#pragma HLS INTERFACE s_axilite port=return
+
+    static act_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+
+    int h2 = pool_out_size(conv_out_size(H, CONV1_K, 1), POOL1_SIZE, POOL1_SIZE);
+    int w2 = pool_out_size(conv_out_size(W, CONV1_K, 1), POOL1_SIZE, POOL1_SIZE);
+
+    cnn_network_head(input, pool1_out, conv1_weights, H, W);
+    cnn_network_tail(pool1_out, output, conv2_weights, conv3_weights,
+                     fc1_weights, fc2_weights, fc1_bias, fc2_bias, h2, w2);
+}
+
+// CNN Network with early-exit cascade
+// Same as cnn_network(), but a lightweight gate (global average pool of
+// POOL1 + GATE_IN->1 FC) runs first. Tiles whose gate score is below
+// gate_threshold are rejected before CONV2: *rejected is set and all
+// outputs are -128. A threshold of -128 or lower never rejects.
+void cnn_network_cascade(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+
+    // Layer weights
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    weight_t gate_weights[GATE_OUT][GATE_IN],
+
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    bias_t gate_bias[GATE_OUT],
+
+    // Gate control
+    int gate_threshold,
+    bool *rejected,
+
+    // Input dimensions
+    int H,
+    int W
+) {
+#pragma HLS INTERFACE bram port=input
+#pragma HLS INTERFACE bram port=output
+#pragma HLS INTERFACE bram port=conv1_weights
+#pragma HLS INTERFACE bram port=conv2_weights
+#pragma HLS INTERFACE bram port=conv3_weights
+#pragma HLS INTERFACE bram port=fc1_weights
+#pragma HLS INTERFACE bram port=fc2_weights
+#pragma HLS INTERFACE bram port=gate_weights
+#pragma HLS INTERFACE bram port=fc1_bias
+#pragma HLS INTERFACE bram port=fc2_bias
+#pragma HLS INTERFACE bram port=gate_bias
+#pragma HLS INTERFACE s_axilite port=gate_threshold
+#pragma HLS INTERFACE s_axilite port=rejected
+#pragma HLS INTERFACE s_axilite port=H
+#pragma HLS INTERFACE s_axilite port=W
+#pragma HLS INTERFACE s_axilite port=return
+
+    static act_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static act_t gate_features[GATE_IN];
+    data_t gate_score[GATE_OUT];
+
+    int h2 = pool_out_size(conv_out_size(H, CONV1_K, 1), POOL1_SIZE, POOL1_SIZE);
+    int w2 = pool_out_size(conv_out_size(W, CONV1_K, 1), POOL1_SIZE, POOL1_SIZE);
+
+    // Stage 1: CONV1 + POOL1 (always runs)
+    cnn_network_head(input, pool1_out, conv1_weights, H, W);
+
+    // Gate: GAP + tiny FC on POOL1
+    {
+        CNN_PROFILE_LAYER("gate", (long long)CONV1_OUT_CH * h2 * w2 + GATE_OUT * GATE_IN);
+        global_avg_pool<GATE_IN, MAX_H, MAX_W, act_t>(pool1_out, gate_features, h2, w2);
+        fc_layer<GATE_IN, GATE_OUT, gate_precision>(
+            gate_features, gate_score, gate_weights, gate_bias, false
+        );
+    }
+
+    if (gate_score[0] < gate_threshold) {
+        *rejected = true;
+        for (int i = 0; i < FC2_OUT; i++) {
+#pragma HLS UNROLL
+            output[i] = -128;
+        }
+        return;
+    }
+    *rejected = false;
+
+    // Stage 2: rest of the network, shared with cnn_network()
+    cnn_network_tail(pool1_out, output, conv2_weights, conv3_weights,
+                     fc1_weights, fc2_weights, fc1_bias, fc2_bias, h2, w2);
 }
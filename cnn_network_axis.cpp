@@ -0,0 +1,168 @@
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "cnn_fc.h"
+
+// Compute core (cnn_network.cpp; its bram interface pragmas only apply
+// when it is the top function)
+void cnn_network(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+// On-chip copies of the model, filled from DDR by axis_load_weights()
+static weight_t conv1_w[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K];
+static weight_t conv2_w[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K];
+static weight_t conv3_w[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K];
+static weight_t fc1_w[FC1_OUT][FC1_IN];
+static weight_t fc2_w[FC2_OUT][FC2_IN];
+static bias_t fc1_b[FC1_OUT];
+static bias_t fc2_b[FC2_OUT];
+
+// Sequential reads of the weight blob (one burst per tensor), one
+// wword_t of WWORD_WEIGHTS weights per beat. Conv kernels are unpacked
+// with counters (a word can span kernels); FC rows reuse fc_ddr_fetch().
+template<int OUT_CH, int IN_CH, int K>
+void axis_burst_conv(
+    const wword_t *src,
+    weight_t dst[OUT_CH][IN_CH][K][K]
+) {
+    static_assert(OUT_CH * IN_CH * K * K % WWORD_WEIGHTS == 0, "conv tensor must fill whole words");
+    int oc = 0, ic = 0, kh = 0, kw = 0;
+    for (int w = 0; w < OUT_CH * IN_CH * K * K / WWORD_WEIGHTS; w++) {
+#pragma HLS PIPELINE II=1
+        wword_t word = src[w];
+        for (int b = 0; b < WWORD_WEIGHTS; b++) {
+            dst[oc][ic][kh][kw] = (weight_t)word.range(8 * b + 7, 8 * b);
+            if (++kw == K) {
+                kw = 0;
+                if (++kh == K) {
+                    kh = 0;
+                    if (++ic == IN_CH) {
+                        ic = 0;
+                        oc++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void axis_load_weights(const wword_t *weights, const bias_t *bias) {
+    int offset = 0;
+    axis_burst_conv<CONV1_OUT_CH, CONV1_IN_CH, CONV1_K>(weights + offset, conv1_w);
+    offset += CONV1_OUT_CH * CONV1_IN_CH * CONV1_K * CONV1_K / WWORD_WEIGHTS;
+    axis_burst_conv<CONV2_OUT_CH, CONV2_IN_CH, CONV2_K>(weights + offset, conv2_w);
+    offset += CONV2_OUT_CH * CONV2_IN_CH * CONV2_K * CONV2_K / WWORD_WEIGHTS;
+    axis_burst_conv<CONV3_OUT_CH, CONV3_IN_CH, CONV3_K>(weights + offset, conv3_w);
+    offset += CONV3_OUT_CH * CONV3_IN_CH * CONV3_K * CONV3_K / WWORD_WEIGHTS;
+    fc_ddr_fetch<FC1_IN, FC1_OUT>(weights + offset, fc1_w, 0);
+    offset += FC1_OUT * FC1_IN / WWORD_WEIGHTS;
+    fc_ddr_fetch<FC2_IN, FC2_OUT>(weights + offset, fc2_w, 0);
+
+    for (int i = 0; i < AXIS_BIAS_LEN; i++) {
+#pragma HLS PIPELINE II=1
+        if (i < FC1_OUT) fc1_b[i] = bias[i];
+        else fc2_b[i - FC1_OUT] = bias[i];
+    }
+}
+
+// Stream -> CHW frame. Pixels are interleaved (R,G,B per position), so
+// channel/column/row are tracked with counters instead of div/mod. The
+// AXIS_BYTES bytes of a beat span at most two adjacent columns (or the last
+// and first column of two rows), so with the channels split and the width
+// cyclic by AXIS_BYTES (see cnn_network_axis) they land in distinct banks.
+void axis_read_frame(
+    hls::stream<axis_word_t> &in,
+    data_t frame[CONV1_IN_CH][MAX_H][MAX_W]
+) {
+    int c = 0, x = 0, y = 0;
+    for (int beat = 0; beat < AXIS_FRAME_BEATS; beat++) {
+#pragma HLS PIPELINE II=1
+        axis_word_t word = in.read();
+        for (int b = 0; b < AXIS_BYTES; b++) {
+            ap_uint<8> pixel = word.data.range(8 * b + 7, 8 * b);
+            frame[c][y][x] = (data_t)((int)pixel - 128);
+            if (++c == CONV1_IN_CH) {
+                c = 0;
+                if (++x == MAX_W) {
+                    x = 0;
+                    y++;
+                }
+            }
+        }
+    }
+}
+
+void axis_write_scores(
+    data_t scores[FC2_OUT],
+    hls::stream<axis_word_t> &out
+) {
+    axis_word_t word;
+    word.data = 0;
+    for (int i = 0; i < FC2_OUT; i++) {
+#pragma HLS UNROLL
+        word.data.range(8 * i + 7, 8 * i) = (ap_uint<8>)scores[i];
+    }
+    word.keep = -1;
+    word.strb = -1;
+    word.user = 0;
+    word.id = 0;
+    word.dest = 0;
+    word.last = 1;
+    out.write(word);
+}
+
+// AXI4-Stream variant of cnn_network()
+// Frames stream in over `in` (see AXIS_* in cnn_types.h) and each one
+// answers with a single beat of scores on `out`. The frame loop is a
+// dataflow region: reading frame n+1 into the ping-pong frame buffer
+// overlaps the compute of frame n, so a DMA can push frames back-to-back.
+//
+// Weights live in DDR (m_axi, burst reads of AXIS_WEIGHT_WORDS words, see
+// pack_weight_words()) and are copied on chip only when load_weights is
+// set, normally on the first call after a model update; later calls reuse
+// them. Scores are bit-exact with cnn_network().
+void cnn_network_axis(
+    hls::stream<axis_word_t> &in,
+    hls::stream<axis_word_t> &out,
+    const wword_t *weights,
+    const bias_t *bias,
+    bool load_weights,
+    int frames
+) {
+#pragma HLS INTERFACE axis port=in
+#pragma HLS INTERFACE axis port=out
+#pragma HLS INTERFACE m_axi port=weights offset=slave bundle=gmem_w depth=AXIS_WEIGHT_WORDS max_read_burst_length=256
+#pragma HLS INTERFACE m_axi port=bias offset=slave bundle=gmem_w depth=AXIS_BIAS_LEN max_read_burst_length=256
+#pragma HLS INTERFACE s_axilite port=load_weights
+#pragma HLS INTERFACE s_axilite port=frames
+#pragma HLS INTERFACE s_axilite port=return
+#pragma HLS ARRAY_PARTITION variable=fc1_w cyclic factor=WWORD_WEIGHTS dim=2
+#pragma HLS ARRAY_PARTITION variable=fc2_w cyclic factor=WWORD_WEIGHTS dim=2
+
+    if (load_weights) {
+        axis_load_weights(weights, bias);
+    }
+
+    for (int f = 0; f < frames; f++) {
+#pragma HLS DATAFLOW
+        data_t frame[CONV1_IN_CH][MAX_H][MAX_W];
+#pragma HLS ARRAY_PARTITION variable=frame complete dim=1
+#pragma HLS ARRAY_PARTITION variable=frame cyclic factor=AXIS_BYTES dim=3
+        data_t scores[FC2_OUT];
+
+        axis_read_frame(in, frame);
+        cnn_network(frame, scores, conv1_w, conv2_w, conv3_w, fc1_w, fc2_w,
+                    fc1_b, fc2_b, MAX_H, MAX_W);
+        axis_write_scores(scores, out);
+    }
+}
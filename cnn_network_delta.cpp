@@ -0,0 +1,185 @@
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "cnn_conv.h"
+#include "cnn_pool.h"
+#include "cnn_fc.h"
+
+// Temporal delta CNN Network (repeat-pass / video frames)
+// Keeps the previous frame and every trunk feature map. Each call finds the
+// bounding box of pixels that changed since the previous frame, pushes it
+// through the receptive fields of CONV1..POOL3, and recomputes only those
+// rectangles; the rest of each map is reused. The FC head is re-run only if
+// something changed (it depends on the whole POOL3 map). Outputs are
+// bit-exact with cnn_network() on the same frame.
+//
+// reset forces a full recompute (first frame, new weights). A change of H/W
+// also triggers one. dirty_box returns the changed input region as
+// {y0, x0, y1, x1} (half-open; empty when y0 == y1).
+void cnn_network_delta(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+
+    // Layer weights
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+
+    // Input dimensions
+    int H,
+    int W,
+
+    // Delta control
+    bool reset,
+    int dirty_box[4]
+) {
+#pragma HLS INTERFACE bram port=input
+#pragma HLS INTERFACE bram port=output
+#pragma HLS INTERFACE bram port=conv1_weights
+#pragma HLS INTERFACE bram port=conv2_weights
+#pragma HLS INTERFACE bram port=conv3_weights
+#pragma HLS INTERFACE bram port=fc1_weights
+#pragma HLS INTERFACE bram port=fc2_weights
+#pragma HLS INTERFACE bram port=fc1_bias
+#pragma HLS INTERFACE bram port=fc2_bias
+#pragma HLS INTERFACE bram port=dirty_box
+#pragma HLS INTERFACE s_axilite port=H
+#pragma HLS INTERFACE s_axilite port=W
+#pragma HLS INTERFACE s_axilite port=reset
+#pragma HLS INTERFACE s_axilite port=return
+
+    // Previous frame and cached feature maps (post-ReLU maps are act_t,
+    // as in cnn_network())
+    static data_t prev_input[CONV1_IN_CH][MAX_H][MAX_W];
+    static act_t  conv1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static act_t  pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static act_t  conv2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static act_t  pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static act_t  conv3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t  pool3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t  flattened[FC1_IN];
+    static act_t  fc1_out[FC1_OUT];
+    static data_t prev_output[FC2_OUT];
+    static bool valid = false;
+    static int prev_H = 0;
+    static int prev_W = 0;
+
+    // Calculate dimensions at each stage
+    int h1 = conv_out_size(H, CONV1_K, 1);
+    int w1 = conv_out_size(W, CONV1_K, 1);
+    int h2 = pool_out_size(h1, POOL1_SIZE, POOL1_SIZE);
+    int w2 = pool_out_size(w1, POOL1_SIZE, POOL1_SIZE);
+    int h3 = conv_out_size(h2, CONV2_K, 1);
+    int w3 = conv_out_size(w2, CONV2_K, 1);
+    int h4 = pool_out_size(h3, POOL2_SIZE, POOL2_SIZE);
+    int w4 = pool_out_size(w3, POOL2_SIZE, POOL2_SIZE);
+    int h5 = conv_out_size(h4, CONV3_K, CONV3_STRIDE);
+    int w5 = conv_out_size(w4, CONV3_K, CONV3_STRIDE);
+    int h6 = pool_out_size(h5, POOL3_SIZE, POOL3_SIZE);
+    int w6 = pool_out_size(w5, POOL3_SIZE, POOL3_SIZE);
+
+    bool full = reset || !valid || H != prev_H || W != prev_W;
+
+    // Changed region of the input (and refresh the stored frame)
+    int y0 = H, x0 = W, y1 = 0, x1 = 0;
+    for (int c = 0; c < CONV1_IN_CH; c++) {
+        for (int h = 0; h < H; h++) {
+            for (int w = 0; w < W; w++) {
+#pragma HLS PIPELINE II=1
+                data_t pixel = input[c][h][w];
+                if (full || pixel != prev_input[c][h][w]) {
+                    if (h < y0) y0 = h;
+                    if (h + 1 > y1) y1 = h + 1;
+                    if (w < x0) x0 = w;
+                    if (w + 1 > x1) x1 = w + 1;
+                }
+                prev_input[c][h][w] = pixel;
+            }
+        }
+    }
+
+    if (y1 <= y0) {
+        // Nothing changed: replay the previous result
+        dirty_box[0] = dirty_box[2] = 0;
+        dirty_box[1] = dirty_box[3] = 0;
+        for (int i = 0; i < FC2_OUT; i++) {
+            output[i] = prev_output[i];
+        }
+        return;
+    }
+    dirty_box[0] = y0;
+    dirty_box[1] = x0;
+    dirty_box[2] = y1;
+    dirty_box[3] = x1;
+
+    // Dirty rectangle after each layer: [ya, yb) x [xa, xb)
+    int ya, yb, xa, xb;
+
+    // Layer 1: CONV1 + ReLU
+    conv_dirty_range(y0, y1, CONV1_K, 1, h1, &ya, &yb);
+    conv_dirty_range(x0, x1, CONV1_K, 1, w1, &xa, &xb);
+    conv_layer_rect<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                    MAX_H, MAX_W, MAX_H, MAX_W, conv1_precision>(
+        input, conv1_out, conv1_weights, ya, yb, xa, xb
+    );
+
+    // Layer 2: AvgPool
+    pool_dirty_range(ya, yb, POOL1_SIZE, h2, &ya, &yb);
+    pool_dirty_range(xa, xb, POOL1_SIZE, w2, &xa, &xb);
+    avg_pool_rect<CONV1_OUT_CH, POOL1_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv1_out, pool1_out, ya, yb, xa, xb
+    );
+
+    // Layer 3: CONV2 + ReLU
+    conv_dirty_range(ya, yb, CONV2_K, 1, h3, &ya, &yb);
+    conv_dirty_range(xa, xb, CONV2_K, 1, w3, &xa, &xb);
+    conv_layer_rect<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1,
+                    MAX_H, MAX_W, MAX_H, MAX_W, conv2_precision>(
+        pool1_out, conv2_out, conv2_weights, ya, yb, xa, xb
+    );
+
+    // Layer 4: AvgPool
+    pool_dirty_range(ya, yb, POOL2_SIZE, h4, &ya, &yb);
+    pool_dirty_range(xa, xb, POOL2_SIZE, w4, &xa, &xb);
+    avg_pool_rect<CONV2_OUT_CH, POOL2_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv2_out, pool2_out, ya, yb, xa, xb
+    );
+
+    // Layer 5: CONV3 + ReLU (stride 2)
+    conv_dirty_range(ya, yb, CONV3_K, CONV3_STRIDE, h5, &ya, &yb);
+    conv_dirty_range(xa, xb, CONV3_K, CONV3_STRIDE, w5, &xa, &xb);
+    conv_layer_rect<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE,
+                    MAX_H, MAX_W, MAX_H, MAX_W, conv3_precision>(
+        pool2_out, conv3_out, conv3_weights, ya, yb, xa, xb
+    );
+
+    // Layer 6: MaxPool
+    pool_dirty_range(ya, yb, POOL3_SIZE, h6, &ya, &yb);
+    pool_dirty_range(xa, xb, POOL3_SIZE, w6, &xa, &xb);
+    max_pool_rect<CONV3_OUT_CH, POOL3_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv3_out, pool3_out, ya, yb, xa, xb
+    );
+
+    // Layers 7-10: the head depends on all of POOL3, so re-run it whole
+    flatten<CONV3_OUT_CH, 8, 4, act_t>(pool3_out, flattened);
+    fc_layer<FC1_IN, FC1_OUT, fc1_precision>(
+        flattened, fc1_out, fc1_weights, fc1_bias, true
+    );
+
+    // Dropout is a no-op in inference
+    fc_layer<FC2_IN, FC2_OUT, fc2_precision>(
+        fc1_out, output, fc2_weights, fc2_bias, false
+    );
+
+    for (int i = 0; i < FC2_OUT; i++) {
+        prev_output[i] = output[i];
+    }
+    valid = true;
+    prev_H = H;
+    prev_W = W;
+}
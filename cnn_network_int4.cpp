@@ -0,0 +1,106 @@
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "cnn_conv.h"
+#include "cnn_pool.h"
+#include "cnn_fc.h"
+
+// CNN Network with int4 weights
+// Same dataflow as cnn_network(), but every weight tensor is packed two
+// weights per byte (half the BRAM and DDR traffic of the int8 model).
+// Nibbles are unpacked inside the conv/FC MAC loops and each layer's sum
+// is multiplied by its scale (w4_scales, in CONV1, CONV2, CONV3, FC1, FC2
+// order), so biases and activations stay on the int8 scale.
+// Conv kernels are one packed row per output channel in (ic, kh, kw) order.
+// Accumulator widths come from acc_bound (CONV1 runs on int16).
+void cnn_network_int4(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+
+    // Layer weights (packed int4)
+    wpack_t conv1_weights[CONV1_OUT_CH][WPACK_LEN(CONV1_IN_CH * CONV1_K * CONV1_K)],
+    wpack_t conv2_weights[CONV2_OUT_CH][WPACK_LEN(CONV2_IN_CH * CONV2_K * CONV2_K)],
+    wpack_t conv3_weights[CONV3_OUT_CH][WPACK_LEN(CONV3_IN_CH * CONV3_K * CONV3_K)],
+    wpack_t fc1_weights[FC1_OUT][WPACK_LEN(FC1_IN)],
+    wpack_t fc2_weights[FC2_OUT][WPACK_LEN(FC2_IN)],
+    wscale4_t w4_scales[INT4_LAYERS],
+
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+
+    // Input dimensions
+    int H,
+    int W
+) {
+#pragma HLS INTERFACE bram port=input
+#pragma HLS INTERFACE bram port=output
+#pragma HLS INTERFACE bram port=conv1_weights
+#pragma HLS INTERFACE bram port=conv2_weights
+#pragma HLS INTERFACE bram port=conv3_weights
+#pragma HLS INTERFACE bram port=fc1_weights
+#pragma HLS INTERFACE bram port=fc2_weights
+#pragma HLS INTERFACE bram port=w4_scales
+#pragma HLS INTERFACE bram port=fc1_bias
+#pragma HLS INTERFACE bram port=fc2_bias
+#pragma HLS INTERFACE s_axilite port=H
+#pragma HLS INTERFACE s_axilite port=W
+#pragma HLS INTERFACE s_axilite port=return
+
+    // Intermediate feature maps
+    static data_t conv1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t conv2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static data_t pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static data_t conv3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static data_t pool3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static data_t flattened[FC1_IN];
+    static data_t fc1_out[FC1_OUT];
+
+    // Calculate dimensions at each stage
+    int h1 = conv_out_size(H, CONV1_K, 1);
+    int w1 = conv_out_size(W, CONV1_K, 1);
+    int h2 = pool_out_size(h1, POOL1_SIZE, POOL1_SIZE);
+    int w2 = pool_out_size(w1, POOL1_SIZE, POOL1_SIZE);
+    int h3 = conv_out_size(h2, CONV2_K, 1);
+    int w3 = conv_out_size(w2, CONV2_K, 1);
+    int h4 = pool_out_size(h3, POOL2_SIZE, POOL2_SIZE);
+    int w4 = pool_out_size(w3, POOL2_SIZE, POOL2_SIZE);
+    int h5 = conv_out_size(h4, CONV3_K, CONV3_STRIDE);
+    int w5 = conv_out_size(w4, CONV3_K, CONV3_STRIDE);
+
+    // Layer 1: CONV1 + ReLU
+    conv_layer_int4<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                    MAX_H, MAX_W, MAX_H, MAX_W, conv1_int4_precision>(
+        input, conv1_out, conv1_weights, w4_scales[0], H, W
+    );
+
+    // Layer 2: AvgPool
+    avg_pool<CONV1_OUT_CH, POOL1_SIZE>(conv1_out, pool1_out, h1, w1);
+
+    // Layer 3: CONV2 + ReLU
+    conv_layer_int4<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1,
+                    MAX_H, MAX_W, MAX_H, MAX_W, conv2_int4_precision>(
+        pool1_out, conv2_out, conv2_weights, w4_scales[1], h2, w2
+    );
+
+    // Layer 4: AvgPool
+    avg_pool<CONV2_OUT_CH, POOL2_SIZE>(conv2_out, pool2_out, h3, w3);
+
+    // Layer 5: CONV3 + ReLU (stride 2)
+    conv_layer_int4<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE,
+                    MAX_H, MAX_W, MAX_H, MAX_W, conv3_int4_precision>(
+        pool2_out, conv3_out, conv3_weights, w4_scales[2], h4, w4
+    );
+
+    // Layer 6: MaxPool
+    max_pool<CONV3_OUT_CH, POOL3_SIZE>(conv3_out, pool3_out, h5, w5);
+
+    // Layers 7-10: Flatten, FC1 + ReLU, (dropout no-op), FC2
+    flatten<CONV3_OUT_CH, 8, 4>(pool3_out, flattened);
+    fc_layer_int4<FC1_IN, FC1_OUT, fc1_int4_precision>(
+        flattened, fc1_out, fc1_weights, w4_scales[3], fc1_bias, true
+    );
+    fc_layer_int4<FC2_IN, FC2_OUT, fc2_int4_precision>(
+        fc1_out, output, fc2_weights, w4_scales[4], fc2_bias, false
+    );
+}
@@ -0,0 +1,195 @@
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "cnn_conv.h"
+#include "cnn_pool.h"
+#include "cnn_fc.h"
+
+// Layer-group stages of cnn_network_pipeline()
+// Each stage owns its intermediate maps, so one instance of each can work
+// on a different frame at the same time. H and W are the stage's input
+// size. The host emulation in Benchmark/Benchmark_int8.cpp runs the same
+// functions on one thread per stage.
+
+// Stage 1: CONV1 + ReLU, AvgPool
+void pipe_stage_conv1(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    act_t output[CONV1_OUT_CH][MAX_H][MAX_W],
+    weight_t weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    int H,
+    int W
+) {
+    static act_t conv_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    int h1 = conv_out_size(H, CONV1_K, 1);
+    int w1 = conv_out_size(W, CONV1_K, 1);
+
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                      MAX_H, MAX_W, MAX_H, MAX_W, conv1_precision>(
+        input, conv_out, weights, H, W
+    );
+    avg_pool<CONV1_OUT_CH, POOL1_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv_out, output, h1, w1
+    );
+}
+
+// Stage 2: CONV2 + ReLU, AvgPool
+void pipe_stage_conv2(
+    act_t input[CONV2_IN_CH][MAX_H][MAX_W],
+    act_t output[CONV2_OUT_CH][MAX_H][MAX_W],
+    weight_t weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    int H,
+    int W
+) {
+    static act_t conv_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    int h3 = conv_out_size(H, CONV2_K, 1);
+    int w3 = conv_out_size(W, CONV2_K, 1);
+
+    conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1,
+                      MAX_H, MAX_W, MAX_H, MAX_W, conv2_precision>(
+        input, conv_out, weights, H, W
+    );
+    avg_pool<CONV2_OUT_CH, POOL2_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv_out, output, h3, w3
+    );
+}
+
+// Stage 3: CONV3 + ReLU (stride 2), MaxPool, Flatten
+void pipe_stage_conv3(
+    act_t input[CONV3_IN_CH][MAX_H][MAX_W],
+    act_t output[FC1_IN],
+    weight_t weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    int H,
+    int W
+) {
+    static act_t conv_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t pool_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    int h5 = conv_out_size(H, CONV3_K, CONV3_STRIDE);
+    int w5 = conv_out_size(W, CONV3_K, CONV3_STRIDE);
+
+    conv_layer_simple<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE,
+                      MAX_H, MAX_W, MAX_H, MAX_W, conv3_precision>(
+        input, conv_out, weights, H, W
+    );
+    max_pool<CONV3_OUT_CH, POOL3_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv_out, pool_out, h5, w5
+    );
+    flatten<CONV3_OUT_CH, 8, 4, act_t>(pool_out, output);
+}
+
+// Stage 4: FC1 + ReLU, (dropout no-op), FC2
+void pipe_stage_fc(
+    act_t input[FC1_IN],
+    data_t output[FC2_OUT],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT]
+) {
+    static act_t fc1_out[FC1_OUT];
+
+    fc_layer<FC1_IN, FC1_OUT, fc1_precision>(
+        input, fc1_out, fc1_weights, fc1_bias, true
+    );
+    fc_layer<FC2_IN, FC2_OUT, fc2_precision>(
+        fc1_out, output, fc2_weights, fc2_bias, false
+    );
+}
+
+void pipe_read_frame(
+    data_t frames[PIPE_MAX_FRAMES][CONV1_IN_CH][MAX_H][MAX_W],
+    int f,
+    data_t frame[CONV1_IN_CH][MAX_H][MAX_W]
+) {
+    for (int c = 0; c < CONV1_IN_CH; c++) {
+        for (int h = 0; h < MAX_H; h++) {
+            for (int w = 0; w < MAX_W; w++) {
+#pragma HLS PIPELINE II=1
+                frame[c][h][w] = frames[f][c][h][w];
+            }
+        }
+    }
+}
+
+void pipe_write_scores(
+    data_t scores[FC2_OUT],
+    int f,
+    data_t out[PIPE_MAX_FRAMES][FC2_OUT]
+) {
+    for (int i = 0; i < FC2_OUT; i++) {
+#pragma HLS PIPELINE II=1
+        out[f][i] = scores[i];
+    }
+}
+
+// Frame-pipelined variant of cnn_network()
+// The network is split into PIPE_STAGES layer groups (pipe_stage_*) and
+// the frame loop is a dataflow region: the arrays between stages become
+// ping-pong buffers, so while stage 4 runs FC1 on frame n, stage 1 is
+// already on CONV1 of frame n+3. Latency per frame is unchanged, but in
+// steady state a frame completes every max(stage) instead of sum(stages);
+// CONV2 is the slowest stage. Scores are bit-exact with cnn_network().
+void cnn_network_pipeline(
+    data_t frames[PIPE_MAX_FRAMES][CONV1_IN_CH][MAX_H][MAX_W],
+    data_t scores[PIPE_MAX_FRAMES][FC2_OUT],
+
+    // Layer weights
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+
+    // Frame count and input dimensions
+    int num_frames,
+    int H,
+    int W
+) {
+#pragma HLS INTERFACE m_axi port=frames offset=slave bundle=gmem_io max_read_burst_length=256
+#pragma HLS INTERFACE m_axi port=scores offset=slave bundle=gmem_io
+#pragma HLS INTERFACE bram port=conv1_weights
+#pragma HLS INTERFACE bram port=conv2_weights
+#pragma HLS INTERFACE bram port=conv3_weights
+#pragma HLS INTERFACE bram port=fc1_weights
+#pragma HLS INTERFACE bram port=fc2_weights
+#pragma HLS INTERFACE bram port=fc1_bias
+#pragma HLS INTERFACE bram port=fc2_bias
+#pragma HLS INTERFACE s_axilite port=num_frames
+#pragma HLS INTERFACE s_axilite port=H
+#pragma HLS INTERFACE s_axilite port=W
+#pragma HLS INTERFACE s_axilite port=return
+
+    int h2 = pool_out_size(conv_out_size(H, CONV1_K, 1), POOL1_SIZE, POOL1_SIZE);
+    int w2 = pool_out_size(conv_out_size(W, CONV1_K, 1), POOL1_SIZE, POOL1_SIZE);
+    int h4 = pool_out_size(conv_out_size(h2, CONV2_K, 1), POOL2_SIZE, POOL2_SIZE);
+    int w4 = pool_out_size(conv_out_size(w2, CONV2_K, 1), POOL2_SIZE, POOL2_SIZE);
+
+    if (num_frames > PIPE_MAX_FRAMES) num_frames = PIPE_MAX_FRAMES;
+
+    for (int f = 0; f < num_frames; f++) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=PIPE_MAX_FRAMES
+#pragma HLS DATAFLOW
+        // Stage-to-stage ping-pong buffers (static in C simulation only,
+        // to keep the feature maps off the stack)
+#ifndef __SYNTHESIS__
+        static data_t frame[CONV1_IN_CH][MAX_H][MAX_W];
+        static act_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+        static act_t pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+#else
+        data_t frame[CONV1_IN_CH][MAX_H][MAX_W];
+        act_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+        act_t pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+#endif
+        act_t flattened[FC1_IN];
+        data_t out[FC2_OUT];
+
+        pipe_read_frame(frames, f, frame);
+        pipe_stage_conv1(frame, pool1_out, conv1_weights, H, W);
+        pipe_stage_conv2(pool1_out, pool2_out, conv2_weights, h2, w2);
+        pipe_stage_conv3(pool2_out, flattened, conv3_weights, h4, w4);
+        pipe_stage_fc(flattened, out, fc1_weights, fc2_weights, fc1_bias, fc2_bias);
+        pipe_write_scores(out, f, scores);
+    }
+}
@@ -0,0 +1,138 @@
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "cnn_conv.h"
+#include "cnn_pool.h"
+#include "cnn_fc.h"
+#include "ship_conv_rom.h"   // Generated by tools/weights_to_rom.py
+
+// CNN Network with conv weights in on-chip ROMs
+// Same layers and precisions as cnn_network(), but the conv weights are
+// the CONVn_ROM constants (the embedded ship detector model) instead of
+// bram ports. Each ROM and each conv input map is partitioned to match
+// CONVn_MAC_UNROLL (see conv_layer_rom()), so the conv pixel loops reach
+// II = IN_CH / UNROLL. Scores are bit-exact with cnn_network() on the
+// embedded weights. Check the achieved II after C-synthesis with
+// tools/hls_ii_report.py.
+void cnn_network_rom(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+
+    // FC weights stay external (FC1 alone is 256 KB)
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+
+    // Input dimensions
+    int H,
+    int W
+) {
+#pragma HLS INTERFACE bram port=input
+#pragma HLS INTERFACE bram port=output
+#pragma HLS INTERFACE bram port=fc1_weights
+#pragma HLS INTERFACE bram port=fc2_weights
+#pragma HLS INTERFACE bram port=fc1_bias
+#pragma HLS INTERFACE bram port=fc2_bias
+#pragma HLS INTERFACE s_axilite port=H
+#pragma HLS INTERFACE s_axilite port=W
+#pragma HLS INTERFACE s_axilite port=return
+
+    // Weight ROMs: UNROLL input channels x K x K readable per cycle
+#pragma HLS ARRAY_PARTITION variable=CONV1_ROM cyclic factor=CONV1_MAC_UNROLL dim=2
+#pragma HLS ARRAY_PARTITION variable=CONV1_ROM complete dim=3
+#pragma HLS ARRAY_PARTITION variable=CONV1_ROM complete dim=4
+#pragma HLS ARRAY_PARTITION variable=CONV2_ROM cyclic factor=CONV2_MAC_UNROLL dim=2
+#pragma HLS ARRAY_PARTITION variable=CONV2_ROM complete dim=3
+#pragma HLS ARRAY_PARTITION variable=CONV2_ROM complete dim=4
+#pragma HLS ARRAY_PARTITION variable=CONV3_ROM cyclic factor=CONV3_MAC_UNROLL dim=2
+#pragma HLS ARRAY_PARTITION variable=CONV3_ROM complete dim=3
+#pragma HLS ARRAY_PARTITION variable=CONV3_ROM complete dim=4
+
+    // Conv inputs, banked the same way; the bram input port is copied into
+    // conv1_in so the host-facing interface stays a single port
+    static data_t conv1_in[CONV1_IN_CH][MAX_H][MAX_W];
+    static act_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static act_t pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+#pragma HLS ARRAY_PARTITION variable=conv1_in cyclic factor=CONV1_MAC_UNROLL dim=1
+#pragma HLS ARRAY_PARTITION variable=conv1_in cyclic factor=CONV1_K dim=2
+#pragma HLS ARRAY_PARTITION variable=conv1_in cyclic factor=CONV1_K dim=3
+#pragma HLS ARRAY_PARTITION variable=pool1_out cyclic factor=CONV2_MAC_UNROLL dim=1
+#pragma HLS ARRAY_PARTITION variable=pool1_out cyclic factor=CONV2_K dim=2
+#pragma HLS ARRAY_PARTITION variable=pool1_out cyclic factor=CONV2_K dim=3
+#pragma HLS ARRAY_PARTITION variable=pool2_out cyclic factor=CONV3_MAC_UNROLL dim=1
+#pragma HLS ARRAY_PARTITION variable=pool2_out cyclic factor=CONV3_K dim=2
+#pragma HLS ARRAY_PARTITION variable=pool2_out cyclic factor=CONV3_K dim=3
+
+    // Remaining feature maps (single reader/writer per cycle)
+    static act_t conv1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static act_t conv2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static act_t conv3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t pool3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t flattened[FC1_IN];
+    static act_t fc1_out[FC1_OUT];
+
+    // Calculate dimensions at each stage
+    int h1 = conv_out_size(H, CONV1_K, 1);
+    int w1 = conv_out_size(W, CONV1_K, 1);
+    int h2 = pool_out_size(h1, POOL1_SIZE, POOL1_SIZE);
+    int w2 = pool_out_size(w1, POOL1_SIZE, POOL1_SIZE);
+    int h3 = conv_out_size(h2, CONV2_K, 1);
+    int w3 = conv_out_size(w2, CONV2_K, 1);
+    int h4 = pool_out_size(h3, POOL2_SIZE, POOL2_SIZE);
+    int w4 = pool_out_size(w3, POOL2_SIZE, POOL2_SIZE);
+    int h5 = conv_out_size(h4, CONV3_K, CONV3_STRIDE);
+    int w5 = conv_out_size(w4, CONV3_K, CONV3_STRIDE);
+
+    for (int c = 0; c < CONV1_IN_CH; c++) {
+        for (int h = 0; h < H; h++) {
+            for (int w = 0; w < W; w++) {
+#pragma HLS PIPELINE II=1
+                conv1_in[c][h][w] = input[c][h][w];
+            }
+        }
+    }
+
+    // Layer 1: CONV1 + ReLU
+    conv_layer_rom<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1, CONV1_MAC_UNROLL,
+                   MAX_H, MAX_W, MAX_H, MAX_W, conv1_precision>(
+        conv1_in, conv1_out, CONV1_ROM, H, W
+    );
+
+    // Layer 2: AvgPool
+    avg_pool<CONV1_OUT_CH, POOL1_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv1_out, pool1_out, h1, w1
+    );
+
+    // Layer 3: CONV2 + ReLU
+    conv_layer_rom<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1, CONV2_MAC_UNROLL,
+                   MAX_H, MAX_W, MAX_H, MAX_W, conv2_precision>(
+        pool1_out, conv2_out, CONV2_ROM, h2, w2
+    );
+
+    // Layer 4: AvgPool
+    avg_pool<CONV2_OUT_CH, POOL2_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv2_out, pool2_out, h3, w3
+    );
+
+    // Layer 5: CONV3 + ReLU (stride 2)
+    conv_layer_rom<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE, CONV3_MAC_UNROLL,
+                   MAX_H, MAX_W, MAX_H, MAX_W, conv3_precision>(
+        pool2_out, conv3_out, CONV3_ROM, h4, w4
+    );
+
+    // Layer 6: MaxPool
+    max_pool<CONV3_OUT_CH, POOL3_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv3_out, pool3_out, h5, w5
+    );
+
+    // Layers 7-10: Flatten, FC1 + ReLU, (dropout no-op), FC2
+    flatten<CONV3_OUT_CH, 8, 4, act_t>(pool3_out, flattened);
+    fc_layer<FC1_IN, FC1_OUT, fc1_precision>(
+        flattened, fc1_out, fc1_weights, fc1_bias, true
+    );
+    fc_layer<FC2_IN, FC2_OUT, fc2_precision>(
+        fc1_out, output, fc2_weights, fc2_bias, false
+    );
+}
@@ -0,0 +1,137 @@
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "cnn_pool.h"
+#include "cnn_fc.h"
+#include "cnn_systolic.h"
+
+// Input banks for CONV3's activation fill (SA_COLS pixels STRIDE apart)
+#define SA_CONV3_BANKS (SA_COLS * CONV3_STRIDE)
+
+// CNN Network on a single systolic MAC array
+// Same layers and precisions as cnn_network(), but every conv and FC layer
+// runs on the one SA_ROWS x SA_COLS systolic_engine() (cnn_systolic.h)
+// instead of its own loop nest. Layers execute one after another anyway,
+// so sharing the array keeps SA_ROWS * SA_COLS DSPs busy for the whole
+// frame. Resize the array with SA_ROWS / SA_COLS in cnn_types.h. Scores
+// are bit-exact with cnn_network().
+void cnn_network_systolic(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+
+    // Layer weights
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+
+    // Input dimensions
+    int H,
+    int W
+) {
+#pragma HLS INTERFACE bram port=input
+#pragma HLS INTERFACE bram port=output
+#pragma HLS INTERFACE bram port=conv1_weights
+#pragma HLS INTERFACE bram port=conv2_weights
+#pragma HLS INTERFACE bram port=conv3_weights
+#pragma HLS INTERFACE bram port=fc1_weights
+#pragma HLS INTERFACE bram port=fc2_weights
+#pragma HLS INTERFACE bram port=fc1_bias
+#pragma HLS INTERFACE bram port=fc2_bias
+#pragma HLS INTERFACE s_axilite port=H
+#pragma HLS INTERFACE s_axilite port=W
+#pragma HLS INTERFACE s_axilite port=return
+#pragma HLS ALLOCATION instances=systolic_engine limit=1 function
+
+    // Operand tiles and accumulators of the shared array; the two
+    // activation tiles are separate memories so fill and engine overlap
+    static SystolicTiles tiles;
+#pragma HLS ARRAY_PARTITION variable=tiles.a complete dim=1
+#pragma HLS ARRAY_PARTITION variable=tiles.a complete dim=3
+
+    // Intermediate feature maps
+    static act_t conv1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static act_t pool1_out[CONV1_OUT_CH][MAX_H][MAX_W];
+    static act_t conv2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static act_t pool2_out[CONV2_OUT_CH][MAX_H][MAX_W];
+    static act_t conv3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t pool3_out[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t flattened[FC1_IN];
+    static act_t fc1_out[FC1_OUT];
+
+    // Banking for conv_layer_systolic()/fc_layer_systolic(): SA_ROWS weight
+    // rows and output channels, SA_COLS activations STRIDE apart per cycle
+#pragma HLS ARRAY_PARTITION variable=input cyclic factor=SA_COLS dim=3
+#pragma HLS ARRAY_PARTITION variable=pool1_out cyclic factor=SA_COLS dim=3
+#pragma HLS ARRAY_PARTITION variable=pool2_out cyclic factor=SA_CONV3_BANKS dim=3
+#pragma HLS ARRAY_PARTITION variable=conv1_out cyclic factor=SA_ROWS dim=1
+#pragma HLS ARRAY_PARTITION variable=conv2_out cyclic factor=SA_ROWS dim=1
+#pragma HLS ARRAY_PARTITION variable=conv3_out cyclic factor=SA_ROWS dim=1
+#pragma HLS ARRAY_PARTITION variable=conv1_weights cyclic factor=SA_ROWS dim=1
+#pragma HLS ARRAY_PARTITION variable=conv2_weights cyclic factor=SA_ROWS dim=1
+#pragma HLS ARRAY_PARTITION variable=conv3_weights cyclic factor=SA_ROWS dim=1
+#pragma HLS ARRAY_PARTITION variable=fc1_weights cyclic factor=SA_ROWS dim=1
+#pragma HLS ARRAY_PARTITION variable=fc2_weights cyclic factor=SA_ROWS dim=1
+
+    // Calculate dimensions at each stage
+    int h1 = conv_out_size(H, CONV1_K, 1);
+    int w1 = conv_out_size(W, CONV1_K, 1);
+    int h2 = pool_out_size(h1, POOL1_SIZE, POOL1_SIZE);
+    int w2 = pool_out_size(w1, POOL1_SIZE, POOL1_SIZE);
+    int h3 = conv_out_size(h2, CONV2_K, 1);
+    int w3 = conv_out_size(w2, CONV2_K, 1);
+    int h4 = pool_out_size(h3, POOL2_SIZE, POOL2_SIZE);
+    int w4 = pool_out_size(w3, POOL2_SIZE, POOL2_SIZE);
+    int h5 = conv_out_size(h4, CONV3_K, CONV3_STRIDE);
+    int w5 = conv_out_size(w4, CONV3_K, CONV3_STRIDE);
+
+    // Layer 1: CONV1 + ReLU
+    conv_layer_systolic<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                        MAX_H, MAX_W, MAX_H, MAX_W, conv1_precision>(
+        tiles, input, conv1_out, conv1_weights, H, W
+    );
+
+    // Layer 2: AvgPool
+    avg_pool<CONV1_OUT_CH, POOL1_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv1_out, pool1_out, h1, w1
+    );
+
+    // Layer 3: CONV2 + ReLU
+    conv_layer_systolic<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1,
+                        MAX_H, MAX_W, MAX_H, MAX_W, conv2_precision>(
+        tiles, pool1_out, conv2_out, conv2_weights, h2, w2
+    );
+
+    // Layer 4: AvgPool
+    avg_pool<CONV2_OUT_CH, POOL2_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv2_out, pool2_out, h3, w3
+    );
+
+    // Layer 5: CONV3 + ReLU (stride 2)
+    conv_layer_systolic<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE,
+                        MAX_H, MAX_W, MAX_H, MAX_W, conv3_precision>(
+        tiles, pool2_out, conv3_out, conv3_weights, h4, w4
+    );
+
+    // Layer 6: MaxPool
+    max_pool<CONV3_OUT_CH, POOL3_SIZE, MAX_H, MAX_W, MAX_H, MAX_W, act_t>(
+        conv3_out, pool3_out, h5, w5
+    );
+
+    // Layer 7: Flatten
+    flatten<CONV3_OUT_CH, 8, 4, act_t>(pool3_out, flattened);
+
+    // Layer 8: FC1 + ReLU
+    fc_layer_systolic<FC1_IN, FC1_OUT, fc1_precision>(
+        tiles, flattened, fc1_out, fc1_weights, fc1_bias, true
+    );
+
+    // Layers 9-10: (dropout no-op), FC2
+    fc_layer_systolic<FC2_IN, FC2_OUT, fc2_precision>(
+        tiles, fc1_out, output, fc2_weights, fc2_bias, false
+    );
+}
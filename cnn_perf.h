@@ -0,0 +1,140 @@
+#ifndef CNN_PERF_H
+#define CNN_PERF_H
+
+// Hardware performance counters for C-simulation (not synthesizable)
+// Linux perf_event_open group of cycles, instructions, L1D read misses,
+// LLC misses and branch misses, counted in user space for this thread.
+// open() fails gracefully (no PMU, perf_event_paranoid > 2, non-Linux);
+// callers then report wall time only.
+//
+//   PerfGroup perf;
+//   PerfCounters a, b;
+//   if (perf.open()) { perf.read(a); kernel(); perf.read(b); b -= a; }
+
+#include <string.h>
+
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+enum {
+    PERF_CYCLES = 0,
+    PERF_INSTRUCTIONS,
+    PERF_L1D_MISSES,
+    PERF_LLC_MISSES,
+    PERF_BRANCH_MISSES,
+    PERF_NUM_COUNTERS
+};
+
+struct PerfCounters {
+    unsigned long long v[PERF_NUM_COUNTERS];
+
+    PerfCounters() { memset(v, 0, sizeof(v)); }
+
+    PerfCounters& operator+=(const PerfCounters& o) {
+        for (int i = 0; i < PERF_NUM_COUNTERS; i++) v[i] += o.v[i];
+        return *this;
+    }
+    PerfCounters& operator-=(const PerfCounters& o) {
+        for (int i = 0; i < PERF_NUM_COUNTERS; i++) v[i] -= o.v[i];
+        return *this;
+    }
+
+    double ipc() const {
+        return v[PERF_CYCLES] ? (double)v[PERF_INSTRUCTIONS] / v[PERF_CYCLES] : 0.0;
+    }
+    double per_mac(int counter, long long macs) const {
+        return macs > 0 ? (double)v[counter] / macs : 0.0;
+    }
+};
+
+class PerfGroup {
+private:
+    int fd[PERF_NUM_COUNTERS];
+    int opened;   // counters successfully added to the group
+
+#ifdef __linux__
+    static int open_counter(unsigned type, unsigned long long config, int group_fd) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = (group_fd == -1);   // leader starts the group
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return (int)syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0);
+    }
+#endif
+
+public:
+    PerfGroup() : opened(0) {
+        for (int i = 0; i < PERF_NUM_COUNTERS; i++) fd[i] = -1;
+    }
+
+    ~PerfGroup() { close(); }
+
+    // Opens and enables the group; false if any counter is unavailable
+    bool open() {
+#ifdef __linux__
+        if (opened == PERF_NUM_COUNTERS) return true;
+        static const unsigned type[PERF_NUM_COUNTERS] = {
+            PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE,
+            PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE
+        };
+        static const unsigned long long config[PERF_NUM_COUNTERS] = {
+            PERF_COUNT_HW_CPU_CYCLES,
+            PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                (PERF_COUNT_HW_CACHE_RESULT_MISS << 16),
+            PERF_COUNT_HW_CACHE_MISSES,
+            PERF_COUNT_HW_BRANCH_MISSES
+        };
+        for (int i = 0; i < PERF_NUM_COUNTERS; i++) {
+            fd[i] = open_counter(type[i], config[i], i == 0 ? -1 : fd[0]);
+            if (fd[i] < 0) {
+                close();
+                return false;
+            }
+            opened++;
+        }
+        ioctl(fd[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fd[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void close() {
+#ifdef __linux__
+        for (int i = 0; i < PERF_NUM_COUNTERS; i++) {
+            if (fd[i] >= 0) ::close(fd[i]);
+            fd[i] = -1;
+        }
+#endif
+        opened = 0;
+    }
+
+    bool available() const { return opened == PERF_NUM_COUNTERS; }
+
+    // Snapshot of the running totals; subtract two snapshots for a delta
+    bool read(PerfCounters& out) const {
+#ifdef __linux__
+        if (!available()) return false;
+        unsigned long long buf[1 + PERF_NUM_COUNTERS];
+        if (::read(fd[0], buf, sizeof(buf)) != (ssize_t)sizeof(buf)) return false;
+        for (int i = 0; i < PERF_NUM_COUNTERS; i++) out.v[i] = buf[1 + i];
+        return true;
+#else
+        (void)out;
+        return false;
+#endif
+    }
+};
+
+#endif // CNN_PERF_H
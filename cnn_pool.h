@@ -4,10 +4,12 @@
 #include "cnn_types.h"
 
 // Average Pooling (2x2, stride 2)
-template<int CHANNELS, int POOL_SIZE>
+template<int CHANNELS, int POOL_SIZE,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename T = data_t>
 void avg_pool(
-    data_t input[CHANNELS][MAX_H][MAX_W],
-    data_t output[CHANNELS][MAX_H][MAX_W],
+    T input[CHANNELS][IN_H][IN_W],
+    T output[CHANNELS][OUT_H][OUT_W],
     int H,
     int W
 ) {
@@ -30,17 +32,19 @@ void avg_pool(
                 }
                 
                 // Average (divide by pool_size^2)
-                output[c][oh][ow] = (data_t)(sum / (POOL_SIZE * POOL_SIZE));
+                output[c][oh][ow] = (T)(sum / (POOL_SIZE * POOL_SIZE));
             }
         }
     }
 }
 
 // Max Pooling (2x2, stride 2)
-template<int CHANNELS, int POOL_SIZE>
+template<int CHANNELS, int POOL_SIZE,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename T = data_t>
 void max_pool(
-    data_t input[CHANNELS][MAX_H][MAX_W],
-    data_t output[CHANNELS][MAX_H][MAX_W],
+    T input[CHANNELS][IN_H][IN_W],
+    T output[CHANNELS][OUT_H][OUT_W],
     int H,
     int W
 ) {
@@ -52,13 +56,13 @@ void max_pool(
             for (int ow = 0; ow < out_w; ow++) {
 #pragma HLS PIPELINE II=1
                 
-                data_t max_val = -128;  // Min value for signed 8-bit
+                T max_val = input[c][oh * POOL_SIZE][ow * POOL_SIZE];
                 
                 for (int ph = 0; ph < POOL_SIZE; ph++) {
                     for (int pw = 0; pw < POOL_SIZE; pw++) {
                         int ih = oh * POOL_SIZE + ph;
                         int iw = ow * POOL_SIZE + pw;
-                        data_t val = input[c][ih][iw];
+                        T val = input[c][ih][iw];
                         if (val > max_val) {
                             max_val = val;
                         }
@@ -71,4 +75,149 @@ void max_pool(
     }
 }
 
+// Pooling restricted to an output rectangle [oh0, oh1) x [ow0, ow1)
+template<int CHANNELS, int POOL_SIZE,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename T = data_t>
+void avg_pool_rect(
+    T input[CHANNELS][IN_H][IN_W],
+    T output[CHANNELS][OUT_H][OUT_W],
+    int oh0,
+    int oh1,
+    int ow0,
+    int ow1
+) {
+    for (int c = 0; c < CHANNELS; c++) {
+        for (int oh = oh0; oh < oh1; oh++) {
+            for (int ow = ow0; ow < ow1; ow++) {
+#pragma HLS PIPELINE II=1
+
+                acc_t sum = 0;
+
+                for (int ph = 0; ph < POOL_SIZE; ph++) {
+                    for (int pw = 0; pw < POOL_SIZE; pw++) {
+                        sum += input[c][oh * POOL_SIZE + ph][ow * POOL_SIZE + pw];
+                    }
+                }
+
+                output[c][oh][ow] = (T)(sum / (POOL_SIZE * POOL_SIZE));
+            }
+        }
+    }
+}
+
+template<int CHANNELS, int POOL_SIZE,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename T = data_t>
+void max_pool_rect(
+    T input[CHANNELS][IN_H][IN_W],
+    T output[CHANNELS][OUT_H][OUT_W],
+    int oh0,
+    int oh1,
+    int ow0,
+    int ow1
+) {
+    for (int c = 0; c < CHANNELS; c++) {
+        for (int oh = oh0; oh < oh1; oh++) {
+            for (int ow = ow0; ow < ow1; ow++) {
+#pragma HLS PIPELINE II=1
+
+                T max_val = input[c][oh * POOL_SIZE][ow * POOL_SIZE];
+
+                for (int ph = 0; ph < POOL_SIZE; ph++) {
+                    for (int pw = 0; pw < POOL_SIZE; pw++) {
+                        T val = input[c][oh * POOL_SIZE + ph][ow * POOL_SIZE + pw];
+                        if (val > max_val) {
+                            max_val = val;
+                        }
+                    }
+                }
+
+                output[c][oh][ow] = max_val;
+            }
+        }
+    }
+}
+
+// Global Average Pooling (one value per channel)
+template<int CHANNELS, int IN_H, int IN_W, typename T = data_t>
+void global_avg_pool(
+    T input[CHANNELS][IN_H][IN_W],
+    T output[CHANNELS],
+    int H,
+    int W
+) {
+    for (int c = 0; c < CHANNELS; c++) {
+        acc_t sum = 0;
+
+        for (int h = 0; h < H; h++) {
+            for (int w = 0; w < W; w++) {
+#pragma HLS PIPELINE II=1
+                sum += input[c][h][w];
+            }
+        }
+
+        output[c] = (T)(sum / (H * W));
+    }
+}
+
+// Single-row pooling for row-streaming
+// linebuf holds the POOL_SIZE input rows of one output row (any slot order).
+template<int CHANNELS, int POOL_SIZE, int IN_W, int OUT_ROWS, int OUT_W,
+         typename T = data_t>
+void avg_pool_row(
+    T linebuf[CHANNELS][POOL_SIZE][IN_W],
+    T outbuf[CHANNELS][OUT_ROWS][OUT_W],
+    int out_slot,
+    int W
+) {
+    int out_w = W / POOL_SIZE;
+
+    for (int c = 0; c < CHANNELS; c++) {
+        for (int ow = 0; ow < out_w; ow++) {
+#pragma HLS PIPELINE II=1
+
+            acc_t sum = 0;
+
+            for (int ph = 0; ph < POOL_SIZE; ph++) {
+                for (int pw = 0; pw < POOL_SIZE; pw++) {
+                    sum += linebuf[c][ph][ow * POOL_SIZE + pw];
+                }
+            }
+
+            outbuf[c][out_slot][ow] = (T)(sum / (POOL_SIZE * POOL_SIZE));
+        }
+    }
+}
+
+template<int CHANNELS, int POOL_SIZE, int IN_W, int OUT_ROWS, int OUT_W,
+         typename T = data_t>
+void max_pool_row(
+    T linebuf[CHANNELS][POOL_SIZE][IN_W],
+    T outbuf[CHANNELS][OUT_ROWS][OUT_W],
+    int out_slot,
+    int W
+) {
+    int out_w = W / POOL_SIZE;
+
+    for (int c = 0; c < CHANNELS; c++) {
+        for (int ow = 0; ow < out_w; ow++) {
+#pragma HLS PIPELINE II=1
+
+            T max_val = linebuf[c][0][ow * POOL_SIZE];
+
+            for (int ph = 0; ph < POOL_SIZE; ph++) {
+                for (int pw = 0; pw < POOL_SIZE; pw++) {
+                    T val = linebuf[c][ph][ow * POOL_SIZE + pw];
+                    if (val > max_val) {
+                        max_val = val;
+                    }
+                }
+            }
+
+            outbuf[c][out_slot][ow] = max_val;
+        }
+    }
+}
+
 #endif // CNN_POOL_H
@@ -0,0 +1,229 @@
+#ifndef CNN_PROFILE_H
+#define CNN_PROFILE_H
+
+// Per-layer profiling for C-simulation (not synthesizable)
+// Build with -DCNN_PROFILE to enable. CNN_PROFILE_LAYER(name, macs) opens a
+// scoped timer that charges wall time (clock_gettime) and TSC ticks
+// (RDTSC, x86 only) to the named layer until the end of the enclosing
+// block. Without CNN_PROFILE the macro expands to nothing, so instrumented
+// sources still synthesize unchanged.
+//
+//   { CNN_PROFILE_LAYER("conv1", macs); conv_layer_simple<...>(...); }
+//
+// Pools and other MAC-free layers pass their element operations instead;
+// GOPS counts 2 ops per MAC (multiply + add). MACs are charged per call, so
+// a layer whose size varies between calls reports its mean.
+//
+// Adding -DCNN_PROFILE_PERF also reads the cnn_perf.h hardware counters
+// around each scope and reports IPC and L1D/LLC misses per MAC per layer.
+// If the counters cannot be opened the extra columns are omitted.
+
+#ifdef CNN_PROFILE
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#ifdef CNN_PROFILE_PERF
+#include "cnn_perf.h"
+#endif
+
+#define CNN_PROFILE_MAX_LAYERS 32
+
+struct ProfileEntry {
+    const char* name;
+    long long total_macs;    // summed over calls
+    int calls;
+    double total_ms;
+    unsigned long long total_ticks;
+#ifdef CNN_PROFILE_PERF
+    PerfCounters counters;
+#endif
+};
+
+struct ProfileRegistry {
+    ProfileEntry entries[CNN_PROFILE_MAX_LAYERS];
+    int count;
+};
+
+// One registry per program (function-local static in an inline function)
+inline ProfileRegistry& cnn_profile_registry() {
+    static ProfileRegistry registry;
+    return registry;
+}
+
+inline ProfileEntry* cnn_profile_entry(const char* name) {
+    ProfileRegistry& r = cnn_profile_registry();
+    for (int i = 0; i < r.count; i++) {
+        if (strcmp(r.entries[i].name, name) == 0) return &r.entries[i];
+    }
+    if (r.count == CNN_PROFILE_MAX_LAYERS) return NULL;
+    ProfileEntry* e = &r.entries[r.count++];
+    e->name = name;
+    e->total_macs = 0;
+    e->calls = 0;
+    e->total_ms = 0.0;
+    e->total_ticks = 0;
+#ifdef CNN_PROFILE_PERF
+    e->counters = PerfCounters();
+#endif
+    return e;
+}
+
+#ifdef CNN_PROFILE_PERF
+// Counter group shared by all scopes, opened on first use
+inline PerfGroup& cnn_profile_perf() {
+    static PerfGroup group;
+    static bool tried = false;
+    if (!tried) {
+        tried = true;
+        group.open();
+    }
+    return group;
+}
+#endif
+
+inline void cnn_profile_reset() {
+    cnn_profile_registry().count = 0;
+}
+
+inline unsigned long long cnn_profile_ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+inline double cnn_profile_now_ms() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+class ProfileScope {
+private:
+    ProfileEntry* entry;
+    long long macs;
+    double start_ms;
+    unsigned long long start_ticks;
+#ifdef CNN_PROFILE_PERF
+    PerfCounters start_counters;
+#endif
+
+public:
+    ProfileScope(const char* name, long long macs)
+        : entry(cnn_profile_entry(name)), macs(macs) {
+#ifdef CNN_PROFILE_PERF
+        cnn_profile_perf().read(start_counters);
+#endif
+        start_ms = cnn_profile_now_ms();
+        start_ticks = cnn_profile_ticks();
+    }
+
+    ~ProfileScope() {
+        unsigned long long ticks = cnn_profile_ticks() - start_ticks;
+        double ms = cnn_profile_now_ms() - start_ms;
+#ifdef CNN_PROFILE_PERF
+        PerfCounters delta;
+        bool counted = cnn_profile_perf().read(delta);
+#endif
+        if (!entry) return;
+        entry->calls++;
+        entry->total_macs += macs;
+        entry->total_ms += ms;
+        entry->total_ticks += ticks;
+#ifdef CNN_PROFILE_PERF
+        if (counted) {
+            delta -= start_counters;
+            entry->counters += delta;
+        }
+#endif
+    }
+};
+
+// Per-layer table: mean time and MACs per call, share of total, and GOPS
+inline void cnn_profile_print_table(FILE* out) {
+    ProfileRegistry& r = cnn_profile_registry();
+    double total_ms = 0.0;
+    long long total_macs = 0;
+    for (int i = 0; i < r.count; i++) {
+        total_ms += r.entries[i].total_ms / r.entries[i].calls;
+        total_macs += r.entries[i].total_macs / r.entries[i].calls;
+    }
+
+    fprintf(out, "%-10s %6s %10s %7s %12s %12s %8s\n",
+            "Layer", "calls", "ms/call", "share", "TSC ticks", "MACs", "GOPS");
+    for (int i = 0; i < r.count; i++) {
+        const ProfileEntry& e = r.entries[i];
+        double ms = e.total_ms / e.calls;
+        fprintf(out, "%-10s %6d %10.3f %6.1f%% %12llu %12lld %8.3f\n",
+                e.name, e.calls, ms, 100.0 * ms / total_ms, e.total_ticks / e.calls,
+                e.total_macs / e.calls,
+                e.total_ms > 0.0 ? 2.0 * e.total_macs / (e.total_ms * 1e6) : 0.0);
+    }
+    fprintf(out, "%-10s %6s %10.3f %6.1f%% %12s %12lld %8.3f\n",
+            "total", "", total_ms, 100.0, "", total_macs,
+            total_ms > 0.0 ? 2.0 * total_macs / (total_ms * 1e6) : 0.0);
+
+#ifdef CNN_PROFILE_PERF
+    if (!cnn_profile_perf().available()) {
+        fprintf(out, "(hardware counters unavailable)\n");
+        return;
+    }
+    fprintf(out, "\n%-10s %12s %6s %10s %10s %12s\n",
+            "Layer", "cycles/call", "IPC", "L1D/MAC", "LLC/MAC", "br-miss/call");
+    for (int i = 0; i < r.count; i++) {
+        const ProfileEntry& e = r.entries[i];
+        const PerfCounters& c = e.counters;
+        long long macs = e.total_macs;
+        fprintf(out, "%-10s %12llu %6.2f %10.5f %10.5f %12llu\n",
+                e.name, c.v[PERF_CYCLES] / e.calls, c.ipc(),
+                c.per_mac(PERF_L1D_MISSES, macs), c.per_mac(PERF_LLC_MISSES, macs),
+                c.v[PERF_BRANCH_MISSES] / e.calls);
+    }
+#endif
+}
+
+// Same data as JSON: {"layers": [{"name": ..., "ms_per_call": ...}, ...]}
+inline void cnn_profile_write_json(FILE* out) {
+    ProfileRegistry& r = cnn_profile_registry();
+    fprintf(out, "{\n  \"layers\": [\n");
+    for (int i = 0; i < r.count; i++) {
+        const ProfileEntry& e = r.entries[i];
+        double ms = e.total_ms / e.calls;
+        fprintf(out, "    {\"name\": \"%s\", \"calls\": %d, \"ms_per_call\": %.6f, "
+                     "\"tsc_ticks_per_call\": %llu, \"macs\": %lld, \"gops\": %.6f",
+                e.name, e.calls, ms, e.total_ticks / e.calls, e.total_macs / e.calls,
+                e.total_ms > 0.0 ? 2.0 * e.total_macs / (e.total_ms * 1e6) : 0.0);
+#ifdef CNN_PROFILE_PERF
+        if (cnn_profile_perf().available()) {
+            const PerfCounters& c = e.counters;
+            long long macs = e.total_macs;
+            fprintf(out, ", \"cycles_per_call\": %llu, \"ipc\": %.4f, "
+                         "\"l1d_miss_per_mac\": %.6f, \"llc_miss_per_mac\": %.6f, "
+                         "\"branch_miss_per_call\": %llu",
+                    c.v[PERF_CYCLES] / e.calls, c.ipc(),
+                    c.per_mac(PERF_L1D_MISSES, macs), c.per_mac(PERF_LLC_MISSES, macs),
+                    c.v[PERF_BRANCH_MISSES] / e.calls);
+        }
+#endif
+        fprintf(out, "}%s\n", (i + 1 < r.count) ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+}
+
+#define CNN_PROFILE_CONCAT2(a, b) a##b
+#define CNN_PROFILE_CONCAT(a, b) CNN_PROFILE_CONCAT2(a, b)
+#define CNN_PROFILE_LAYER(name, macs) \
+    ProfileScope CNN_PROFILE_CONCAT(cnn_profile_scope_, __LINE__)((name), (macs))
+
+#else
+
+#define CNN_PROFILE_LAYER(name, macs)
+
+#endif // CNN_PROFILE
+
+#endif // CNN_PROFILE_H
@@ -0,0 +1,275 @@
+#ifndef CNN_ROOFLINE_H
+#define CNN_ROOFLINE_H
+
+// Roofline report for host benchmarks (plain C, also usable from C++)
+// Each layer carries its theoretical ops, the bytes it must move at least
+// once (weights + input + output activations, i.e. perfect reuse) and a
+// measured time. The report gives arithmetic intensity (ops/byte), the
+// achieved GOPS and GB/s, and the attainable roof
+//     min(peak_gops, intensity * peak_gbps)
+// so each layer reads as memory- or compute-bound and how far below the
+// roof it runs.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef struct {
+    const char *name;
+    long long ops;            // 2 per MAC
+    long long weight_bytes;
+    long long in_bytes;
+    long long out_bytes;
+    double ms;                // measured time per call
+} roofline_layer_t;
+
+// The roof and the machine it belongs to. Peaks only mean something for
+// the machine the layers were timed on: measure them there
+// (roofline_measure_host) or pass that machine's numbers. gops is the
+// roof in use; fp32_gops and int8_gops are the two arithmetic peaks, and
+// roofline_fp32()/roofline_int8() pick the one matching a table.
+typedef struct {
+    const char *machine;
+    const char *arith;        // what gops counts
+    double gops;
+    double gbps;              // DRAM, not a cache level
+    double fp32_gops;
+    double int8_gops;
+} roofline_peaks_t;
+
+// Nominal Pynq-Z2 PS: one Cortex-A9 core at 650 MHz with 4 FP32 ops/cycle
+// or 16 int8 ops/cycle (NEON VMLAL.S8, 8 MACs), and 16-bit DDR3-1066
+// (~2.1 GB/s)
+#define ROOFLINE_PEAK_GOPS_PYNQ      2.6
+#define ROOFLINE_PEAK_INT8_GOPS_PYNQ 10.4
+#define ROOFLINE_PEAK_GBPS_PYNQ      2.1
+
+static inline roofline_peaks_t roofline_fp32(roofline_peaks_t p) {
+    p.gops = p.fp32_gops;
+    p.arith = "FP32 multiply-add";
+    return p;
+}
+
+static inline roofline_peaks_t roofline_int8(roofline_peaks_t p) {
+    p.gops = p.int8_gops;
+    p.arith = "int8 MAC";
+    return p;
+}
+
+static inline roofline_peaks_t roofline_pynq_peaks(void) {
+    roofline_peaks_t p = { "Pynq-Z2 Cortex-A9 core + DDR3 (nominal)", "",
+                           0.0, ROOFLINE_PEAK_GBPS_PYNQ,
+                           ROOFLINE_PEAK_GOPS_PYNQ, ROOFLINE_PEAK_INT8_GOPS_PYNQ };
+    return roofline_fp32(p);
+}
+
+static inline double roofline_now_ms(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+// FP32 compute peak of this machine as built: 32 independent multiply-add
+// chains (the compiler may vectorize them), best of 5 trials
+static inline double roofline_measure_gops(void) {
+    float acc[32];
+    const float m = 0.999f, a = 1e-3f;
+    const int reps = 1 << 20;
+    double best = 0.0;
+    for (int i = 0; i < 32; i++) acc[i] = (float)i;
+    for (int trial = 0; trial < 5; trial++) {
+        double t0 = roofline_now_ms();
+        for (int r = 0; r < reps; r++)
+            for (int i = 0; i < 32; i++)
+                acc[i] = acc[i] * m + a;
+        double ms = roofline_now_ms() - t0;
+        double gops = ms > 0.0 ? 2.0 * 32 * reps / (ms * 1e6) : 0.0;
+        if (gops > best) best = gops;
+    }
+    volatile float sink = 0.0f;
+    for (int i = 0; i < 32; i++) sink += acc[i];
+    (void)sink;
+    return best;
+}
+
+// int8 compute peak: an L1-resident int8 x int8 -> int32 dot product, the
+// inner loop of the int8 kernels, best of 5 trials. Each pass perturbs one
+// activation with the previous sum so passes cannot be folded together.
+static inline double roofline_measure_int8_gops(void) {
+    enum { N = 4096 };
+    static signed char x[N], w[N];
+    const int reps = 1 << 12;
+    double best = 0.0;
+    int sum = 0;
+    for (int i = 0; i < N; i++) {
+        x[i] = (signed char)(i * 7);
+        w[i] = (signed char)(i * 13 + 5);
+    }
+    for (int trial = 0; trial < 5; trial++) {
+        double t0 = roofline_now_ms();
+        for (int r = 0; r < reps; r++) {
+            int acc = 0;
+            for (int i = 0; i < N; i++)
+                acc += x[i] * w[i];
+            x[r % N] = (signed char)acc;
+            sum += acc;
+        }
+        double ms = roofline_now_ms() - t0;
+        double gops = ms > 0.0 ? 2.0 * N * reps / (ms * 1e6) : 0.0;
+        if (gops > best) best = gops;
+    }
+    volatile int sink = sum;
+    (void)sink;
+    return best;
+}
+
+// Size of the largest cache of CPU 0 as reported by Linux sysfs (0 if
+// unknown)
+static inline size_t roofline_llc_bytes(void) {
+    size_t best = 0;
+    for (int i = 0; i < 8; i++) {
+        char path[64];
+        size_t size;
+        char unit = 'B';
+        snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu0/cache/index%d/size", i);
+        FILE *f = fopen(path, "r");
+        if (!f) continue;
+        if (fscanf(f, "%zu%c", &size, &unit) >= 1) {
+            if (unit == 'K') size <<= 10;
+            else if (unit == 'M') size <<= 20;
+            if (size > best) best = size;
+        }
+        fclose(f);
+    }
+    return best;
+}
+
+// DRAM peak: best memcpy rate (bytes read + written) on buffers of twice
+// the last-level cache (at least 64 MB), so every copy streams from DRAM.
+// A cache-resident copy would put the ridge near zero and read every layer
+// as compute-bound.
+static inline double roofline_measure_gbps(void) {
+    size_t bytes = 2 * roofline_llc_bytes();
+    if (bytes < ((size_t)64 << 20)) bytes = (size_t)64 << 20;
+    char *src = (char *)malloc(bytes), *dst = (char *)malloc(bytes);
+    double best = 0.0;
+    if (!src || !dst) {
+        free(src);
+        free(dst);
+        return 0.0;
+    }
+    memset(src, 1, bytes);
+    memset(dst, 0, bytes);
+    for (int trial = 0; trial < 3; trial++) {
+        double t0 = roofline_now_ms();
+        memcpy(dst, src, bytes);
+        double ms = roofline_now_ms() - t0;
+        src[trial] = dst[bytes - 1 - trial];   // keep the copy live
+        double gbps = ms > 0.0 ? 2.0 * bytes / (ms * 1e6) : 0.0;
+        if (gbps > best) best = gbps;
+    }
+    free(src);
+    free(dst);
+    return best;
+}
+
+static inline roofline_peaks_t roofline_measure_host(void) {
+    roofline_peaks_t p = { "this host (measured: multiply-add, int8 dot product, DRAM memcpy)", "",
+                           0.0, roofline_measure_gbps(),
+                           roofline_measure_gops(), roofline_measure_int8_gops() };
+    return roofline_fp32(p);
+}
+
+// Peaks from a command-line argument: "host" measures this machine, "pynq"
+// takes the nominal Pynq-Z2 numbers, "G,B[,I]" gives the FP32 GOPS, GB/s
+// and int8 GOPS (default G) of another machine. Returns 0 if the argument
+// is malformed.
+static inline int roofline_parse_peaks(const char *arg, roofline_peaks_t *p) {
+    double gops, gbps, int8_gops;
+    int n;
+    if (strcmp(arg, "host") == 0) {
+        *p = roofline_measure_host();
+        return p->fp32_gops > 0.0 && p->int8_gops > 0.0 && p->gbps > 0.0;
+    }
+    if (strcmp(arg, "pynq") == 0) {
+        *p = roofline_pynq_peaks();
+        return 1;
+    }
+    n = sscanf(arg, "%lf,%lf,%lf", &gops, &gbps, &int8_gops);
+    if (n < 2 || gops <= 0.0 || gbps <= 0.0)
+        return 0;
+    if (n < 3) int8_gops = gops;
+    if (int8_gops <= 0.0)
+        return 0;
+    p->machine = "user-supplied peaks";
+    p->gbps = gbps;
+    p->fp32_gops = gops;
+    p->int8_gops = int8_gops;
+    *p = roofline_fp32(*p);
+    return 1;
+}
+
+static inline long long roofline_bytes(const roofline_layer_t *l) {
+    return l->weight_bytes + l->in_bytes + l->out_bytes;
+}
+
+static inline double roofline_intensity(const roofline_layer_t *l) {
+    long long b = roofline_bytes(l);
+    return b > 0 ? (double)l->ops / b : 0.0;
+}
+
+static inline double roofline_attainable_gops(const roofline_layer_t *l,
+                                              double peak_gops, double peak_gbps) {
+    double mem_roof = roofline_intensity(l) * peak_gbps;
+    return mem_roof < peak_gops ? mem_roof : peak_gops;
+}
+
+// Ridge point: intensities above it are compute-bound
+static inline double roofline_ridge(double peak_gops, double peak_gbps) {
+    return peak_gops / peak_gbps;
+}
+
+static inline void roofline_print(FILE *out, const char *variant,
+                                  const roofline_layer_t *layers, int n,
+                                  roofline_peaks_t peaks) {
+    double peak_gops = peaks.gops, peak_gbps = peaks.gbps;
+    double ridge = roofline_ridge(peak_gops, peak_gbps);
+    fprintf(out, "\n=== ROOFLINE: %s (peak %.2f GOPS, %.2f GB/s, ridge %.2f ops/B) ===\n",
+            variant, peak_gops, peak_gbps, ridge);
+    fprintf(out, "Roof: %s, %s peak\n", peaks.machine, peaks.arith);
+    fprintf(out, "%-16s %12s %11s %8s %8s %8s %8s %7s %s\n", "Layer", "ops", "bytes",
+            "ops/B", "GOPS", "GB/s", "roof", "%roof", "bound");
+    for (int i = 0; i < n; i++) {
+        const roofline_layer_t *l = &layers[i];
+        double ai = roofline_intensity(l);
+        double roof = roofline_attainable_gops(l, peak_gops, peak_gbps);
+        double gops = l->ms > 0.0 ? l->ops / (l->ms * 1e6) : 0.0;
+        double gbps = l->ms > 0.0 ? roofline_bytes(l) / (l->ms * 1e6) : 0.0;
+        fprintf(out, "%-16s %12lld %11lld %8.2f %8.3f %8.3f %8.3f %6.1f%% %s\n",
+                l->name, l->ops, roofline_bytes(l), ai, gops, gbps, roof,
+                roof > 0.0 ? 100.0 * gops / roof : 0.0,
+                ai < ridge ? "memory" : "compute");
+    }
+}
+
+// One CSV row per layer, for plotting; write the header once per file
+static inline void roofline_write_csv_header(FILE *out) {
+    fprintf(out, "variant,layer,ops,weight_bytes,in_bytes,out_bytes,ms,intensity,gops,roof_gops,machine,arith\n");
+}
+
+static inline void roofline_write_csv(FILE *out, const char *variant,
+                                      const roofline_layer_t *layers, int n,
+                                      roofline_peaks_t peaks) {
+    for (int i = 0; i < n; i++) {
+        const roofline_layer_t *l = &layers[i];
+        fprintf(out, "%s,%s,%lld,%lld,%lld,%lld,%.6f,%.6f,%.6f,%.6f,\"%s\",%s\n",
+                variant, l->name, l->ops, l->weight_bytes, l->in_bytes, l->out_bytes,
+                l->ms, roofline_intensity(l),
+                l->ms > 0.0 ? l->ops / (l->ms * 1e6) : 0.0,
+                roofline_attainable_gops(l, peaks.gops, peaks.gbps), peaks.machine,
+                peaks.arith);
+    }
+}
+
+#endif // CNN_ROOFLINE_H
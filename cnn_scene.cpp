@@ -0,0 +1,153 @@
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "cnn_conv.h"
+#include "cnn_pool.h"
+#include "cnn_fc.h"
+
+// Scene-mode feature map sizes (each stage at most halves the previous one)
+#define SCENE_P1_H (SCENE_MAX_H / 2)
+#define SCENE_P1_W (SCENE_MAX_W / 2)
+#define SCENE_P2_H (SCENE_MAX_H / 4)
+#define SCENE_P2_W (SCENE_MAX_W / 4)
+#define SCENE_C3_H (SCENE_MAX_H / 8)
+#define SCENE_C3_W (SCENE_MAX_W / 8)
+#define SCENE_P3_H (SCENE_MAX_H / 16)
+#define SCENE_P3_W (SCENE_MAX_W / 16)
+
+// Gather the FC1 input for one window from the scene-wide POOL3 map.
+// cnn_network() flattens an 8x4 region of its POOL3 buffer, of which only
+// tile_h x tile_w cells are ever written (7x7 for a 128x128 tile); the rest
+// read as zero. Reproduce that exactly so scene scores match per-tile scores.
+void scene_window_flatten(
+    act_t pool3[CONV3_OUT_CH][SCENE_P3_H][SCENE_P3_W],
+    act_t output[FC1_IN],
+    int row,
+    int col,
+    int tile_h,
+    int tile_w
+) {
+    int idx = 0;
+    for (int c = 0; c < CONV3_OUT_CH; c++) {
+        for (int h = 0; h < 8; h++) {
+            for (int w = 0; w < 4; w++) {
+#pragma HLS PIPELINE II=1
+                bool inside = (h < tile_h) && (w < tile_w);
+                output[idx++] = inside ? pool3[c][row + h][col + w] : (act_t)0;
+            }
+        }
+    }
+}
+
+// Fully-convolutional scene scanner
+// Runs CONV1..POOL3 once over the whole H x W scene, then evaluates the
+// FC head for every 128x128 window on a SCENE_STRIDE grid. Each window's
+// scores are bit-exact with cnn_network() on the same crop, but the shared
+// convolution work is done only once instead of once per overlapping tile.
+//
+// C-simulation reference only: the scene-wide maps below hold about 8 MB
+// (conv1_out alone is 16 x 512 x 512 bytes), far beyond the BRAM of a
+// Zynq-7000. The synthesizable scene path is cnn_scene_stream(), which
+// keeps only row bands of each map on chip. Scenes larger than
+// SCENE_MAX_H x SCENE_MAX_W are rejected without writing any scores.
+void cnn_scene_scan(
+    data_t input[CONV1_IN_CH][SCENE_MAX_H][SCENE_MAX_W],
+    data_t scores[SCENE_MAX_WIN_H][SCENE_MAX_WIN_W][FC2_OUT],
+
+    // Layer weights
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+
+    // Scene dimensions
+    int H,
+    int W
+) {
+#pragma HLS INTERFACE m_axi port=input offset=slave bundle=gmem
+#pragma HLS INTERFACE m_axi port=scores offset=slave bundle=gmem
+#pragma HLS INTERFACE bram port=conv1_weights
+#pragma HLS INTERFACE bram port=conv2_weights
+#pragma HLS INTERFACE bram port=conv3_weights
+#pragma HLS INTERFACE bram port=fc1_weights
+#pragma HLS INTERFACE bram port=fc2_weights
+#pragma HLS INTERFACE bram port=fc1_bias
+#pragma HLS INTERFACE bram port=fc2_bias
+#pragma HLS INTERFACE s_axilite port=H
+#pragma HLS INTERFACE s_axilite port=W
+#pragma HLS INTERFACE s_axilite port=return
+
+    if (H > SCENE_MAX_H || W > SCENE_MAX_W) return;
+
+    // Scene-wide intermediate feature maps (post-ReLU, act_t as in cnn_network())
+    static act_t  conv1_out[CONV1_OUT_CH][SCENE_MAX_H][SCENE_MAX_W];
+    static act_t  pool1_out[CONV1_OUT_CH][SCENE_P1_H][SCENE_P1_W];
+    static act_t  conv2_out[CONV2_OUT_CH][SCENE_P1_H][SCENE_P1_W];
+    static act_t  pool2_out[CONV2_OUT_CH][SCENE_P2_H][SCENE_P2_W];
+    static act_t  conv3_out[CONV3_OUT_CH][SCENE_C3_H][SCENE_C3_W];
+    static act_t  pool3_out[CONV3_OUT_CH][SCENE_P3_H][SCENE_P3_W];
+    static act_t  flattened[FC1_IN];
+    static act_t  fc1_out[FC1_OUT];
+
+    // Scene dimensions at each stage
+    int h1 = conv_out_size(H, CONV1_K, 1);
+    int w1 = conv_out_size(W, CONV1_K, 1);
+    int h2 = pool_out_size(h1, POOL1_SIZE, POOL1_SIZE);
+    int w2 = pool_out_size(w1, POOL1_SIZE, POOL1_SIZE);
+    int h3 = conv_out_size(h2, CONV2_K, 1);
+    int w3 = conv_out_size(w2, CONV2_K, 1);
+    int h4 = pool_out_size(h3, POOL2_SIZE, POOL2_SIZE);
+    int w4 = pool_out_size(w3, POOL2_SIZE, POOL2_SIZE);
+    int h5 = conv_out_size(h4, CONV3_K, CONV3_STRIDE);
+    int w5 = conv_out_size(w4, CONV3_K, CONV3_STRIDE);
+
+    // POOL3 extent of a single 128x128 tile (7x7)
+    int tile_h6 = trunk_out_size(MAX_H);
+    int tile_w6 = trunk_out_size(MAX_W);
+
+    int win_h = scene_window_count(H);
+    int win_w = scene_window_count(W);
+
+    // Shared trunk: one pass over the whole scene
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                      SCENE_MAX_H, SCENE_MAX_W, SCENE_MAX_H, SCENE_MAX_W, conv1_precision>(
+        input, conv1_out, conv1_weights, H, W
+    );
+    avg_pool<CONV1_OUT_CH, POOL1_SIZE>(
+        conv1_out, pool1_out, h1, w1
+    );
+    conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1,
+                      SCENE_P1_H, SCENE_P1_W, SCENE_P1_H, SCENE_P1_W, conv2_precision>(
+        pool1_out, conv2_out, conv2_weights, h2, w2
+    );
+    avg_pool<CONV2_OUT_CH, POOL2_SIZE>(
+        conv2_out, pool2_out, h3, w3
+    );
+    conv_layer_simple<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE,
+                      SCENE_P2_H, SCENE_P2_W, SCENE_C3_H, SCENE_C3_W, conv3_precision>(
+        pool2_out, conv3_out, conv3_weights, h4, w4
+    );
+    max_pool<CONV3_OUT_CH, POOL3_SIZE>(
+        conv3_out, pool3_out, h5, w5
+    );
+
+    // FC head at every window position (one POOL3 cell per SCENE_STRIDE pixels)
+    for (int wy = 0; wy < win_h; wy++) {
+        for (int wx = 0; wx < win_w; wx++) {
+            scene_window_flatten(pool3_out, flattened, wy, wx, tile_h6, tile_w6);
+
+            fc_layer<FC1_IN, FC1_OUT, fc1_precision>(
+                flattened, fc1_out, fc1_weights, fc1_bias, true
+            );
+
+            // Dropout is a no-op in inference
+            fc_layer<FC2_IN, FC2_OUT, fc2_precision>(
+                fc1_out, scores[wy][wx], fc2_weights, fc2_bias, false
+            );
+        }
+    }
+}
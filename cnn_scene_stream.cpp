@@ -0,0 +1,278 @@
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "cnn_conv.h"
+#include "cnn_pool.h"
+#include "cnn_fc.h"
+
+// Line buffer widths at each stage of the trunk
+#define STREAM_P1_W (STREAM_MAX_W / 2)
+#define STREAM_P2_W (STREAM_MAX_W / 4)
+#define STREAM_C3_W (STREAM_MAX_W / 8)
+#define STREAM_P3_W (STREAM_MAX_W / 16)
+
+// POOL3 rows kept for the FC head (covers the 8-row flatten region)
+#define STREAM_HEAD_ROWS 8
+
+// Gather the FC1 input for one window from the POOL3 row ring.
+// Same layout and zero fill as scene_window_flatten() in cnn_scene.cpp.
+void stream_window_flatten(
+    act_t pool3_rows[CONV3_OUT_CH][STREAM_HEAD_ROWS][STREAM_P3_W],
+    act_t output[FC1_IN],
+    int row,
+    int col,
+    int tile_h,
+    int tile_w
+) {
+    int idx = 0;
+    for (int c = 0; c < CONV3_OUT_CH; c++) {
+        for (int h = 0; h < 8; h++) {
+            for (int w = 0; w < 4; w++) {
+#pragma HLS PIPELINE II=1
+                bool inside = (h < tile_h) && (w < tile_w);
+                int slot = (row + h) % STREAM_HEAD_ROWS;
+                output[idx++] = inside ? pool3_rows[c][slot][col + w] : (act_t)0;
+            }
+        }
+    }
+}
+
+// Row-band streaming scene scanner
+// Feeds the scene through the trunk one band of STREAM_BAND_H rows at a
+// time. Each stage keeps only the rows its next consumer still needs
+// (K rows ahead of a conv, POOL_SIZE rows ahead of a pool), so memory is
+// bounded by band height x width regardless of scene height.
+//
+// The rings are per-row versions of conv_layer_stream()'s line buffers:
+// they persist across calls (a band ends mid-scene) and each layer consumes
+// whole rows, so conv_layer_row / avg_pool_row / max_pool_row compute one
+// output row from a ring instead of streaming a full frame per call.
+//
+// Call with first_band=true for the first band of a scene; all bands but
+// the last must be full. Whenever a window row completes (at most once per
+// band), its scores are written to scores[0..win_cols) and *win_row is set
+// to its index; otherwise *win_row is STREAM_NO_ROW. W > STREAM_MAX_W or
+// band_rows outside 1..STREAM_BAND_H set STREAM_BAD_GEOMETRY and leave
+// the band and the scene state alone (use cnn_scene_stream_scan() for wider scenes). Scores
+// are bit-exact with cnn_scene_scan() and therefore with cnn_network() per
+// tile.
+void cnn_scene_stream_band(
+    data_t band[CONV1_IN_CH][STREAM_BAND_H][STREAM_MAX_W],
+    data_t scores[STREAM_MAX_WIN_W][FC2_OUT],
+
+    // Layer weights
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+
+    // Band geometry
+    int band_rows,
+    int W,
+    bool first_band,
+    int *win_row
+) {
+#pragma HLS INTERFACE m_axi port=band offset=slave bundle=gmem
+#pragma HLS INTERFACE m_axi port=scores offset=slave bundle=gmem
+#pragma HLS INTERFACE bram port=conv1_weights
+#pragma HLS INTERFACE bram port=conv2_weights
+#pragma HLS INTERFACE bram port=conv3_weights
+#pragma HLS INTERFACE bram port=fc1_weights
+#pragma HLS INTERFACE bram port=fc2_weights
+#pragma HLS INTERFACE bram port=fc1_bias
+#pragma HLS INTERFACE bram port=fc2_bias
+#pragma HLS INTERFACE s_axilite port=band_rows
+#pragma HLS INTERFACE s_axilite port=W
+#pragma HLS INTERFACE s_axilite port=first_band
+#pragma HLS INTERFACE s_axilite port=win_row
+#pragma HLS INTERFACE s_axilite port=return
+
+    // Line buffer rings between stages (persist across bands). Post-ReLU
+    // rows are act_t, as in cnn_network().
+    static data_t input_rows[CONV1_IN_CH][CONV1_K][STREAM_MAX_W];
+    static act_t  conv1_rows[CONV1_OUT_CH][POOL1_SIZE][STREAM_MAX_W];
+    static act_t  pool1_rows[CONV2_IN_CH][CONV2_K][STREAM_P1_W];
+    static act_t  conv2_rows[CONV2_OUT_CH][POOL2_SIZE][STREAM_P1_W];
+    static act_t  pool2_rows[CONV3_IN_CH][CONV3_K][STREAM_P2_W];
+    static act_t  conv3_rows[CONV3_OUT_CH][POOL3_SIZE][STREAM_C3_W];
+    static act_t  pool3_rows[CONV3_OUT_CH][STREAM_HEAD_ROWS][STREAM_P3_W];
+    static act_t  flattened[FC1_IN];
+    static act_t  fc1_out[FC1_OUT];
+
+    // Rows produced so far at each stage
+    static int n_in, n_c1, n_p1, n_c2, n_p2, n_c3, n_p3;
+    static int next_win;
+
+    if (W > STREAM_MAX_W || band_rows < 1 || band_rows > STREAM_BAND_H) {
+        *win_row = STREAM_BAD_GEOMETRY;
+        return;
+    }
+
+    if (first_band) {
+        n_in = n_c1 = n_p1 = n_c2 = n_p2 = n_c3 = n_p3 = 0;
+        next_win = 0;
+    }
+
+    // Row widths at each stage
+    int w1 = conv_out_size(W, CONV1_K, 1);
+    int w2 = pool_out_size(w1, POOL1_SIZE, POOL1_SIZE);
+    int w3 = conv_out_size(w2, CONV2_K, 1);
+    int w4 = pool_out_size(w3, POOL2_SIZE, POOL2_SIZE);
+    int w5 = conv_out_size(w4, CONV3_K, CONV3_STRIDE);
+
+    int tile_h6 = trunk_out_size(MAX_H);
+    int tile_w6 = trunk_out_size(MAX_W);
+    int win_cols = scene_window_count(W);
+
+    *win_row = STREAM_NO_ROW;
+
+    for (int r = 0; r < band_rows; r++) {
+        // Input row -> ring
+        for (int c = 0; c < CONV1_IN_CH; c++) {
+            for (int x = 0; x < W; x++) {
+#pragma HLS PIPELINE II=1
+                input_rows[c][n_in % CONV1_K][x] = band[c][r][x];
+            }
+        }
+        n_in++;
+        if (n_in < CONV1_K) continue;
+
+        // CONV1 row
+        conv_layer_row<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                       STREAM_MAX_W, POOL1_SIZE, STREAM_MAX_W, conv1_precision>(
+            input_rows, conv1_rows, conv1_weights,
+            (n_in - CONV1_K) % CONV1_K, n_c1 % POOL1_SIZE, W
+        );
+        n_c1++;
+        if (n_c1 % POOL1_SIZE != 0) continue;
+
+        // POOL1 row
+        avg_pool_row<CONV1_OUT_CH, POOL1_SIZE>(
+            conv1_rows, pool1_rows, n_p1 % CONV2_K, w1
+        );
+        n_p1++;
+        if (n_p1 < CONV2_K) continue;
+
+        // CONV2 row
+        conv_layer_row<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1,
+                       STREAM_P1_W, POOL2_SIZE, STREAM_P1_W, conv2_precision>(
+            pool1_rows, conv2_rows, conv2_weights,
+            (n_p1 - CONV2_K) % CONV2_K, n_c2 % POOL2_SIZE, w2
+        );
+        n_c2++;
+        if (n_c2 % POOL2_SIZE != 0) continue;
+
+        // POOL2 row
+        avg_pool_row<CONV2_OUT_CH, POOL2_SIZE>(
+            conv2_rows, pool2_rows, n_p2 % CONV3_K, w3
+        );
+        n_p2++;
+        if (n_p2 < CONV3_K || (n_p2 - CONV3_K) % CONV3_STRIDE != 0) continue;
+
+        // CONV3 row (stride 2: every other POOL2 row)
+        conv_layer_row<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE,
+                       STREAM_P2_W, POOL3_SIZE, STREAM_C3_W, conv3_precision>(
+            pool2_rows, conv3_rows, conv3_weights,
+            (n_p2 - CONV3_K) % CONV3_K, n_c3 % POOL3_SIZE, w4
+        );
+        n_c3++;
+        if (n_c3 % POOL3_SIZE != 0) continue;
+
+        // POOL3 row
+        max_pool_row<CONV3_OUT_CH, POOL3_SIZE>(
+            conv3_rows, pool3_rows, n_p3 % STREAM_HEAD_ROWS, w5
+        );
+        n_p3++;
+    }
+
+    // A window row is emitted once all of its input rows have arrived.
+    // Its POOL3 rows were already produced a few input rows earlier and are
+    // still in the ring (the next POOL3 row needs rows past the window).
+    if (n_in >= next_win * SCENE_STRIDE + MAX_H && n_p3 >= next_win + tile_h6) {
+        for (int wx = 0; wx < win_cols; wx++) {
+            stream_window_flatten(pool3_rows, flattened, next_win, wx, tile_h6, tile_w6);
+
+            fc_layer<FC1_IN, FC1_OUT, fc1_precision>(
+                flattened, fc1_out, fc1_weights, fc1_bias, true
+            );
+
+            // Dropout is a no-op in inference
+            fc_layer<FC2_IN, FC2_OUT, fc2_precision>(
+                fc1_out, scores[wx], fc2_weights, fc2_bias, false
+            );
+        }
+        *win_row = next_win;
+        next_win++;
+    }
+}
+
+// Scene scan of any width (PS-side driver)
+// Splits the scene into strips of at most STREAM_MAX_W columns starting
+// every STREAM_STRIP_STEP columns. Consecutive strips overlap by
+// MAX_W - SCENE_STRIDE, so every window lies wholly inside exactly one
+// strip and window column x0 / SCENE_STRIDE of a strip at x0 follows the
+// last one of the previous strip. Each strip is streamed top to bottom
+// through cnn_scene_stream_band() and its window columns are stitched into
+// scores. The overlap is recomputed by the trunk of both strips.
+//
+// scene is [CONV1_IN_CH][H][W] and scores is
+// [scene_window_count(H)][scene_window_count(W)][FC2_OUT], both row-major.
+// Returns false, with scores untouched, if the scene is smaller than one
+// window. Scores are bit-exact with cnn_network() per window.
+bool cnn_scene_stream_scan(
+    const data_t *scene,
+    data_t *scores,
+
+    // Layer weights
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+
+    // Biases
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+
+    // Scene geometry
+    int H,
+    int W
+) {
+    static data_t band[CONV1_IN_CH][STREAM_BAND_H][STREAM_MAX_W];
+    static data_t row_scores[STREAM_MAX_WIN_W][FC2_OUT];
+
+    int win_w = scene_window_count(W);
+    if (scene_window_count(H) == 0 || win_w == 0) return false;
+
+    for (int x0 = 0; x0 + MAX_W <= W; x0 += STREAM_STRIP_STEP) {
+        int strip_w = (W - x0 < STREAM_MAX_W) ? (W - x0) : STREAM_MAX_W;
+        int first_col = x0 / SCENE_STRIDE;
+
+        for (int y0 = 0; y0 < H; y0 += STREAM_BAND_H) {
+            int rows = (H - y0 < STREAM_BAND_H) ? (H - y0) : STREAM_BAND_H;
+            for (int c = 0; c < CONV1_IN_CH; c++)
+                for (int r = 0; r < rows; r++)
+                    for (int x = 0; x < strip_w; x++)
+                        band[c][r][x] = scene[((long)c * H + y0 + r) * W + x0 + x];
+
+            int win_row;
+            cnn_scene_stream_band(
+                band, row_scores,
+                conv1_weights, conv2_weights, conv3_weights,
+                fc1_weights, fc2_weights,
+                fc1_bias, fc2_bias,
+                rows, strip_w, y0 == 0, &win_row
+            );
+            if (win_row < 0) continue;
+
+            for (int wx = 0; wx < scene_window_count(strip_w); wx++)
+                for (int k = 0; k < FC2_OUT; k++)
+                    scores[((long)win_row * win_w + first_col + wx) * FC2_OUT + k] = row_scores[wx][k];
+        }
+    }
+    return true;
+}
@@ -0,0 +1,275 @@
+#ifndef CNN_SYSTOLIC_H
+#define CNN_SYSTOLIC_H
+
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "cnn_fc.h"
+
+// Systolic MAC engine shared by every conv and FC layer
+// One SA_ROWS x SA_COLS array of int8 PEs, output-stationary: PE (r, c)
+// accumulates acc[r][c] = sum_k w[r][k] * a[k][c]. Weights enter on the
+// left edge and move right, activations enter on the top edge and move
+// down, both skewed by one cycle per row/column, so every PE does one MAC
+// per cycle and a pass over depth D takes D + SA_ROWS + SA_COLS - 2 cycles.
+//
+// Layers only fill the operand tiles and read back the accumulators; the
+// array itself is systolic_engine(), which the top instantiates once
+// (ALLOCATION limit=1), so the layers time-share the same SA_ROWS * SA_COLS
+// DSPs instead of each unrolling their own.
+//
+// Activation tiles are ping-ponged: conv layers fill one while the engine
+// runs on the other, one depth step (SA_COLS activations) per cycle, so a
+// fill (depth cycles) hides behind a pass (depth + SA_ROWS + SA_COLS - 2).
+// Weight tile loads and accumulator write-back still stall the array.
+
+struct SystolicTiles {
+    weight_t w[SA_ROWS][SA_MAX_DEPTH];      // one row per output channel/neuron
+    data_t   a[2][SA_MAX_DEPTH][SA_COLS];   // ping-pong, one column per output pixel
+    acc_t    acc[SA_ROWS][SA_COLS];
+};
+
+#ifndef __SYNTHESIS__
+// Utilization counters (C simulation only). pe_cycles covers every cycle
+// the array is held by a layer: engine passes plus the stalls where it
+// waits for operand loads or write-back that are not overlapped.
+struct SystolicStats {
+    long long passes;
+    long long useful_macs;   // MACs the layers actually needed
+    long long pe_cycles;     // cycles x PEs spent in the array
+    long long stall_cycles;  // cycles the array waited on loads/write-back
+    double utilization() const { return pe_cycles ? (double)useful_macs / pe_cycles : 0.0; }
+};
+
+inline SystolicStats& systolic_stats() {
+    static SystolicStats s = { 0, 0, 0, 0 };
+    return s;
+}
+
+// Charge cycles in which the array sits idle
+inline void systolic_stall(long long cycles) {
+    systolic_stats().stall_cycles += cycles;
+    systolic_stats().pe_cycles += cycles * SA_ROWS * SA_COLS;
+}
+#endif
+
+// One pass of the array over `depth` reduction steps of activation tile a
+inline void systolic_engine(SystolicTiles& t, data_t a_tile[SA_MAX_DEPTH][SA_COLS], int depth) {
+#pragma HLS INLINE off
+#pragma HLS ARRAY_PARTITION variable=t.w complete dim=1
+#pragma HLS ARRAY_PARTITION variable=t.acc complete dim=0
+
+    weight_t w_reg[SA_ROWS][SA_COLS];
+    data_t a_reg[SA_ROWS][SA_COLS];
+#pragma HLS ARRAY_PARTITION variable=w_reg complete dim=0
+#pragma HLS ARRAY_PARTITION variable=a_reg complete dim=0
+
+    for (int r = 0; r < SA_ROWS; r++) {
+#pragma HLS UNROLL
+        for (int c = 0; c < SA_COLS; c++) {
+#pragma HLS UNROLL
+            t.acc[r][c] = 0;
+            w_reg[r][c] = 0;
+            a_reg[r][c] = 0;
+        }
+    }
+
+    int steps = depth + SA_ROWS + SA_COLS - 2;
+    for (int s = 0; s < steps; s++) {
+#pragma HLS PIPELINE II=1
+        // Walk the PEs against the data flow so each one reads its
+        // neighbours' registers from the previous cycle
+        for (int r = SA_ROWS - 1; r >= 0; r--) {
+            for (int c = SA_COLS - 1; c >= 0; c--) {
+                weight_t w;
+                data_t a;
+                if (c == 0) {
+                    int k = s - r;
+                    w = (k >= 0 && k < depth) ? t.w[r][k] : (weight_t)0;
+                } else {
+                    w = w_reg[r][c - 1];
+                }
+                if (r == 0) {
+                    int k = s - c;
+                    a = (k >= 0 && k < depth) ? a_tile[k][c] : (data_t)0;
+                } else {
+                    a = a_reg[r - 1][c];
+                }
+                t.acc[r][c] += w * a;
+                w_reg[r][c] = w;
+                a_reg[r][c] = a;
+            }
+        }
+    }
+
+#ifndef __SYNTHESIS__
+    systolic_stats().passes++;
+    systolic_stats().pe_cycles += (long long)steps * SA_ROWS * SA_COLS;
+#endif
+}
+
+// im2col fill of one activation tile: output pixels (oh, ow0 .. ow0 +
+// SA_COLS - 1) of one output row, one depth step per cycle. Columns past
+// out_w are zero.
+template<int IN_CH, int K, int STRIDE, int IN_H, int IN_W, typename IN_T>
+void systolic_fill_conv(
+    data_t a_tile[SA_MAX_DEPTH][SA_COLS],
+    IN_T input[IN_CH][IN_H][IN_W],
+    int oh,
+    int ow0,
+    int out_w
+) {
+    const int DEPTH = IN_CH * K * K;
+    int ic = 0, kh = 0, kw = 0;
+    for (int k = 0; k < DEPTH; k++) {
+#pragma HLS PIPELINE II=1
+        for (int c = 0; c < SA_COLS; c++) {
+#pragma HLS UNROLL
+            int ow = ow0 + c;
+            a_tile[k][c] = (ow < out_w) ? (data_t)input[ic][oh * STRIDE + kh][ow * STRIDE + kw] : (data_t)0;
+        }
+        if (++kw == K) { kw = 0; if (++kh == K) { kh = 0; ic++; } }
+    }
+}
+
+// Conv layer on the systolic engine
+// Output channels are tiled over the array rows and output pixels over
+// its columns; the IN_CH x K x K window is the reduction depth (im2col).
+// Pixel tiles run along one output row (a partial last tile idles its
+// spare columns), so the SA_COLS pixels of a tile sit at columns STRIDE
+// apart. Each weight tile is loaded once and reused for every pixel tile,
+// and the next activation tile is filled while the engine runs.
+// Matches conv_layer_simple() for the same precision.
+//
+// One weight depth step, one activation depth step and one output pixel
+// per cycle only hold if the caller partitions:
+//   weights: dim 1 cyclic SA_ROWS
+//   input:   dim 3 cyclic SA_COLS * STRIDE
+//   output:  dim 1 cyclic SA_ROWS
+template<int IN_CH, int OUT_CH, int K, int STRIDE,
+         int IN_H = MAX_H, int IN_W = MAX_W, int OUT_H = IN_H, int OUT_W = IN_W,
+         typename P = default_precision>
+void conv_layer_systolic(
+    SystolicTiles& t,
+    typename P::in_type input[IN_CH][IN_H][IN_W],
+    typename P::out_type output[OUT_CH][OUT_H][OUT_W],
+    typename P::weight_type weights[OUT_CH][IN_CH][K][K],
+    int H,
+    int W
+) {
+    const int DEPTH = IN_CH * K * K;
+    int out_h = conv_out_size(H, K, STRIDE);
+    int out_w = conv_out_size(W, K, STRIDE);
+    int row_tiles = (out_w + SA_COLS - 1) / SA_COLS;
+    int tiles = out_h * row_tiles;
+
+    for (int oc0 = 0; oc0 < OUT_CH; oc0 += SA_ROWS) {
+        // Weight tile: rows past OUT_CH stay zero
+        int ic = 0, kh = 0, kw = 0;
+        for (int k = 0; k < DEPTH; k++) {
+#pragma HLS PIPELINE II=1
+            for (int r = 0; r < SA_ROWS; r++) {
+#pragma HLS UNROLL
+                t.w[r][k] = (oc0 + r < OUT_CH) ? (weight_t)weights[oc0 + r][ic][kh][kw] : (weight_t)0;
+            }
+            if (++kw == K) { kw = 0; if (++kh == K) { kh = 0; ic++; } }
+        }
+
+        // The weight tile and the first activation tile stall the array
+        systolic_fill_conv<IN_CH, K, STRIDE>(t.a[0], input, 0, 0, out_w);
+#ifndef __SYNTHESIS__
+        systolic_stall(2 * DEPTH);
+#endif
+
+        int oh = 0, ow0 = 0;
+        for (int i = 0; i < tiles; i++) {
+            // Next tile's position
+            int next_oh = oh, next_ow0 = ow0 + SA_COLS;
+            if (next_ow0 >= out_w) { next_ow0 = 0; next_oh++; }
+            bool more = (i + 1 < tiles);
+
+            // Engine on one buffer while the other is filled (no shared
+            // operands, so the two calls overlap)
+            if (i % 2 == 0) {
+                systolic_engine(t, t.a[0], DEPTH);
+                if (more) systolic_fill_conv<IN_CH, K, STRIDE>(t.a[1], input, next_oh, next_ow0, out_w);
+            } else {
+                systolic_engine(t, t.a[1], DEPTH);
+                if (more) systolic_fill_conv<IN_CH, K, STRIDE>(t.a[0], input, next_oh, next_ow0, out_w);
+            }
+
+            // Write back the valid outputs, one pixel (SA_ROWS channels) per cycle
+            for (int c = 0; c < SA_COLS; c++) {
+#pragma HLS PIPELINE II=1
+                for (int r = 0; r < SA_ROWS; r++) {
+#pragma HLS UNROLL
+                    if (oc0 + r < OUT_CH && ow0 + c < out_w) {
+                        output[oc0 + r][oh][ow0 + c] = (typename P::out_type)relu(t.acc[r][c]);
+                    }
+                }
+            }
+#ifndef __SYNTHESIS__
+            systolic_stall(SA_COLS);
+#endif
+            oh = next_oh;
+            ow0 = next_ow0;
+        }
+    }
+
+#ifndef __SYNTHESIS__
+    systolic_stats().useful_macs += (long long)OUT_CH * out_h * out_w * DEPTH;
+#endif
+}
+
+// Fully connected layer on the systolic engine
+// Output neurons are tiled over the array rows; a single input vector only
+// fills column 0, so FC layers use 1 / SA_COLS of the PEs (they are a small
+// share of the MACs). Each output tile reloads its weights while the array
+// waits. Matches fc_layer() for the same precision.
+template<int IN_FEATURES, int OUT_FEATURES, typename P = default_precision>
+void fc_layer_systolic(
+    SystolicTiles& t,
+    typename P::in_type input[IN_FEATURES],
+    typename P::out_type output[OUT_FEATURES],
+    typename P::weight_type weights[OUT_FEATURES][IN_FEATURES],
+    bias_t bias[OUT_FEATURES],
+    bool apply_relu = true
+) {
+    for (int k = 0; k < IN_FEATURES; k++) {
+#pragma HLS PIPELINE II=1
+        t.a[0][k][0] = (data_t)input[k];
+        for (int c = 1; c < SA_COLS; c++) {
+            t.a[0][k][c] = 0;
+        }
+    }
+#ifndef __SYNTHESIS__
+    systolic_stall(IN_FEATURES);
+#endif
+
+    for (int o0 = 0; o0 < OUT_FEATURES; o0 += SA_ROWS) {
+        for (int k = 0; k < IN_FEATURES; k++) {
+#pragma HLS PIPELINE II=1
+            for (int r = 0; r < SA_ROWS; r++) {
+#pragma HLS UNROLL
+                t.w[r][k] = (o0 + r < OUT_FEATURES) ? (weight_t)weights[o0 + r][k] : (weight_t)0;
+            }
+        }
+
+        systolic_engine(t, t.a[0], IN_FEATURES);
+
+        for (int r = 0; r < SA_ROWS; r++) {
+#pragma HLS PIPELINE II=1
+            if (o0 + r < OUT_FEATURES) {
+                output[o0 + r] = (typename P::out_type)fc_output(bias[o0 + r] + t.acc[r][0], apply_relu);
+            }
+        }
+#ifndef __SYNTHESIS__
+        systolic_stall(IN_FEATURES + SA_ROWS);
+#endif
+    }
+
+#ifndef __SYNTHESIS__
+    systolic_stats().useful_macs += (long long)OUT_FEATURES * IN_FEATURES;
+#endif
+}
+
+#endif // CNN_SYSTOLIC_H
@@ -1,52 +1,204 @@
 #ifndef CNN_TYPES_H
 #define CNN_TYPES_H
 
+#include <stdint.h>
 #include <ap_int.h>
 #include <hls_stream.h>
+#include <ap_axi_sdata.h>
 
 // Data type definitions
 typedef ap_int<8>   data_t;    // 8-bit signed data
 typedef ap_int<8>   weight_t;  // 8-bit signed weights
 typedef ap_int<32>  acc_t;     // 32-bit accumulator
+typedef ap_int<8>   bias_t;    // 8-bit signed FC bias (as stored in the blob)
 
-// Network architecture constants
-#define MAX_H 128
-#define MAX_W 128
+// int4 weight mode: two signed 4-bit weights per byte, low nibble first.
+// Each layer has its own integer scale: an int4 weight w stands for
+// w * scale on the int8 scale, so biases, activations and requantization
+// are unchanged. The scale is picked per layer at packing time from the
+// layer's max |w| (choose_weight4_scale()) and stored in the model file.
+typedef ap_int<4>   weight4_t; // 4-bit signed weight
+typedef ap_uint<8>  wpack_t;   // two packed weight4_t
+typedef ap_uint<5>  wscale4_t; // per-layer int4 weight scale, 1..WEIGHT4_SCALE_MAX
+#define WEIGHT4_SCALE_MAX 18   // 7 * 18 = 126 keeps w4 * scale within int8
+#define INT4_LAYERS 5          // CONV1, CONV2, CONV3, FC1, FC2
+#define WPACK_LEN(n) (((n) + 1) / 2)   // bytes for a row of n int4 weights
 
-// Layer 1: CONV1 + ReLU (3->16 channels, 3x3 kernel)
-#define CONV1_IN_CH 3
-#define CONV1_OUT_CH 16
-#define CONV1_K 3
+// Per-layer precision bundle: input activation, weight, accumulator and
+// output activation types. Kernels take one as their last template
+// parameter; default_precision is the plain 8x8->32 arithmetic.
+template<typename IN_T, typename WEIGHT_T, typename ACC_T, typename OUT_T = IN_T>
+struct layer_precision {
+    typedef IN_T     in_type;
+    typedef WEIGHT_T weight_type;
+    typedef ACC_T    acc_type;
+    typedef OUT_T    out_type;
+};
+typedef layer_precision<data_t, weight_t, acc_t> default_precision;
 
-// Layer 2: AvgPool (2x2, stride 2)
-#define POOL1_SIZE 2
+// Compile-time accumulator bounds
+// A sum of MACS products of IN_T x WEIGHT_T plus a bias of at most
+// BIAS_MAX never exceeds MACS * max|in| * max|w| + BIAS_MAX, so its
+// signed width is known at compile time. acc_select picks the narrowest
+// accumulator: a native int16_t where 16 bits provably suffice (two
+// lanes per 32-bit SIMD slot on host, one DSP per MAC on FPGA), else an
+// exact-width ap_int.
+template<typename T> struct type_range;
+template<int W> struct type_range<ap_int<W> > { static const long long max_abs = 1LL << (W - 1); static const int width = W; };
+template<int W> struct type_range<ap_uint<W> > { static const long long max_abs = (1LL << W) - 1; static const int width = W; };
 
-// Layer 3: CONV2 + ReLU (16->32 channels, 3x3 kernel)
-#define CONV2_IN_CH 16
-#define CONV2_OUT_CH 32
-#define CONV2_K 3
+template<unsigned long long N> struct bit_length { static const int value = 1 + bit_length<N / 2>::value; };
+template<> struct bit_length<0> { static const int value = 0; };
 
-// Layer 4: AvgPool (2x2, stride 2)
-#define POOL2_SIZE 2
+template<typename IN_T, typename WEIGHT_T, long long MACS, long long BIAS_MAX = 0>
+struct acc_bound {
+    static const long long max_abs =
+        MACS * type_range<IN_T>::max_abs * type_range<WEIGHT_T>::max_abs + BIAS_MAX;
+    static const int bits = bit_length<max_abs>::value + 1;   // + sign bit
+};
 
-// Layer 5: CONV3 + ReLU (32->32 channels, 3x3 kernel, stride 2)
-#define CONV3_IN_CH 32
-#define CONV3_OUT_CH 32
-#define CONV3_K 3
-#define CONV3_STRIDE 2
+template<int BITS, bool FITS_INT16 = (BITS <= 16)> struct acc_select { typedef ap_int<BITS> type; };
+template<int BITS> struct acc_select<BITS, true> { typedef int16_t type; };
 
-// Layer 6: MaxPool (2x2, stride 2)
-#define POOL3_SIZE 2
+// layer_precision with the accumulator derived from the layer's MAC depth
+template<typename IN_T, typename WEIGHT_T, long long MACS, typename OUT_T = IN_T, long long BIAS_MAX = 0>
+struct bounded_precision : layer_precision<IN_T, WEIGHT_T,
+        typename acc_select<acc_bound<IN_T, WEIGHT_T, MACS, BIAS_MAX>::bits>::type, OUT_T> {
+    static const int acc_bits = acc_bound<IN_T, WEIGHT_T, MACS, BIAS_MAX>::bits;
+};
 
-// Layer 7: Flatten -> FC1 (1024->256)
-#define FC1_IN 1024
-#define FC1_OUT 256
+// Network architecture constants (shared with the C benchmarks)
+#include "cnn_arch.h"
 
-// Layer 8: Dropout (keep for compatibility, p=0.5)
-// No-op in inference
+// Per-layer precision used by cnn_network(). Post-ReLU activations are
+// 0..127 and fit in 7 unsigned bits. Accumulators come from acc_bound
+// (FC layers include a bias_t bias), so results are bit-exact with
+// default_precision everywhere. The bias ports are bias_t, so FC_BIAS_MAX
+// is enforced by the type rather than trusted from the caller.
+#define FC_BIAS_MAX 128
+static_assert(type_range<bias_t>::max_abs <= FC_BIAS_MAX,
+              "FC bias type exceeds the bound the FC accumulators are sized for");
+typedef ap_uint<7>  act_t;     // post-ReLU activation
+typedef bounded_precision<data_t, weight_t, CONV1_IN_CH * CONV1_K * CONV1_K, act_t> conv1_precision;
+typedef bounded_precision<act_t,  weight_t, CONV2_IN_CH * CONV2_K * CONV2_K, act_t> conv2_precision;
+typedef bounded_precision<act_t,  weight_t, CONV3_IN_CH * CONV3_K * CONV3_K, act_t> conv3_precision;
+typedef bounded_precision<act_t,  weight_t, FC1_IN, act_t, FC_BIAS_MAX> fc1_precision;
+typedef bounded_precision<act_t,  weight_t, FC2_IN, data_t, FC_BIAS_MAX> fc2_precision;
 
-// Layer 9: FC2 (256->4)
-#define FC2_IN 256
-#define FC2_OUT 4
+// int4 weight mode (cnn_network_int4()): int4 products are accumulated
+// before the per-layer scale is applied, so CONV1 fits an int16 accumulator.
+typedef layer_precision<data_t, weight4_t, acc_t> int4_precision;
+typedef bounded_precision<data_t, weight4_t, CONV1_IN_CH * CONV1_K * CONV1_K> conv1_int4_precision;
+typedef bounded_precision<data_t, weight4_t, CONV2_IN_CH * CONV2_K * CONV2_K> conv2_int4_precision;
+typedef bounded_precision<data_t, weight4_t, CONV3_IN_CH * CONV3_K * CONV3_K> conv3_int4_precision;
+typedef bounded_precision<data_t, weight4_t, FC1_IN> fc1_int4_precision;
+typedef bounded_precision<data_t, weight4_t, FC2_IN> fc2_int4_precision;
+
+// Weight-ROM conv (cnn_network_rom()): input channels per pipelined MAC
+// step. Each output pixel takes IN_CH / UNROLL cycles at UNROLL * K * K
+// MACs per cycle; the defaults (full unroll) target II=1 per pixel with
+// 27/144/288 parallel MACs. Lower them to trade II for DSPs; each can be
+// overridden with -D (tools/hls_dse.py explores them).
+#ifndef CONV1_MAC_UNROLL
+#define CONV1_MAC_UNROLL CONV1_IN_CH
+#endif
+#ifndef CONV2_MAC_UNROLL
+#define CONV2_MAC_UNROLL CONV2_IN_CH
+#endif
+#ifndef CONV3_MAC_UNROLL
+#define CONV3_MAC_UNROLL CONV3_IN_CH
+#endif
+
+// FC1 weights streamed from DDR (fc_layer_ddr(), cnn_network_ddr()):
+// m_axi words of WWORD_WEIGHTS int8 weights (little-endian, row-major),
+// fetched FC1_TILE_ROWS output rows at a time into one of two on-chip
+// buffers (2 x 16 KB instead of the 256 KB matrix).
+typedef ap_uint<64> wword_t;
+#define WWORD_WEIGHTS 8
+#define FC1_TILE_ROWS 16
+#define FC1_DDR_WORDS (FC1_OUT * FC1_IN / WWORD_WEIGHTS)
+
+// Loop-tiled conv (conv_layer_tiled()): output rows and output channels
+// per tile. The full input map is read once per row tile instead of once
+// per output channel.
+#define CONV_TILE_ROWS 8
+#define CONV_TILE_OC 8
+
+// DSP packing (dsp_pack in cnn_utils.h): two int8 MACs that share a weight
+// in one DSP48E1 multiply. Two activations are packed into the 25-bit A
+// port; the weight uses the 18-bit B port and packed products accumulate in
+// the 48-bit P register. CONV_DSP_PACK is the default for conv_layer_simple():
+// off, since the packed path is ~3.5x slower in C-simulation; HLS builds opt
+// in with -DCONV_DSP_PACK=true.
+#define DSP_A_BITS 25
+#ifndef CONV_DSP_PACK
+#define CONV_DSP_PACK false
+#endif
+typedef ap_int<48> dsp_acc_t;
+
+// Systolic MAC engine (cnn_systolic.h, cnn_network_systolic()): one
+// SA_ROWS x SA_COLS array of int8 PEs shared by every conv and FC layer.
+// Rows take output channels/neurons, columns output pixels; the reduction
+// depth (IN_CH * K * K, or FC inputs) streams through it.
+#define SA_ROWS 8
+#define SA_COLS 8
+#define SA_MAX_DEPTH FC1_IN
+
+// Coarse-grained frame pipeline (cnn_network_pipeline()): four layer-group
+// stages with ping-pong buffers between them, up to PIPE_MAX_FRAMES frames
+// per call.
+#define PIPE_STAGES 4
+#define PIPE_MAX_FRAMES 16
+
+// Early-exit cascade gate: global average pool over POOL1 -> 1 score.
+// POOL1 is the cheapest useful exit: CONV2 alone is ~60% of all MACs.
+// Tiles scoring below the threshold are rejected before CONV2. The
+// default is the threshold tools/train_gate.py places the bias for and
+// checks on held-out tiles (see ship_gate_weights.h).
+#define GATE_IN CONV1_OUT_CH
+#define GATE_OUT 1
+#define GATE_THRESHOLD_DEFAULT 0
+typedef bounded_precision<act_t, weight_t, GATE_IN, data_t, FC_BIAS_MAX> gate_precision;
+
+// Scene mode: the conv/pool trunk runs once over a large image and the
+// FC head is evaluated at every MAX_H x MAX_W window position.
+// Windows step by the trunk's total downsampling (2*2*2*2 = 16) so each
+// window lines up exactly with a cell of the POOL3 output grid.
+#define SCENE_MAX_H 512
+#define SCENE_MAX_W 512
+#define SCENE_STRIDE 16
+#define SCENE_MAX_WIN_H ((SCENE_MAX_H - MAX_H) / SCENE_STRIDE + 1)
+#define SCENE_MAX_WIN_W ((SCENE_MAX_W - MAX_W) / SCENE_STRIDE + 1)
+
+// Streaming scene mode: rows arrive in bands of SCENE_STRIDE rows, so
+// memory scales with scene width only. A window row completes at most once
+// per band. The line-buffer rings take about 145 bytes per pixel of width
+// (~145 KB, ~65 BRAM_18K at 1024), sized to leave the rest of an xc7z020
+// for the FC weights. cnn_scene_stream_scan() splits wider scenes into
+// strips of STREAM_MAX_W columns overlapping by MAX_W - SCENE_STRIDE.
+#define STREAM_MAX_W 1024
+#define STREAM_BAND_H SCENE_STRIDE
+#define STREAM_MAX_WIN_W ((STREAM_MAX_W - MAX_W) / SCENE_STRIDE + 1)
+#define STREAM_STRIP_STEP (STREAM_MAX_W - (MAX_W - SCENE_STRIDE))
+
+// cnn_scene_stream_band() *win_row values other than a window row index
+#define STREAM_NO_ROW       (-1)   // band consumed, no window row completed
+#define STREAM_BAD_GEOMETRY (-2)   // W or band_rows out of range, nothing read
+
+// AXI4-Stream top (cnn_network_axis): frames arrive as the camera/DMA
+// byte stream (HWC uint8, like SHIP_DETECTOR_INPUT), AXIS_BYTES pixels per
+// beat, little-endian, TLAST on the last beat. Each frame answers with one
+// beat holding the FC2_OUT int8 scores. Weights are read over m_axi from a
+// blob in the SHIP_DETECTOR_WEIGHTS layout, packed WWORD_WEIGHTS per wword_t
+// (every tensor is a whole number of words).
+typedef ap_axiu<32, 1, 1, 1> axis_word_t;
+#define AXIS_BYTES 4
+#define AXIS_FRAME_BEATS (CONV1_IN_CH * MAX_H * MAX_W / AXIS_BYTES)
+#define AXIS_WEIGHT_LEN (CONV1_OUT_CH * CONV1_IN_CH * CONV1_K * CONV1_K + \
+                         CONV2_OUT_CH * CONV2_IN_CH * CONV2_K * CONV2_K + \
+                         CONV3_OUT_CH * CONV3_IN_CH * CONV3_K * CONV3_K + \
+                         FC1_OUT * FC1_IN + FC2_OUT * FC2_IN)
+#define AXIS_WEIGHT_WORDS (AXIS_WEIGHT_LEN / WWORD_WEIGHTS)
+#define AXIS_BIAS_LEN (FC1_OUT + FC2_OUT)
 
 #endif // CNN_TYPES_H
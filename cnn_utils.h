@@ -11,6 +11,33 @@ inline data_t relu(acc_t x) {
     return (data_t)x;
 }
 
+// Two MACs per multiplier for a weight shared by two activations
+// pack(hi, lo) = hi * 2^shift + lo fills the DSP's A port, so
+// w * pack(hi, lo) = (w * hi) * 2^shift + w * lo. Up to `chain` such products
+// can be summed before the low field can overflow; accumulate() then splits
+// the fields. The low field is sign-extended and the high field is
+// corrected for the borrow of a negative low field ((p - lo) >> shift).
+// shift leaves room for a signed hi plus a borrow from lo: 17 for post-ReLU
+// act_t (chain 4), 16 for signed int8 (chain 1).
+template<typename IN_T, typename W_T>
+struct dsp_pack {
+    static const int shift = DSP_A_BITS - 1 - type_range<IN_T>::width;
+    static const int chain = (int)(((1LL << (shift - 1)) - 1) /
+        (type_range<IN_T>::max_abs * type_range<W_T>::max_abs));
+    typedef ap_int<DSP_A_BITS> operand_t;
+
+    static operand_t pack(IN_T hi, IN_T lo) {
+        return ((operand_t)hi << shift) + lo;
+    }
+
+    template<typename ACC_T>
+    static void accumulate(dsp_acc_t p, ACC_T& hi, ACC_T& lo) {
+        ap_int<shift> low = p.range(shift - 1, 0);
+        hi += (ACC_T)((p - low) >> shift);
+        lo += (ACC_T)low;
+    }
+};
+
 // Debug print for feature map statistics
 inline void print_feature_map_stats(const char* layer_name, data_t* data, int size) {
 #ifndef __SYNTHESIS__
@@ -42,4 +69,45 @@ inline int pool_out_size(int in_size, int pool_size, int stride) {
     return (in_size / stride);
 }
 
+// Half-open output range [*lo, *hi) of a conv whose input changed in [a, b)
+inline void conv_dirty_range(int a, int b, int kernel, int stride, int out_size, int *lo, int *hi) {
+    if (b <= a) { *lo = *hi = 0; return; }
+    int first = a - kernel + 1;
+    *lo = (first <= 0) ? 0 : (first + stride - 1) / stride;
+    *hi = (b - 1) / stride + 1;
+    if (*hi > out_size) *hi = out_size;
+    if (*lo > *hi) *lo = *hi;
+}
+
+// Half-open output range [*lo, *hi) of a pool whose input changed in [a, b)
+inline void pool_dirty_range(int a, int b, int pool_size, int out_size, int *lo, int *hi) {
+    if (b <= a) { *lo = *hi = 0; return; }
+    *lo = a / pool_size;
+    *hi = (b - 1) / pool_size + 1;
+    if (*hi > out_size) *hi = out_size;
+    if (*lo > *hi) *lo = *hi;
+}
+
+// Spatial size after the CONV1..POOL3 trunk (128 -> 7)
+inline int trunk_out_size(int in_size) {
+    int s = conv_out_size(in_size, CONV1_K, 1);
+    s = pool_out_size(s, POOL1_SIZE, POOL1_SIZE);
+    s = conv_out_size(s, CONV2_K, 1);
+    s = pool_out_size(s, POOL2_SIZE, POOL2_SIZE);
+    s = conv_out_size(s, CONV3_K, CONV3_STRIDE);
+    return pool_out_size(s, POOL3_SIZE, POOL3_SIZE);
+}
+
+// Number of window positions along one scene axis (0 if smaller than a tile)
+inline int scene_window_count(int scene_size, int window = MAX_H, int stride = SCENE_STRIDE) {
+    if (scene_size < window) return 0;
+    return ((scene_size - window) / stride) + 1;
+}
+
+// Weight i of a packed int4 row (sign-extended nibble)
+inline weight4_t weight4_at(const wpack_t row[], int i) {
+    wpack_t byte = row[i / 2];
+    return (i & 1) ? (weight4_t)byte.range(7, 4) : (weight4_t)byte.range(3, 0);
+}
+
 #endif // CNN_UTILS_H
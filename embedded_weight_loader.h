@@ -4,6 +4,7 @@
 #include <iostream>
 #include <cstdint>
 #include "cnn_types.h"
+#include "cnn_fc.h"
 
 // Forward declaration - this will be in ship_weights.h (generated)
 extern const int8_t SHIP_DETECTOR_WEIGHTS[];
@@ -70,9 +71,114 @@ public:
         }
     }
     
+    // Load dense FC weights and emit them block-sparse (all-zero blocks dropped)
+    // Returns false if more than MAX_NNZ_BLOCKS blocks are non-zero.
+    template<int OUT_FEATURES, int IN_FEATURES, int BLOCK, int MAX_NNZ_BLOCKS>
+    bool load_fc_weights_sparse(fc_block_sparse<OUT_FEATURES, IN_FEATURES, BLOCK, MAX_NNZ_BLOCKS> &weights) {
+        const int blocks_per_row = IN_FEATURES / BLOCK;
+        size_t start = current_offset;
+
+        weights.nnz_blocks = 0;
+        for (int out = 0; out < OUT_FEATURES; out++) {
+            weights.row_ptr[out] = weights.nnz_blocks;
+            for (int blk = 0; blk < blocks_per_row; blk++) {
+                const int8_t* src = &weights_ptr[current_offset + blk * BLOCK];
+                bool nonzero = false;
+                for (int k = 0; k < BLOCK; k++) {
+                    if (src[k] != 0) nonzero = true;
+                }
+                if (!nonzero) continue;
+                if (weights.nnz_blocks == MAX_NNZ_BLOCKS) {
+                    std::cout << "  ✗ FC (block-sparse " << BLOCK << "): more than " << MAX_NNZ_BLOCKS
+                              << " non-zero blocks (offset " << start << ")" << std::endl;
+                    return false;
+                }
+
+                weights.col_block[weights.nnz_blocks] = blk;
+                for (int k = 0; k < BLOCK; k++) {
+                    weights.values[weights.nnz_blocks][k] = src[k];
+                }
+                weights.nnz_blocks++;
+            }
+            current_offset += IN_FEATURES;
+        }
+        weights.row_ptr[OUT_FEATURES] = weights.nnz_blocks;
+
+        std::cout << "  Loading FC (block-sparse " << BLOCK << "): " << OUT_FEATURES << "×" << IN_FEATURES
+                  << ", kept " << weights.nnz_blocks << " of " << OUT_FEATURES * blocks_per_row
+                  << " blocks (offset " << start << ")" << std::endl;
+        return true;
+    }
+
+    // Load FC weights stored in the packed block-sparse format
+    // (see pack_fc_block_sparse below). Returns false if the file holds
+    // more than MAX_NNZ_BLOCKS blocks or a block index past IN_FEATURES.
+    template<int OUT_FEATURES, int IN_FEATURES, int BLOCK, int MAX_NNZ_BLOCKS>
+    bool load_fc_weights_packed(fc_block_sparse<OUT_FEATURES, IN_FEATURES, BLOCK, MAX_NNZ_BLOCKS> &weights) {
+        size_t start = current_offset;
+
+        weights.nnz_blocks = 0;
+        for (int out = 0; out < OUT_FEATURES; out++) {
+            weights.row_ptr[out] = weights.nnz_blocks;
+            int count = (uint8_t)weights_ptr[current_offset++];
+            if (weights.nnz_blocks + count > MAX_NNZ_BLOCKS) {
+                std::cout << "  ✗ FC (packed block-sparse " << BLOCK << "): more than " << MAX_NNZ_BLOCKS
+                          << " blocks (offset " << start << ")" << std::endl;
+                return false;
+            }
+            for (int i = 0; i < count; i++) {
+                int blk = (uint8_t)weights_ptr[current_offset++];
+                if (blk >= IN_FEATURES / BLOCK) {
+                    std::cout << "  ✗ FC (packed block-sparse " << BLOCK << "): block index " << blk
+                              << " out of range (offset " << start << ")" << std::endl;
+                    return false;
+                }
+                weights.col_block[weights.nnz_blocks + i] = blk;
+            }
+            for (int i = 0; i < count; i++) {
+                for (int k = 0; k < BLOCK; k++) {
+                    weights.values[weights.nnz_blocks + i][k] = weights_ptr[current_offset++];
+                }
+            }
+            weights.nnz_blocks += count;
+        }
+        weights.row_ptr[OUT_FEATURES] = weights.nnz_blocks;
+
+        std::cout << "  Loading FC (packed block-sparse " << BLOCK << "): " << weights.nnz_blocks
+                  << " blocks, " << (current_offset - start) << " bytes (offset " << start << ")" << std::endl;
+        return true;
+    }
+
+    // Load int4 weights from a packed model file: the layer's scale byte,
+    // then ROWS rows of COLS weights, each row WPACK_LEN(COLS) bytes (see
+    // pack_weights_int4 below). Conv kernels are one row per output
+    // channel. Returns false on a scale outside 1..WEIGHT4_SCALE_MAX.
+    template<int ROWS, int COLS>
+    bool load_weights_int4(wpack_t weights[ROWS][WPACK_LEN(COLS)], wscale4_t &scale) {
+        int s = (uint8_t)weights_ptr[current_offset];
+        if (s < 1 || s > WEIGHT4_SCALE_MAX) {
+            std::cout << "  ✗ INT4 scale " << s << " out of range (offset "
+                      << current_offset << ")" << std::endl;
+            return false;
+        }
+        scale = s;
+        current_offset++;
+
+        std::cout << "  Loading INT4: " << ROWS << "×" << COLS << " = " << ROWS * COLS
+                  << " weights in " << ROWS * WPACK_LEN(COLS) << " bytes, scale " << s
+                  << " (offset " << current_offset << ")" << std::endl;
+
+        for (int r = 0; r < ROWS; r++) {
+            for (int b = 0; b < WPACK_LEN(COLS); b++) {
+                weights[r][b] = (uint8_t)weights_ptr[current_offset++];
+            }
+        }
+        return true;
+    }
+
     // Load biases
     template<int SIZE>
-    void load_bias(acc_t bias[SIZE]) {
+    void load_bias(bias_t bias[SIZE]) {
         std::cout << "  Loading BIAS: " << SIZE << " values (offset " 
                   << current_offset << ")" << std::endl;
         
@@ -88,6 +194,95 @@ public:
     size_t get_offset() const { return current_offset; }
 };
 
+// Packed block-sparse FC weights for model files, per output row:
+//   [block count][count x block index][count x BLOCK int8 weights]
+// Counts and indices are stored as uint8 (IN_FEATURES / BLOCK <= 255).
+// Returns the packed size; pass out = NULL to only measure it.
+template<int OUT_FEATURES, int IN_FEATURES, int BLOCK, int MAX_NNZ_BLOCKS>
+size_t pack_fc_block_sparse(
+    const fc_block_sparse<OUT_FEATURES, IN_FEATURES, BLOCK, MAX_NNZ_BLOCKS> &weights,
+    int8_t* out
+) {
+    static_assert(IN_FEATURES / BLOCK <= 255, "block counts and indices are packed as uint8");
+    size_t n = 0;
+    for (int row = 0; row < OUT_FEATURES; row++) {
+        int first = weights.row_ptr[row];
+        int count = weights.row_ptr[row + 1] - first;
+
+        if (out) out[n] = (int8_t)(uint8_t)count;
+        n++;
+        for (int i = 0; i < count; i++, n++) {
+            if (out) out[n] = (int8_t)(uint8_t)weights.col_block[first + i];
+        }
+        for (int i = 0; i < count; i++) {
+            for (int k = 0; k < BLOCK; k++, n++) {
+                if (out) out[n] = (int8_t)weights.values[first + i][k];
+            }
+        }
+    }
+    return n;
+}
+
+// Round an int8 weight to int4 at the given scale (w8 ~ w4 * scale), to
+// nearest with ties away from zero, saturating at +-7. The code range is
+// kept symmetric (-8 is unused): post-ReLU inputs are all non-negative, so
+// clipping one sign harder than the other would bias every sum.
+inline int quantize_weight4(int8_t w, int scale) {
+    int q = (w >= 0) ? (2 * w + scale) / (2 * scale) : -((-2 * w + scale) / (2 * scale));
+    if (q > 7) q = 7;
+    if (q < -7) q = -7;
+    return q;
+}
+
+// Per-layer int4 scale from the layer's max |w| (per-tensor max-abs
+// scaling): the +-7 codes plus half a step of rounding cover it, i.e.
+// scale = round(max|w| / 7.5), within 1..WEIGHT4_SCALE_MAX.
+inline int choose_weight4_scale(const int8_t* src, size_t count) {
+    int max_abs = 0;
+    for (size_t i = 0; i < count; i++) {
+        int a = src[i] < 0 ? -src[i] : src[i];
+        if (a > max_abs) max_abs = a;
+    }
+    int scale = (2 * max_abs + 7) / 15;
+    if (scale < 1) scale = 1;
+    if (scale > WEIGHT4_SCALE_MAX) scale = WEIGHT4_SCALE_MAX;
+    return scale;
+}
+
+// Quantize a rows x cols int8 weight matrix to int4 and pack it for the
+// model file: one scale byte (choose_weight4_scale()), then the rows, two
+// weights per byte (low nibble first). Rows with an odd length are padded
+// with a zero nibble. Returns the packed size.
+inline size_t pack_weights_int4(const int8_t* src, int rows, int cols, int8_t* out) {
+    int row_bytes = WPACK_LEN(cols);
+    int scale = choose_weight4_scale(src, (size_t)rows * cols);
+    out[0] = (int8_t)scale;
+    out++;
+    for (int r = 0; r < rows; r++) {
+        for (int b = 0; b < row_bytes; b++) {
+            int lo = quantize_weight4(src[r * cols + 2 * b], scale);
+            int hi = (2 * b + 1 < cols) ? quantize_weight4(src[r * cols + 2 * b + 1], scale) : 0;
+            out[r * row_bytes + b] = (int8_t)(uint8_t)((lo & 0xF) | ((hi & 0xF) << 4));
+        }
+    }
+    return 1 + (size_t)rows * row_bytes;
+}
+
+// View an int8 weight matrix as the m_axi words fc_layer_ddr() reads:
+// WWORD_WEIGHTS weights per word, first weight in the low byte (the same
+// bytes a little-endian host leaves in DDR). Returns the word count.
+inline size_t pack_weight_words(const int8_t* src, size_t count, wword_t* out) {
+    size_t words = count / WWORD_WEIGHTS;
+    for (size_t w = 0; w < words; w++) {
+        wword_t word = 0;
+        for (int b = 0; b < WWORD_WEIGHTS; b++) {
+            word |= (wword_t)(uint8_t)src[w * WWORD_WEIGHTS + b] << (8 * b);
+        }
+        out[w] = word;
+    }
+    return words;
+}
+
 // Load embedded input image
 bool load_embedded_input(
     const uint8_t* input_data,
@@ -0,0 +1,1079 @@
+#ifndef SHIP_CONV_ROM_H
+#define SHIP_CONV_ROM_H
+
+#include "cnn_types.h"
+
+/*
+ * Auto-generated by tools/weights_to_rom.py from ship_weights.h
+ * Conv weights as initialized const arrays (on-chip ROMs in HLS)
+ */
+
+// CONV1: [16][3][3][3] (OUT_CH, IN_CH, K, K)
+static const weight_t CONV1_ROM[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K] = {
+    { // oc 0
+           4,   39,   53,   71,   -2,   -3,  -58,   36,  -43,  -90,  -85,   -4,   72,  -89,   43,  -91,
+          12, -118,   79,  -22,  101,   48,  -55,   78,   81,   80,   18
+    },
+    { // oc 1
+          61,   14,  -49,   79,   22,   77,   56,  -30,  101,   96,   48, -121,  -38,   93, -116,  -31,
+         -59,  109, -120,   90,   71,  115, -126,   67,  -74,  -43,   61
+    },
+    { // oc 2
+         -67,   41,  122,   51,   30,  115,  -27, -128,  -33,  122,   22,   78,   10,   32, -112,   -7,
+          84,   46,   -4,   80,  -40,   51, -110,  -91,  -30,   48, -119
+    },
+    { // oc 3
+         -82,  -87,  -20,  -76,  -48,   56,  -35,   12, -115,   59, -126,  -23,  -59,  -37,  -48,  -97,
+          56,  -42, -114,   32, -125,  -86,   87, -106,  103,  -98,   14
+    },
+    { // oc 4
+          47,   70, -113,  -89,  118, -122,  -93,  -69,   27,  -94,   28,  -65, -114,  -37,  -81,  -27,
+         -43,  -74,   -8,   99,    1,  -42, -106,   60,  123,  -43, -127
+    },
+    { // oc 5
+          20,  -87, -100,    7,   98,   36,  112, -123,  126,  -88,   24,  -78,  -30,   20,   89,  -76,
+          39,  -47,  -25,   34, -121,  -17,  -55,    7, -115,   48,  -33
+    },
+    { // oc 6
+         110,   64,  -25,  -15,   96,  -75, -116,  -48,   32,  -84,  -35,  108,  -71,   26,  -66, -122,
+         -80,   74,   90,    9,  -47, -103,  -43,   68,  117,  -98,  -67
+    },
+    { // oc 7
+        -114,   49,  -39,   49,  -13,  -61,  -80,   15,   63,  -52,  -24, -112,  -39,  -64,  120,   31,
+          19,   67,   26,  -29,  108,  -59,  -43,  -65,  -46,   36,  -98
+    },
+    { // oc 8
+         -12,  -73,  -36,  -18,  -40,  110,   16,   58,   90,   73,   86,   93,  -63,   60,    7,   98,
+        -101,  -59,  -84,   67,  -64,  -26,  -68,  -95,   98,   -2,  100
+    },
+    { // oc 9
+          63,  -51,   52,    5,  101, -126,   20,  -15,   52, -103,  -36,  116,   -5,   76,  120,  -32,
+         114,  -63,   40,   71,  -46,   -1,  -37,  -30,  -41,   42,   25
+    },
+    { // oc 10
+         114,   70,  -86, -116,   34,  -53,   56,   49,  -26,   20,   -1,   66,    0, -103,  121,  109,
+         -96,   -7,  114, -113,  -73, -115,    1,  -17,  -60,  -73,  -90
+    },
+    { // oc 11
+          87,   96,  -91,  -22,  -31, -111,  -91,   18,  123,  -68,   88,    6,  -60,  -86,  -62, -108,
+         -53, -120,  -28,  -35,  125,    8,  -97,   37,   65,   63,   61
+    },
+    { // oc 12
+          23,   48,   67,   -1,  -34, -107,  -17,  112,   16,   38,   97,  -20, -108, -125,  -78,   75,
+          56,  116,  110, -125,  101,   -1,  -24,  -37,  -70,    4,  -54
+    },
+    { // oc 13
+          65,   -2, -100,  121,   16,   24,   93,  -22,   56,   34,   75,   27,  -92,  116, -101,   39,
+         103,  -93, -124,  -48,  -34,   89,  -67,  -52,  121,    8,  -84
+    },
+    { // oc 14
+         -79, -122,   49,   83, -112,   17,  -39,  106,   31,   17,   81,   48,  109,  -73,  124,  -80,
+        -106,   56,   43, -125,   81,   47,   71,   22, -100,   44,   80
+    },
+    { // oc 15
+          14,  -71,  -90,  -99, -101,  123, -119, -101, -116,  -88,   92,  -32,   20,   10,  -69,  -87,
+          61, -110,   77,  -52, -108, -126,    9, -119,   -2,  -12,  -51
+    }
+};
+
+// CONV2: [32][16][3][3] (OUT_CH, IN_CH, K, K)
+static const weight_t CONV2_ROM[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K] = {
+    { // oc 0
+        -102,   -9,   -4, -116,   75,   61,   -5,   15,   99,   61,   90, -119,  111,  -94,   18, -111,
+         107,   55,   60,  124,  -18,  -78,    0,  -20,  -95,  124,   27,  -74,  102,   73,  -98,   41,
+         -40,  115,  118, -114,  -29,   15,    7,   29,  -19,   98,  115,  -71,   63,   81,   52,  -94,
+         -13,   44,   47,  -54,  -95,   62,  -68,  -91,   87,   25,  116,  -22,  -11,  -66,   83,  -75,
+          85,   48,  109,   52,  -21,   53,   16,  -69,   44,  -28,  -65,  -57,  110,  -63,   56,   88,
+         -51,    6,  -99,   91,  -16,   16,   31,   84,  -53,  -70,  114, -119,  -51,   46, -111,  118,
+           3,  -18,  -12,  111,  -30,  -62,   51,  -41,   47,   85,  -90,  115,  -61,   61,  -83,   80,
+          98,  105,   98,   14,   57,   38,   -5,  -78,  104,  112,  -44,  -15,    1,    6,  -90,   67,
+         106,   38,   13,   11, -106,   35,   27,   38,   31,  -36, -107,  -40,   47,  -32,  -10, -128
+    },
+    { // oc 1
+         100,    9,  106,   83, -119,  121,  114,   54,   33,   77,  -69,  -82,  -20,   65,   83, -124,
+         -28,   90,  -18,  -68,   89,  -65, -121,  -65,   55,   55,   93,   18,  -80,  -28,   35,  -47,
+         109,  -57,  -55,  -81,  -18,   68,   99,    6,  -64, -105, -100,   51,   26, -122,   23,  -73,
+          74,   54,  123,  -99,   58,   22,   67, -123,  -78,  -69,   70,  -94,  -10,   28,  -36,   51,
+          66,   41,   24,   37,  -59,  123,  -91,  -67,    3,   59,  -38, -109,  -36,   -2, -121,   86,
+          53,  -91,  -62,   98, -110,    5,   92,  -45,   53,  -26,   17,   23,  106, -115,   27,  -82,
+         -65,   45,   54,  -59,  -99,   35,   38,   98,   17,   14,  -57,   73,   24,  -58,  -60,  115,
+         104,  105,   41, -101,  123,   64,   80,   44,   65,   -9,  -83,  -90,   17,  -54, -118,  -70,
+          50,  115,  116,   65, -123,   69,   39,  -89,  -78,   -6,  -18,    6,  -20,  -81,   67,   -5
+    },
+    { // oc 2
+          14,  -84,  -40,   12,  -11,  -53,  -10, -128,  -80,   -2, -100,   24,  -67,   74, -122,   12,
+          90,   85, -119,    1,   90,  -81,  -33,   -4,   33,   56,  -77,   63, -121,  -49,  -28,   66,
+          -5,  -78,   -6,   51,  116,  -46,   -6,  -47,  -82,   15,  -30,   13,  117,  -81,  -95,   38,
+         -85,   68,    0, -124,   94,  -38,   80,   80,  122,  -65,   83,   48,  126,   47,  -54,  -70,
+        -127,  -59,  -16, -101, -108,   74, -113,   68,   49, -116,  -66,   61, -100,  103,   -4,   39,
+         -68, -120,   58,  -14,  -49,   19,   13,  124,  -37,   91,   99,  -32,  -17,  -40,   21, -113,
+          52,   41,  -47,  -49,  -32,  104,  -69,   23,   75,   51,    5,   28,  101, -105, -120,   65,
+          25,  112,  107,   -4,   -4,   85,   93,  -81,  114,  -33,   17,  -45,  -91,  -45,   14,  -16,
+          28,   91, -122,  -25,  -94,  -22,   15,  -52,   42, -112,   65,  -13,  -91,   23,  -37, -105
+    },
+    { // oc 3
+         -41,  -11,  -90, -112,   41,    3,  -23,   31,  116,  -18,  -43,   45,  -59,  -45,  -78,  -31,
+         -34,  -21,  -51,  -37,  -43,  101,  104,   91,   -7,   74,  -46,  -85,   80,  -49,    6, -116,
+           4,  -39,  -31,  -29,   16,  -37,   76,  -60,  -79, -104,  -96,  -32,  -86,  -31, -117,  -81,
+           9,  -25,  -14,  -22,   21,   -8,  -66,   84,   35,  -41,  102,   17,    8,  -93,  -31,   30,
+         117,   85,   26,  -57,  -53,  -61,  117,   46,   47,  -52,   82,  -26,   88,   49,   92,  105,
+          90,   47,   15,   70,   -1,   99,  108,  -35,  -80,   30,   30,   65,  -26,   72,   62,  125,
+         110,   53,  -14,  -78,  -67,   60,  -30, -128,  -64,   76,  -13,  103,   69,  -97,  -12,  -78,
+         -52, -103,  103,  -85,   81,  -28,  125,    9,   68,  -71,  -23,   59,  -11,   94,   83,   76,
+         -82,  117,  -64,   19,    4,   68,    3,   45,  -99,  103,  115,  -61,  -32,   -6,   87,   32
+    },
+    { // oc 4
+         -32, -115,   42,  -78,   79,   21,  -82,  110,    1,  -31,  -61,  -77,   27,  122,  -72,  -51,
+         -71,  -50,   98,   25,   -2,  116,  -71,   44,   71,  -65,  124,   14,   59,   91, -111,   83,
+         120, -101,  -78,   76,  105,  -18,   34,  -60,  117,  -62, -100, -121,   26,    6,   69, -103,
+        -116,  -49,   51,   82, -125, -125,   75,  -27,  -96,  108,  -71,   84,   97,   95,   29,  -18,
+          35,  -66,  -42, -122,  115,  -44,  -74,  -89, -108, -102,   88,  -92,   85,    6,   36,  -90,
+          34,   22,  116,  -93,   18,   63,  -22,   65,  -68, -118,   26,  -17,   24,   71,   31,  -72,
+          80,   81,  -49,    1,    9, -115,   17,    8,   50,   40,   96,  101,   13,   18,  -37, -114,
+          70,   24,  -65,  -21,  110,  -31,  106,   -9,  -38,  -98,   85, -113, -121,  -54,  -92,  126,
+        -113,   56,  120, -101,   14,   32,   57,  113,   56,   66,  105,   70,   49,  -60,  -44,  -31
+    },
+    { // oc 5
+         106,  -41,   50,  -55, -104,   -8,   39,  -80,   66,   29,  -22,   48, -121,  -96,  -38,   84,
+         -62, -109,   85,  -62,   56,   26,  -38,  -75,  -69,   83,    0,   66,  -48,  -76, -102,   45,
+          86,  -17,  -76,    5,  -87,  -38,  -98,    7,  124,   -7,  -94,  -33,   62,  101,  -16,  -89,
+          66,   86,   38,   18,  -55,   27,   21,  101,  126,   87,  108,   74,   41,  -22,    9,  -18,
+          34, -106,  -46,   -1,   62,  -84,   20,  -82,  107,  -63, -102,   42,   57,  -14,  -76,  117,
+          60, -116,   53,  -58,  -25,   39,   48, -102,  -83,    2,    6, -105,  118,   50, -114,   93,
+          47,   90,   69,   94,  -29,  -21,   71,  -71,   12,  108,   76,   27,  -17,   48,   70,   95,
+          56,  106,  -58,   85, -105,   62,   19,    4,  -33, -116,  106,  -25,  -86,   16,   12, -100,
+         -44, -101,  -58,  101,   50,  -38,   97,   82,   45, -102, -121,  -68, -114, -128,  -15,  105
+    },
+    { // oc 6
+         -76,  104,  -18,   54,  -83,  -96,  -56,   24,  -85,  119,   58,   20,   29,  -41,  -74,   63,
+         -96, -120,  -53,  -76,  110,  -95, -103,  -12,  -29,  -16,  -71,  -29,   34,   91,  124,  -23,
+         -88,  -26,   84,  -79,  -62,  103,   56,  -76, -104,  -95,    1,   34,  -93,  -77, -102,  102,
+          71,   66,  -96,  -40,  -28, -108,   70, -121,  -66,   51,  -34,   -3,  -70,    0,  -45, -126,
+         -91, -114,   35,  -77,  -84,  -26,   61,  -82,  -88,  -73,  -24,  -10,   36,  -45,  -36,    9,
+         -21,  -81,  -16,   85,  -55,  117,   79,  123, -106,  124,  -51,  -49,   35,   74,   95, -110,
+         -98,  -70,   12,   22,    6, -124, -118,  -49,   18,  -36,  -64,  -51,  101,   30,   20,  -61,
+         -73,   66,  -96,  116,   44,   43,   19,  -18,   82,  112,    0,   35,   60,   80,   38,   20,
+        -127,  -24,  -74,  -46,  -12,  -18,   51,  -82,  -81,   34,  111,  -42,  -80,  -64,  -18, -124
+    },
+    { // oc 7
+          68,  -48,  -87,   -8,  -97,   99,   52,  -64,  100,    5,   48,   11,  -46,   65,  -18,   42,
+          55,  -82,    7, -105,  -34,   72,  -43,  -80,   76,  -82,   36,   -6, -116,   93,   20,   31,
+          -4, -126,   46,  -43,  -89,  -53,  -37,  113,   73, -128,  -77,  -79,   13,   18, -118,  -18,
+          16,  108,   22,   54,  -47,  -63,   70,  -58,  108,   43,  -80,   85,   68,  -51,  101,  -75,
+         -46,   55,  -71,  108,   95,   42,  -37, -108, -113,    8,  116,   77,   70,  106,   80,   77,
+         -54,   20,    1,  -38,   60,  -80,  -84,  113,  -80,  -35, -106,   44,   -5,   10,    5, -126,
+         117,   28,  -95,  -60,  -23,  124,    6,   86,   51,  102,  -16,  -99, -111,   20,    8,    7,
+         -47,   38,  -11, -101,   94,   -6,  -27,   73,  101,  -95,   27,   43,   71, -117,   36,  -89,
+         101,  -26,  121, -102,  -66,   31,  126,   75,  109, -102,   74,   86,  125,  -37,  -34,  -58
+    },
+    { // oc 8
+          44,  -27,  -63,  103,  115,  -23,   97,   -7,   39,   75,  -78,  -54, -125,   14,   -8,   93,
+          33,  101,  -23,   18, -103,  -40, -108, -106,   73,  -31,  124,    5,  118,  -76,   67,   81,
+          41, -105,  -14,  -37,  -67,  -16, -115,  -65,   35,   94,  -84,  104,  -42,   15,  -96,   -4,
+         -16,   64,  -86,  -41,   54,   31,  -86,   -1,   86,  -56,  -75,  -64,   17,  -97,  116,  -13,
+         118,   76,  -38,   -8,   37,  -43,  104,   15, -115,  -65,   86,   -6, -105,   78,   69,    1,
+        -102,  -59,   30,  -68,   98,  -47,  -94,  118,   76,  -31,   43,  -60,  100,  -75,  -90,  -12,
+         -95,  -39,  113, -125,  -53, -101, -121,   43,   39,  -34,   82,  101,  -60, -106, -106,   68,
+        -101,   22,  -85,   13,   53,   29,  124,  -21,   75,   70,    2,  -11,   95,  125, -121,  -68,
+         -30,   21,   80,   43,  -65,  -24,  -68, -107,   23,   11,  105,   -8,  118,  -22,  117,   40
+    },
+    { // oc 9
+          88,   69, -112,   72,  118,  120, -103,   66, -109,   77,  -83,   86,  -61,   23,   99,  -10,
+        -105,   78,  -44,   27,   20, -115,   26,  -38,   39,   37,  113,   13,  121,   52,  -83,  -39,
+         113,   52,   17,   95,   76,  -42,   82,   36,   79,  -54,  -65,   98,    0,   61,   48,   -4,
+         -83,  -71,  -26,   70,  -23,  -54,  -50,  -59,   18,  -90,   40,    0,  119,  103,  -36,  -46,
+         111,   -3,  -49,   95,  -11, -103,   98, -128, -116,  -71,  -76,  -53,   42,  -11,  -79,  -99,
+           4, -116,   14,  -80,  -65,   47,   67,   41,  -88,  -56,   27,    3,  -99,  -18,  -63,  -44,
+          37,  -34, -111,  100,   52,  -10,  115,  -12,  -12,   35,   10,  -35,  -64, -105,   14,  -34,
+         102,   65, -121,    0,  -76,   37,  -32,  -65,   98,   -9,   68,  112,  -92,   87,  100,  107,
+         -37, -110,   26,  -83,   28,  -94,   -5, -104,   73,  -14,  -11,   -9,   55,  112,   64,   91
+    },
+    { // oc 10
+         -60,    8, -120,    7,    6, -118,  -93, -117,   15,   76, -103,  -95,   -1,   26,   45,   21,
+         -23,   22,   91,   18,  113,   38,  -90,   88,  -33,   -7,  -63,   51,   89,  -40,   58,  118,
+         121,  -53,   20,  -93,   68,  -51,   48,  -48,   32,  -78,  -57,   67,  -61,  -85,   92, -111,
+          68,  -66,  -45,  108,  -38,  -10,    1,  122,  -82,  -50,   69, -120,   32,   10,   45,  -62,
+         -40,  115,  -86,  118,  -39,   85,   76,   56,  -30,  103,   50,  -66,   68,   78,   54,  -77,
+          88,   54,  -33, -121,  -86,   87,    1,  -62,   73,   51,  -70,  -64,  -33,  -46,  -46, -119,
+          73,  -19,   52,  -25,   57,  -16,   65,  107,   45, -123,   53,  -37,   92,  -43,   85,   11,
+        -100, -113,  -19,   99,   32,   36,   32,  124,   74,   14,  -15,  -19,  -63,  -64,  -59,   95,
+          33,   35,    7,  -66,   17,  -68,  -51,  -60,   40,   15,  -84,   82,  -23,  -80,  102,   94
+    },
+    { // oc 11
+           0,   85, -107, -110,   22,  -50,  -66,   12,  107,  122,  -80,  101,  113,   50,   35, -120,
+         -82,  -56,   38,  -65,   50,  -81,  -11,   88,   83,  -60, -124,  -99,   -4, -121,   71,  -62,
+         118,   73,  -53,  102,  -67,  -41, -105,  -89,  -91,  -60,   63, -113,  103,    3, -127,  -98,
+          90, -114,  -80,   45,  -36,  -75, -110,  -26, -116,   45,  -53,  -90,  -24,   99,  115,    6,
+          48, -112,  -23,  -99,  -57,  -53, -105, -116,  -78,   -1,  -90,   93,   23,   59,   28,   -3,
+        -108,   40,  125,   26,  -74,   93,  104,  -76,   52,  -61,  -69,  112,  -69,  -64,  -43,  -42,
+         -36,   -7, -102,   87,  -23,  -84,  -80,   81,   14, -123,   60,  125, -115,   73,   57,   80,
+          61,  -18,  -59,   28,   58,   90,  -18,  -13,  -75,  -83,  109,   38,  -61,  119,   -2,  -36,
+        -120,   82,   58,   37,  -90,  -99,   66,   65,  -79,  125,  -32,   97,  -97,  -80,   69,  -63
+    },
+    { // oc 12
+         -68,  -93,  -56,  -69,   41,   31,   12,  -39,  110,   44,   73,  115,   -7,  -45,  -62,  -80,
+         -87,   41,   26,  -14,   58,  -18,  -14, -116,  -56,  -23,  -67,   95,   62, -105,  -80,   49,
+         -52,  -36,  -59,   40,  -74, -123,   79, -113,   40,  -80,  -38,  -15,   29,  111,  125,    7,
+         -14,  -42,  -45, -125,   92,  -41,   -6,  112,    6,   -4,  -99, -121,   59, -104,    3,  119,
+        -103,  -76, -105,  -70,   20,   84,  -86,   55,   18,   94,  -79,  114,   97,  -53, -120, -100,
+         111,  -18,   70,  -64,  -62,  -76,    6, -107,   -3,  -86,   19,  -29,   88,  -17,  -76, -122,
+        -102,    3,  -62, -100,   -1,  -51,    0, -106, -117, -119,   62,  119,  -15,   32,   36,  111,
+          69,   84,  -44,  -70, -101,   32,   37,   52,  117, -116,   32,   -3, -103, -128,   14,  -31,
+           3,  -61,   57,  -97,   31,  -73,  -83,  -19,   51,  -92,  -98,  -29,  123,   -2, -119,  -50
+    },
+    { // oc 13
+        -106,  -92,  -86,    7, -117,  -51,  -94,  -81,  -95, -110, -116,  125,  -19,   35,  -74,   94,
+        -115,  -83,  -59,  -28,   99,   35,  -63,  -42,   -2, -125,  100,   94,  -24,   35,   47,  108,
+         -53,   11,  120,  -97,   38,   37,   31,   62,  120,  -98,  -96,  -52,   94,   37,   25,   76,
+        -127,  117,   88,   77,  108,  -80,   86,  -45, -126,  126, -118,  -23,  -45,  120,   74,  -64,
+         -56, -112,   86,  -42,  -16,   49,  -91,   85,  -90,  -70,   84,  -22,   71,   36,  -57,  -50,
+         -17,   87,   62,   85,   -5,   60,  -73,   98,    2,  -80,   -2,   58,   -5,   74,   37,   73,
+         101,   75,   43,   89,  -99,  109,   78,   -7,   27,  124,  -99, -103,  -57,   17,  -32,  103,
+         -27,   -2,  108,   21,   15, -126,   39,  110,  -13,   13,  -34,  106, -116,  -67,   11,   68,
+          25, -125,  100,  -65,  -41,   56,   42,   40,   -5,   56,   -8,  -80,  117,  -48,  -25,    7
+    },
+    { // oc 14
+         109,   47,  -60, -122,  114,  -15,  -87,  109,  -38,  -68,  -48,   89,  115,   22,  -11,   -4,
+           8,   92,   38,  -40,  -74, -105,   -1, -103,   71,  -12,   53, -123,   33,   -4,  116,  117,
+          99,  -40,   87,   38,   17,  119,    0,   76, -127,  117,  -20, -107,   61,   92,   50,    5,
+          19,  113,   72,   -8,   65,   82,  -27,  104,   91,    5,  -23, -127,  -47,   56, -127,   45,
+          68,   37,  -13,  107,   61,  -63,   26,   17,  -42,   61,  -90,   97,  -81,   46, -103,  -84,
+          83,  -22,   16,  -90,   19,  -22, -117,  -36,    5,   76,   -6,  122,  -98, -116,  -87,   24,
+         -94,   69,  -85,  113,   83,  -54, -125,   78,  -18,  -48,  118,   50,   84,  -60,   40,   97,
+          39,   98,   90, -104,   64,  -83,   -7,   72,   89,   91,   78,  -58,  -96,  -17,   24, -103,
+         -88,   13,  -35,  -20,  -37,  121,    5, -104,   29,   -8,   37,   72,  113,   27,  -35,  126
+    },
+    { // oc 15
+          36,  -41, -123,   59,  -14, -118,  106,   17,   42,  -84,  -68,   12,   62,  -50,  -94,   -9,
+          41,    7,   51,  -49,   29, -121,  -42, -113,   47,   56,   68,    5, -123,  -95, -128,  -17,
+         -62,  -64,   50,   71,  121,   25,  106,   83,   68,   63,   97,  -42,   -8,  -43,   51,   32,
+        -128,   89,   -8,  -53,  -18,  -10,  -72,   29,  -47,   38,   69, -121,   28,  -37, -103,   48,
+        -109,   64,  124, -105,  -38,  -55, -125,  116,  -50,  -98,  -84,    3,  121,  -28,  -29,   -6,
+         -56,   56,  -28,  -99,    2,   -4,  -10,   84, -101,  -23,   37,   99,   30,   -9,  -63,    4,
+          32, -100, -113,   -9,  -99,   66,  -84,  -39,    1,  125,   -2,   16,  -53, -121,  -86,    8,
+         -10,  107,  -43,    2,  -24,   92,  -28,  -43,    2,   25,  -50,  -82,  125,  -32,  115,  -35,
+        -107, -100,  -92,  118,   67,  -54,  -27,  102,  -61,  -40,   29,   -5,  -51,  117,  105,   60
+    },
+    { // oc 16
+         -70,  102,  -37,   97,  -51,   -1,   -6,   51,   83, -103,  -36,   20,  -48,   66,   -5, -123,
+         -26,  110,  -40,  -40,   98,  -85,    5,  -16,  126,   53,  103,    0,    4,    9,   32,  -96,
+          17,  -89,  -71,  -81,   69,  123,  -55, -109,   28,  -36,  -37, -121, -126,  114,  -44,   17,
+         110,    3,  -58,   72,   -4,   -1, -105,  -85,  -30,  -98,   59,   52,   -4,  112,  126,   71,
+         -17,   36,  126,  -65,  -79,   22,   61,  -89,   21,  -91, -120,    5,  -14,  102,   32,  -90,
+          83,   78,  122,  -66,  -44, -127,  -61,   99, -108,   75,  -21,  -26,  -69,  111,  -83,  -29,
+          35,   55,  -16,  101,  -51,  -47,  -27,   16,  -96,   33,  -16,  111, -127,  -50,   90,   84,
+        -112,   79,  101,   90,  -82,  116,  -17,   20,   79,  -94,   43,   -7,   17,  105,   10,   89,
+         -32,   73,   43,  -92,  -26,   -1,   12,  -81,   78,  -56,  -33,  -62,  -12, -102,   26,   30
+    },
+    { // oc 17
+         -34,  -31,    2,  -19,   10, -103, -120,   98,   51,  -23,   12, -112, -110,    7,  -43,   13,
+          90,   69,   57, -117, -112, -128,   22, -127,  -27,  -28, -120,   34,   12,   47,  -80,  -36,
+         -74,  -43,  120,  103,   -4,  -94,   92,   67,   57,  -66,   86,  -88,  -20,  -14,   -7,   64,
+         -33,   -5,   72,   65,    1,  -70,  -38,  118,  -85,    7,   69, -124, -128, -100,   50,  -16,
+         -16,   -2, -105,   25,  -21,  -16,  -34,   62,  -31, -105,  -40,   36,  -10,  -40,   39, -127,
+        -113, -101,  -63,  104,   71,  -40,  -71, -124, -120,   19,  101,   35,  -86,  100,  -12,    6,
+          34,   77,   62,  -78,  109,  -64,  -53,   82,  -21,  -30,   32,   23, -108,  -67,  -89,   77,
+         -22,  -52,  -41,   84,  -63, -112,  -23,  104,  -94,  -16,   21,  120,    5,  124,  -47,   40,
+         -63,  -93,   32,  -40,  -20,   -9,   -5,  -99,  116,   36,   38,  114, -117,  -33,  -22,   54
+    },
+    { // oc 18
+         -64,  -71,   -1,   79,  -24,  -96,   11,   85,   -4,  -78,   27,    1,    6,  -36,  -83,  -16,
+         -70,   31,  -18,  -13,  -91,   37,  104,   65,  -14,  -80, -119,   68,   87,   14,   33,  -84,
+         -22,   26,  -84,   74,  -19,  -78,  -44, -121,  -59,  119,  -16,  123,  -90,  -16,   24,  117,
+         -90,  -74,  -88,  118,   40,  -90,   31, -121,   14,  124,  119,   21,   85,   -8,  -78,  -24,
+         124,  -62,   46, -125,   49,   66,   14,  125,   52,   34,  -41, -123,  -87,   14,  -49,   11,
+         -38, -128,  -18,   10,   21,   99, -103,  -77,  -49,   53,  -59,   70,   -5,  116,    0,   16,
+         -10, -125, -122, -127,  -62,   58,    1,  -49,  -42,   50,  -66,   49,  101,   64,  -97,  -82,
+         -73,  -62, -121,  -48,   44,    7,   86, -117, -123,   30,   99,   27,  -20,  -27,  -87, -108,
+         111,  -16,   73,  -72,  -27,  -31,   -4,  -27, -120,  112,  -82,   -2,  -34,   31,   69,  -37
+    },
+    { // oc 19
+         -31, -109,  105,    8,  121,  -79,   26,   86,  126,  -24,   15,   75,  -28,   52,   27,  -19,
+         -83,  -33,   65,   96,  -58,   20,  120,  -47,    0,   23,  -86,  -25,   29,  -14,   96,   93,
+        -119,   35,  -99,    4,   97,  -91,  109,  -18,  -35,    6,   48, -127,  111,  101,   95,   45,
+          56,  -74,   21,   33,  112,   40,  -34,  -82,   89,  -99,  -32,  -45,  -76,  -32,   83, -119,
+         -64,   68,  -28,   22, -113,   72, -110,   50,  -29,  125,  120,   70,  -35,  126,  -82,   36,
+        -127,   73,   28,  -70, -128,   -9,    5,  -80,  -33,   25,   57,  -45,   80,  -24,  -42,   22,
+        -107, -124,   93,  -72,  -33,   42,   58,  126,   12,   41,  -49, -115,   -4,  -96,   20,  -12,
+          81,  -88,  -34,  117,  119,  -23,  -40,   -2,   20,  -73,  -24,  -20,  -57, -102,    7,  -73,
+         -97, -118,  -46,  -98,   38,   30,   25, -101,  -24,   54,   53,   22,   27,   13,  -97,  -93
+    },
+    { // oc 20
+        -104, -118,   38,  -49,  -50,  -58,  -30, -110,   42,  -62,  -49,  120,  -79, -118,  -30,  -30,
+         -29,  108,  -78,   83,  -15,  -25,   21,   69,  -63,  -58,   73,  -28,   -5, -106,  -24,  -14,
+          43,  -45,   69,  -35,   72,  124,  -12, -106,  -76,   35,   90,   98,  115,   59,  -20,  101,
+          65,  114,  -26,  110,   -7,  -79,   15,   -6,  -54,  -89,   58,  -74,   26,  -43,  -47,    1,
+          32,   35,  -41,  -78,   36, -116,   86,  -53,  100,  116,   -6,   96,   37,  117,   73, -120,
+         -97, -103, -105,   14,   -1,   85,  109, -122,  -10,   12,   52,    7,   93,  107,  100,   42,
+         -36, -118,  -70, -101,  -24,   -1,  -87,  101,   10,  -55,  105,   65,  125,    9,  -46,  -54,
+          -8,   18,   47,  -35,  -58,   97,  -56,  -52,   10,  -68,   43,   47,  120, -125,   50, -108,
+         -27,   50,   15,    7,  -97,   15,   13,   78,   46,  -80,  -40,   89,  -20,  -11, -108,   80
+    },
+    { // oc 21
+          28,   86,    8,   63,   11,   16,  -82,   42,  -97,  -88,  -76,   54, -110, -100,   77,   37,
+         107,   27,   72,  -90, -124,  -95,  -78, -119,  -63,   53,   21, -113,  -74,  -57,   68,   13,
+           6,   22,  109,  -63,   44,   22,  -78,   91,  -55,  -73, -107, -113,  -49,  121, -121, -100,
+         -54,  -84,  -49,  -31,   -2, -114,   89,  -73, -102,   22, -123,  101,   65, -107,   33,   63,
+          23,  -64,  124,  -76,   91,  -63,  114,   87,  105,   59,   26,   20,  106,  -47,   16,  -40,
+          57,  -99,   -6,  124, -121,  107,   44,   99,   -6,  -14,   62,   -8,   76,   76, -103,  -39,
+         114,  -32,  -12,   96,   39,   80,    0,  -22,  -24,   -8,  -36,  -13, -111, -120,  -80,  -66,
+        -127, -107,  -74,   94,  -80,  -32,   86,  -61,  119,  116,  117,  -44,   99,  -88,   26,  -60,
+         -34,   26,   30,  117, -107,  -39,   48,   13,  -69,  -19, -111,  -58,   72,  -44,  -66,  -32
+    },
+    { // oc 22
+          29,    8,  119,  116,   49,   -2,  -28,   -9,   16,  -63,  -42,   20, -107,  -49,   45,  -58,
+        -105, -114,   66,  103,   41,  -48,   62,   89,  -14,  -51,  -83, -104,  -79,  -51,  -58,   50,
+        -111,   15,   -1,   86, -106,   38,   53,   74,   -7,   83,   16,   14, -118,  -33,   72,   90,
+        -115,   54,   36,  -48,   85,  -45,  -70,   15,  -30,  -95,  -81,  -39, -104,   13, -114,   -9,
+        -118,   60,  -39,  -11,  100,   -3,  -82,   23,   87,    8,   48,  -13, -112,   65,   88,   98,
+          20,   26,   92,    0,  -63,   27,  122,   48,   95,    0,    2,   31,   68,   18,  -52,  -84,
+         -95,  124,  -52,   17,   12,    2,   56,  -91,   20,   95,   40, -119,   87,  -86,   66,   21,
+        -122,  -23,   90,  -81,  -92,  119,  125,  -94,  -43,  -14,   70,  -35,  -36,   49,  -54, -118,
+         -53,  -11,   40,  -31,   35,   96,   -6,  113,  112,   36,  -76,  -87,   39,  121,  107,   56
+    },
+    { // oc 23
+           3, -123,   55,   29, -125,  125, -108,  104,   -5,  -11,  -56,  -23,  -39,  116,   16,  -54,
+         -15,   41,   47,  -39,  114,   42,  119,  109, -122,  -74,   41, -127,    3,  100,  -66,   97,
+         -99,  -51,  103,    6,   32,   48,  -29, -124,   -5,  -65, -120,   74,   61,   98,  -11,  -61,
+         -18,  -98,  -48,  -73,   -7,  104, -112,  111,  -83,   36,  -25,    5,  -73,  121,  -14,   23,
+          96,   26,   90,  -47,  -87,  -51,  -27,   39, -102,   -5,   60,   32,   20,  120,   51,  -74,
+         -72, -119,   51,   -9,  108,  -16,  -54,  -31,   18,   75, -115,  -31,   74,  -21,  -11,   99,
+          53, -111,  -47,   -6,   73,   12,  118,  -59,   88,   97,  -75,  -33, -114,   32,   41,    2,
+          19,  122,   64,  -26,  -81, -124,  119,   53, -122,   24,  -63,   79,   -4,  101,  117,   10,
+         110,   12,   53, -122,  108,   95,  -46,  117,   82, -109,  118,  115,   87,  108,  -39,   22
+    },
+    { // oc 24
+         118,  -74,  -18,  113,   50,  101,  -69,  101,   -1,   15,  -90,   39,   90,  -74,  -84,  -57,
+        -124,  -79,  -10,  -41, -110, -126,  -49,   62,   -9,  -26,   60,  -48, -120,   89,  -48,  113,
+          11,   55,   36,  -35,  -22,  -51,   79,  -45,   57,  -57,   43, -113,  -73,  -82,   74,  -17,
+          49,  -76,  -37, -104, -106,   18,   85,   45, -110,   29,  -59,  -60,   -7,   28, -111,  110,
+          18,   43,   22,   35,   -3,   20,   50, -119,   79, -109,    0,  -25,   70, -119,  124,   -1,
+         -47,  117, -121,   62,  -74,  -46,   28,  -91,  -72,   38,   65,   91,   41,   75,   64,   81,
+          70,  -54, -107,   86,  -41,   -9,   36,  -98,   47,   32,   17,  -57,  -72,  -15,   12,   77,
+         -62,  117, -100, -109, -111,   -7,   91,   85,   50,  -29,   76,   31,  -91, -108,  106,  112,
+          77, -100,  113,  -73,  -63,   83,   -9,  -76,  -73,   28, -105,  -71,  -47,  116,   86,   48
+    },
+    { // oc 25
+          72,  -25,  -69,  -50,   36,   31,   46,  -14,  -80,   17,   51, -119,  -93,   49,   92,   11,
+          22,   -8, -113,  -32,  -96, -118,   52,   43,  -77,  115,   30,    2,  -55,   38,   29,    8,
+        -107,   41,   -2,   43,  -43,   79, -117,   94,  -36,  -30,   44,  113, -118,  -50,   66, -119,
+          91,   17,   -2,  -63,   69,   60,  -71,  -80,   13, -122,   88,   97,   66,  119,  109,  -18,
+        -109,  107,   57,   81,   62,   52,   95,  -83,  -94,  -84,  -45, -128,   93,  -11,  -66,  -73,
+         -79,  -60,   57,  -89,  123,  -58,  110,  107,   -7, -113,   61,   62,  -14,   72,  -50, -126,
+         -96,  105,   88,  -90, -109, -102,  118,    1,   25,   68,  -43,  -46,  -31,  -11,   73,  -63,
+         -72,    4,  103,  -51,  -86,  102,  -45,   57,   56,   35,  -52,   57,   38,   90,  -98,   42,
+         -85,   72,   25,    0,  -19,  -92, -101,  -91,  -81,  -38,    7,  -40,  -13,  -73,  -68,   19
+    },
+    { // oc 26
+         122,  -28,   42,  -63,  -25,  -70, -125,   66,  -33,  -95,   54,  113,  -62,  -17,  -95,  -86,
+         -67,   81,  -23,   41,  -31, -121,  -60,    2,  -75,   -5,  120,   54,   -5,  -33,  -98,  -17,
+        -105,  -26,   57,   12,  103,  104,  100,   47,   81,   86,  123,  -49,  -11,   -5,   55,  -34,
+          51,   -3,   40,  100,  -38,   72,   79,  -62,  -74,   54, -109,  125,  -49,  -31,  113,   46,
+           8,   30,  -65,  -51,  -71,  -37,  125,   37, -119,  -65,   10,   63,  121,    1,   46,  -33,
+        -110,   77,   50,  -63,   72,  -85,   22,  105, -102,  -61,   20,   55,    7,   -5,  -31,   95,
+          98,  -46,   93,   17,  -95,   26,  103,  123, -103,   14,  -93,  125,   83,  -16,   52,  -59,
+        -105,   57,   35,   27,   90,   72,  -13,  -14,   25, -106,    3,  -21,  -77, -114,  -91,   74,
+          30,   -6,   13,   37,  122,   99,   93,    1,  -10,   -7,  -60,  -28,   31,  105,   65,   12
+    },
+    { // oc 27
+          44,  -52,  -16,   -3,  -29,   88,   32,   -9,  111,  -32,  -49,  -97,   63,  -48,  -87,  103,
+          79,  -51,   82,  -29,  -82, -101,    1,  -61,   31,   98,  -50,   18,  -50,   57,  -70,  -78,
+          63,   48,   95,   98,  -61,  100,   48,    9,  -13,  100,  -63,  -63,    2,   -1, -128,  -25,
+          55,  -76,  -15,  117,  115,   63,   89,   10,   51,  113,   38,   44,   94,  -10,  117,    5,
+          -8,  -65,   40, -108,   46,   81,   23,   79,   -1,   82,   31,  -39,  103, -107,   83,  -35,
+          61,  -53,  112,  -17, -114,   55, -122,   56,   90,  121,   28,  -13,  -43,  -87,   15,  104,
+         -68,  -51, -128, -103, -108,  -95, -124,   66,    7,  -88,  -11,  107, -100,   58,   -9,  -89,
+          83,   80, -101,   -3,   70,  -21,   13,   -1,  -62,  -95,  -23,  125,  113,  -90, -119,   35,
+         -40,   -2,  -98,  -96,   -3,  -84,    6,   59, -115,  -64,  -50,  -29,   70,   13,  -71, -115
+    },
+    { // oc 28
+         -17, -109, -121,   48,  -56, -123,  -63,   39,  106,   28,  107, -127,  -44,  119,  115,   73,
+         -95,   74,   44,  -63,   62,   94, -110,  -80, -126,  -76,   -8,   40,  -28,  -68,   34,   44,
+         -38,  -51,  -23,   30,  -93,   97,   80,  -29,  116,   62, -107,   82,    0,  -17,   94,  -79,
+           5,  -47,   74,  -51,  -87,   90,   42,  -94, -116,  -88,   65,   91,   98,    2,   41,   45,
+         -90,  120,   80,  -71,   27,   35,  126,  -60,  120,  -43,   57,   92,  -34,   53,   60,  117,
+          64,   97,  -96,  -93, -116,  -86,  -60,   44,  124,  -73,   67,  100,  113,   12,   92,  122,
+          71, -128,  118,   14,   76,   53,  -73,  -34,  -94,  106,  108,   13,   77,  -81,   44,   32,
+          93,   82,    2,  -25,  -80,  116,  105,  -81,   96,   33,  -23, -110,  -93,  -36,  -22,  123,
+         110,  117,  -84,  104,   81,  -44, -126,   17,   89,   55,   -4,  -86,  -80,   93,  108,   28
+    },
+    { // oc 29
+         -35,   39,   87,  -48,  -68,  -27,   80,  -42, -100,   26,  -10, -119,   77,  -81,   97, -100,
+         -11,   43,   64,  121,  120,   43,  -36,  -60,   22,  -17,  -40,    6,   66,   69,   26,   55,
+         -69, -105,  -50,  -22,  115,  -74,   -2,  -70,   80,  118,   50,   15, -109,  -24, -128, -104,
+        -100, -104,   47,   86,   44,   60,  -91,  -85,  -78,  -37,  -95,  -64,  -67,   83,   70,  -32,
+          41,  -45,  -20,   21,  -85,   54,  -16,  -23,   21,  -57,   46,  -16,   65,   85, -122, -105,
+          28,  -89,  -91,   55,  -92,   45,   14,  115, -124,   17,   24,   62,   -4,  116,  -39,    1,
+           4,  -19,  -36,  -17,   47,   30,    0,   85,  -98, -104,  -81, -109,   97,   12,   71, -103,
+           6, -114,   99,  -42,  -65,  -50,   46,   35,   98,   -7,   18,   97,   21,   -7,  114,  -87,
+          96,  -97,   25,  -61,  -78,   19,  116,   76,   99,   27, -122,  -54,   96,  -84,   29,  -65
+    },
+    { // oc 30
+         124,    5,  -83,   69, -125, -128,  -72,  -26,  -27,   57,  -75,  -41,   -3,  -92, -114,  -57,
+          27,  -85,   73,    3,    5,   84,   49,    5, -128,  -17,   91,  -31,   27,  -81,  114,   74,
+         -11,  -69,  -11,   63,  -33,  -29, -111,   66,  113,   -5,  100,    4,  -45,  -74,   18,  -95,
+        -119,   69, -126,    1,  -76,  -17,  -97,   33,  113, -103,  -51,  -70,  -40,  -79,  -63,  -69,
+          37,   -6,  -31,  -17,  -92,    9,   82,  -89,   43,  -15,  -80,   89,  -93,  -28,   99,  -92,
+         -96,  124,  -60,   -8,   33,   95,   15, -118,  -18, -127,   24,   76,   74,  -96,  -87,  -90,
+         -27,  100, -111,  -70,   29,   43,  -18,  110,  -76,  -16, -107, -124,  -81,   66,   10, -117,
+          30,  -86,  -37,    2,   43,   44,  -94, -117,  -24,  105, -122,    7, -104,   20,  -50,  118,
+           7,  -34, -124,   80,  -92,  123,   79, -126,   39, -120,   18, -123, -117,   16, -107,   20
+    },
+    { // oc 31
+          62,   63,  -37,   86,  -45,   97,   43, -120,   60, -100,  -40,  -59, -112, -118,  -62,   40,
+          90,   78,  -60,  -59,   24,  -34,  109,   41,  -43,   -8,    8,  -22,  -89,   54, -124,  115,
+        -105,  116,   17,   28,   32,  -39,  -60,  -38,  -86,   33,   90,  114,  104,  -85,   25,   14,
+         -76,  -46, -125,  -13,   71, -112,  -19,   96,   22,  -44,   13,   -7,  -79,  120,  -47,   48,
+          38,   38,   25,  -56,  -24,   44,   75,  -30,  -29,  124,  -54,  -24,   62,  126,   65,  100,
+         -24,   35, -114,   67,  115,  -11,  -56,  -69,   84, -123,  -73, -112,  -93, -112,   10,   38,
+          92,   96,   29,  -20,   22, -103,    1,   37,   38,   67,   18,  -37,  -76,  -11,   34,  103,
+        -127,  105, -102, -105,  -84, -104,  -52,   97, -112,   77,  -11,   65,   87, -123,  113,  -27,
+         123, -119,  110,   65,  -44,  -66,   28,  123,    3,  114,   85,   55,   40,   69,   57,  111
+    }
+};
+
+// CONV3: [32][32][3][3] (OUT_CH, IN_CH, K, K)
+static const weight_t CONV3_ROM[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K] = {
+    { // oc 0
+         126,  -44, -115,  -71,   31,   54,   71,   64, -104,    6, -118,   69,   32,   90,   25,   35,
+         -46,   33,   51,   95,  -94, -123,  107,  105,  -85,   23,  -34,   77,  102, -121,  120,  114,
+         -90,  -73,   48,  -47,  -80,   15,  -63,   64,   90,  -33,   15,  109,  -39,   -3,   28,   77,
+         120, -106,    7,  -50,  -11,   88,  121,   10,  -33,   49,  -31,  123,  -43,  -74,  103,   35,
+         115, -119,  105,  -38, -116,   68,  -94,   11,  -36,   88,  -30,   11,   35,   44, -119,  -68,
+          -7,   25,  102,   12,  -64,  -85,  -81,  -97,  -54, -110,   -6,  -41,  -66,   91,  -57,   98,
+        -110,  -56,    1,   47,  -23,  -76,   93,   44, -121,  -87,  -20, -118,  -32,   34,   63,  -50,
+          79,  -66,   51,   24,   93,  114, -109,  -74,  -89,   92,   92,  115,   -3,  -57,   78,   79,
+          86,  -35,  -81,   71,   11,   49, -113,   97,  -10,  -73,   49,  122,  123,  -64,  -17,  -49,
+          71,   21,  -56,  -96, -119,   52,  -80, -104,   39,  -37,   11,  121, -116, -117,  -55,   76,
+          94,   56,  116,  -51,  -23,  -36,  -53,   85,   58,  -22,   49,  -32,  -96,   28,  -27, -117,
+         -64,  -35,   95,  -78,   74,  -63,  122,    8,   12,   25,   69,  -40,  120,   -5,  -40,    2,
+         -97,  100,   14,   12,  -90,  -20,   68,   77,   31,   55,    0,  110,   50,  -60,   20,  -34,
+         -46,   24,  -24,  -80,  -60, -117,   72,  -42,  -37,  -64,  -76,  120,   93,    0,  -42,   67,
+          27,    7,  -18,   -7, -123,  -19,   11,   83,   74,  -12,  -31,   90,  -63,  115,  109,    6,
+         -99,  126,  -38,   64,  -36,  111, -114, -121,  -10,  -77,  -79,  -19,  106,   27, -128,  103,
+          52,   58,   28,   -6,   22,   42,  -89,   90, -117,  120, -109,  -99,   -4, -113,  100,  -79,
+         -69,  115, -111,   48,   72,  -34,   10,  121,   32,   65,   94,   83, -102,  -14,   73,   70
+    },
+    { // oc 1
+           2,  -17,  -26,  -54,  -71,   34,  -36,  105,   28,   77,  -83,   23,  -28,  120,  -19,   48,
+         108,   -7,   45,  109,  -50,  112,    5,   -8,   32,  -75,  -61,  -80,  -82,  -40,   35,   80,
+         100,   55,  116,   75,  101,   36,  -32,  -41, -111, -128,  -12,   63,  116,  121,  -44,  119,
+          34,  -40,   93, -113, -116,   86,  -75,   79, -126,   24,   96,   32,  -27,  -77,  -20,   70,
+         -17,   89,   72,  112,   82,  -23,    1,   -9, -119,  -42,   26,  107,  -19,  -47,   61,  -63,
+          63,   73, -115,  -75,  -20,   78, -125,   96,   49,   47,   27,   98,  -13,  124,  102,  -79,
+         -76,  -99,  -43,   75,  -98,  -46,  112,   50,  -39,   -1,   51,   56, -101,   35,  -86,  121,
+         -54,   34,   89, -118,  -94,  -72,   49,   17,   75,  -44,  -65,  -61, -123,   13,  -78,   13,
+         -84,  -62,   -3,  -61,  106,  -24,  -75, -120,   27,  -58,  -73,  -72,  -78,  -17,   -2, -123,
+          79,  -61,   81,   96,  121,  -49,  -29,    2,  -92,  -28,   60,   10,  -35,  120,  -62,  -79,
+          15,   15, -116,  -14,  -87,   77,  -88,   55,  120,  -93,   69,  -21,    4,   23,   41,   70,
+          87,  -30,  -21,   40,  -39, -124, -127,  -27,   43,  -40,  -67,   19, -123,   84,   -6,   31,
+         -14,   91,  111, -127,  -16,  -50,   17,  115,   13,  120, -114,   38,    1,  -86,  112,  -74,
+         -14,   55,  -41,  -12,   69,  117,   59,   22, -124,   33,   12,   86,   60,  -83,   79,  -25,
+         -84,   31, -118,   37,   97,  -27,   27,   34,  -81,   92,   94,  -28,    9, -102,   12,  -23,
+         -99,  102, -126,  125,   77, -109,  -28, -115,   78,  -20,  -43, -122,   32,   70,   61,  -78,
+          51,   48,   18,  121,   29,  -45,  -70,   47,   -9,  -59,  -54, -110,  -68,  -96,   67,   21,
+          40,   39,   29,   51,  -41, -115,   30,  114,  -39,  -64,   70,  109,   44, -100,  -27,  -68
+    },
+    { // oc 2
+          55,   54,    9,   54,  -79,  117,  -65,  -52,   75,   25,  -69,   37, -128, -102,  123,  126,
+         -83,   20,   84,   33,  115,   10,  -20,   93, -106,   52,  125,  -98,  -37, -118,   96,   31,
+          29,  -78,   -3,   74,   66,   13,  116,   59,  123, -125,   34,  -16,  118,   39, -110,   77,
+          45,   22,   35,  -94,   84,   55,  -49,  -31,  -83,   42,   -8,   63,  -37,   89,   71, -127,
+          83,  -19,   79,  -27,   42,   84,   98,    7,  122,   -7,   95,  105,  -55,  -18,   21,   56,
+         114,  -15,  -50,  -91,  125,  -52, -126,   87,   50,  -11,  -95,  -13,  -21,  103,    6,  -63,
+         -37,    1,   57, -126,  -62,  107,  109,  -89,   77,   24, -116,   91,  -20, -105,  -15,   47,
+          50, -119,   -5,  -75,    5, -108,  -60,  -83,   85,  -26,  121,    8,  -44,   98,   -3,   20,
+         -67,   45,  -46,  125, -102,  -49,  119,  101,  -78,   28,  119,    4, -103, -108,   24, -109,
+         -75,   -5,  -25,   81,   62, -110,   47,   79,   -6,  -47, -104,   26,  -11,  -16,  -75,  -63,
+         -70,  -63,   38,  -76,   20,   38, -104,   -7,   19,   95,  -40,  -56,  -89,  104,   50,  -85,
+          -4,  107,   44,  -41,  -96,  -35,  -82,   36,   58,   69,   91,  117,  123,  -72, -106,   96,
+          56,  110,  115, -128,  -59,  -99,  124,  -18,   74,  -72,    6, -109,   79,  -66,   41, -115,
+         118, -119,    6,   47, -106,  -48,   91,  121,    4,   90,  -72,  120,  -31,   45,  108,  -44,
+          97,   83,   23,   76,  121,  -12,   58,  -52,   79,   90,   84,  -83,  -65,   -7,  112,   39,
+         -71,  -97,  -46, -127,  -22,    1, -115,   70, -110,  -85,  -75,  -31,  -94,  -89,  -52,  -67,
+        -103,  -76,  -78, -116, -110,  -17,  -96,  -41,   18, -111,  -52,   -8,  -60, -102,   52,   53,
+          80,    1,  -70,   33,  -57,  -24,  -56,  -10,  -70,   62,   85,  -54,   -9,   -4,  102,   44
+    },
+    { // oc 3
+        -111,   82,  -85,   35,  126,   46, -101,   86,    0, -111,   56,   65,  -50,   92,   24, -127,
+         -45, -102,   33, -113,   86,  -54,  -44,  107,  -86,  -22,  -48,  -37,   10,  -83,  -93,   53,
+          38,   -4,   26,   45,  -87, -128,   35,  102,  115,   95,   68,   94,  -16,  -78,   94,   15,
+          26,  -89,  -96,  -42,   62,   81,  -82,  -19,   73,   56,  -98,   90,   78,   47,   34, -105,
+          66,  -12,   87,  -76,   66,  -36,   68,  104,  -40,  109,  -70,   94,   79,   72,   96,  119,
+         -92,  -66,  -64,  -30,  -25,   38,  -79, -111, -115,  -62,   34,  -73,   13,   65,  -23,  -77,
+          24,  -19,  115,  -14, -113, -126, -113,   -9,   36,  -64,   -8,   -4,    2,  -60,   37,  -31,
+          26,  -34,  105,    9,   -1,  -11,   53,  -38, -117,  -98,  -51,   23,  -62,   28,    6,   12,
+          48,   87,  -33,  -66,   30,  125,  -92,   96,  -93,    2,   -9,  -23,   -5,  -55, -114,   97,
+          49,   86,   17,   76,   94,  -99,  -82,   61,  -42,   81, -116,  -29,  -41,  102, -125,   48,
+          74,  -74,   23,  -13,   96,    5,  -82,  -30,   27,  -48,   31,   95, -117,   65,    1,  -24,
+        -127,  106,   62,   31,   87,  -87,  -36,  -34,  -17,   85,   25,  -24,  -66,  -14,   55,   23,
+         103,   59,    1, -120,    1,   10,  121,   18,  -13,   46,  -14,  -42,  -67,  -60, -112,  119,
+          68,  -74,   91,    6,   -5,   80,   98,  122,    1,   77, -110,  -82,  -36,  -70, -115, -101,
+           2,   56,   75, -104,  -50,  -79,    4,  -25,   79,  123,   85,  -52,  -83,  116,  -25,  -68,
+        -122,   78,   31,  -81,  -33,   78,   36,  -98,   52,  -14,  -11,   -6,   44,    1,  -41,   58,
+         -14, -107, -128,  -73,  -55,  119,  -97,   -4,  -11,  103,   50,   61,   33,  121,  -48,   87,
+          55,   89,   -1,   47,  -73,   80,   33,   81,  -34,  119,  125,   87, -112,    2,  -47,   41
+    },
+    { // oc 4
+         103,   33,  -22,   91,   85,   73,  107,  112,   61,   -7,  -18,   67,  -27, -127,  -90,  -68,
+          -8,  126, -113,  -55, -106,  -60,  -52,   40,  105,  -60,  -35,   70,  100,  105, -123,   96,
+          -1,  -47,   18,  -30, -120,  113,  121,  -51,   47,  -20,   10,  -88,   41,  -57,  -22,   82,
+         -19,   70,  -30,   32,  113,  -90,  -49,   47,   -2,  -28,  108,  -39,    9,  114,  -35,   11,
+          29,  -45,  -18,   70,  -12,  105,   37,   12,   13,   54,  -26,  100,   84,   80,   84,  -24,
+          39, -105,  -60,  -15,   31,  -24,   76,  -28,   11, -119,  -56,   37,  -85,  -48,   81,  -92,
+         -98,  -26,   -9,  100,  -73,    8,  -93,   23,   69,  -30, -108,  -61,   23, -108,  -47,  -25,
+         -98,   71,  -90,   68, -119,  -32,   88, -100,   90,  -80,    6,  119,   54, -124,  -40,  110,
+         -43,   15,  -10,   47,   60, -125,   29,  105,  -70,  104,   94, -122,   39,  -47,  112,   86,
+        -112,   73,  -54,   68,   73,  -89,  -65,  101,   30,  -54,  -64,   56,  -28,   27, -118,  -46,
+        -111,   30,   88,  109,  -78,  -48,  -34,  -67,   70,   49,   70,    0,   98,  -79,  -90,   17,
+         123,  -12,   71, -112,   45,   17, -104,   18,  -36,   43,   10,  -73, -122,  -21, -126, -104,
+         110,  -38,    2,   90,   23,   51,   25,  112,  -48, -116, -112,   45, -107, -113,   -9,  -67,
+         101,  -38,   58,   44,  -22,  -65,   23,   28,   32,  -96,  -46,   -1,    4,   96,  -42,   94,
+         -76,  -47,    9,   64, -120,  -34,   75,  -21,  -88,    3,  -76,   85,   97,  122,   35,  -23,
+         -96,  122,   -8,   95,   74,   -8,  -30,    8, -108,   89,  -96,  -54,  -22,  -44,  -35, -125,
+         123,  -44,   56,  -85,  -68, -123, -100,   64,  121,  -17,  -12,    2,  -96, -109,  122,   83,
+         -60,   11,  -43,   95,  -81,   64,    3,  -14,   42,  -93,   92,  -23,    9,   11,   48,  -65
+    },
+    { // oc 5
+          69,  -84,  -58,  -26,   85,   74,   -2,   -8,  122,  -86, -126,   -5,   28, -123,  103,   28,
+          10,  -23,   19,  -99,   57,   84,  116,  -30,  -20,   74,  -15,   -6,  -15,   16,   -1,  -92,
+          51,   80,  -72,  -64,   94,   38,  -46,   -6,   28,  -41,  -75,   32,  -40,  -48,  -33,  104,
+        -128,   23,   84,   97,   37,   98,    3,   49,    4,  -23,   67,   -2, -120,  -60,   32,   55,
+         -93,  -96,  107,   12,  113,   61,   19,   37,  -59,  -38,   71,   13, -100,  111,  101,   88,
+          75, -127,    8,  -70, -112,  -15,  111,    7,  -19, -118,  -73,   38,  -37,  -69, -113,  103,
+         -98,   16,  -60,   83,  -60,   95,   26,  122,  105, -115,   76,  119, -104, -121,  -39,  -93,
+        -126,   41,  -54,   39,   -5,  -43,   11,   16,   62,  -41,  -34,   73,   42,  -46, -107,  -28,
+        -101,   63,    1,  -40,  -44,  -76, -101,  -51,   34,   51,   31,   14,    9,  122,   45,   75,
+         -68, -116,   31, -111,  103,   46,  -17,  -97,  -51,  -80,  113, -115,   25,   41,   50,  -54,
+         114,    4,  -22,  -35,   90,  -59,  -66,  106,   98,  -25,  -35,  -91, -111,   97,    7, -111,
+         -81,   81,  -37,  105,   20, -103,  -83,  -95,  -63,  -86, -119,  -75,   18,   -7,  102,   46,
+          36,  -38,  126,   57,  -90,  -82,   26, -116,    8, -119,  -45,   -1,   65,  107,   59,  -10,
+         -36,  111,  118,   82,  -41, -101,  111,  104,   85,  -13,  -76,   45,   -7, -108,   19,  -58,
+         -73,  -44,  -91,  100,   38, -120,    2,  106,  -75,  118, -122,  -58, -109, -125,   66,   48,
+         124,  111,   36,  -92,    4,  -82,  -36,  -71,   71,  -66,   86,  -22, -101,  -69,   42,   -6,
+         -67,  -55,  124,  123, -127,   96,  -83,   39,  -73,   -7,   82, -107,  -93,   -3,  -95,   89,
+          71, -104, -105,   62,  -17,   14,  -43,   94,  -10,   21,  -10,   76,  -28,  113,   14,   56
+    },
+    { // oc 6
+         112,  -17,   89, -104,  -18,  -65,  102,  -14, -120,   -2,   21,  -20,  -11, -115, -124, -101,
+          48,   75,   63,   51,    8,  -95,   27,  -71,   -8,   38,   32,    1,  -46,   62,   48,   -8,
+         118,  -46,   30, -122,  -72,   74,   61,  -82,  -30,  -15,   73,   63,   54, -128,  -30,  -19,
+         -23,   89,  -37,   31,    2, -104,   85,   50,  -22,  -96,  -54,   29,  -16,  -15,    4,   97,
+          24, -117,  -49,  -54,  -50, -101,   87,  115,  103,   44,  -33,  121, -115,    7,   -8,   75,
+         -21, -116,  -25,  -10,   90, -111, -117,   50,  124,  -49,   89,   37,   16,   20,  125,  -65,
+        -117,   20,    0, -109, -113,  -46,  -50,  -70,   -6,  -57,   -1,   48,   -6,   -4,  -50, -114,
+          47,   91,  -64,   -2,  -29,  -77,   65,   72,   60,   38,   39,   54,  -63,  -73,  -23,   20,
+         -63,  120,   54,   98,   89,  -65,   72, -116, -115,  -59,   44,   91,   20,  107, -128,  -28,
+          42,   93,  124,   79,   38, -122,   79, -102,   82,  -89,   30,   98,   43,   30,  101,   51,
+         108,  -94, -124,  -24,  118,   93,   39,  -79,  -63,  -21,   -2, -110,  -84,  104,  110,  -70,
+         -55,  -27,   13,  -95,   70,   19,   76,  -33,   47,  -53,  -55,  -13,  -49,  -55,   58,  -80,
+          23,  -64,   48,  -35,  -31,  -35,   57,  -61,  120,  -60,    3,   58,  -74,   39,  -98,  -30,
+          11,  -87,   36,    5,  -20,   35,   71,    1,  -49,   27,  -83,   18,   80,   32,   25,  122,
+         -45, -128,   45,  -79,  -99, -128,  -82, -110,  -46,  -29, -100,  106,  104,   45,  -45,  -35,
+         -50,   54,   41,   38,  -70,    8,  -26, -101,   16, -127,  116,   71, -105, -124,  -98, -113,
+         -73,   11,   90,   98,  102,   -4,  105,   39,   72,   20,   41,  126,  -54,    2,  -95,  -72,
+          74,  -19, -116,  -14,  103, -108,  -80,  -43,  112,  -16,   23,   77,  -89,  -67,   31, -117
+    },
+    { // oc 7
+        -106, -110, -128,   56,  105, -103,    2,   38,   38,   15,   91,    7,   33,  -41,  -77,  -67,
+          31,   62,   61,  -25,   22, -115,  -77,   95,  -58,    0,  -19,   74,  -51,   10,  -26,   -3,
+        -128,  -74,   -2,  -14,  -41,  -90,   54,  -79,   12,  -40,  -81,   90, -100,  -80,  -83,  -15,
+          84,  -87,   23,   83,  -51,   25,  -98,  -47, -113,  -70,   82,  102,    1, -108,  -32,   28,
+        -123,   57,  -90,  121,  -74, -127,  -91, -126,   28,    4,   95,   30,   73,   -9,  -39,    2,
+        -113,  -29,   -6,  -26,   93,  115,  -33,  -43,   97,  -66,  -58,  -47,   45,  -88,    5,  102,
+         -15,   73,  107, -109,   32,   28,  -41,   42,   22,    3,    4,  117,  -99,    5,  -37, -121,
+         121,  -26,  -89,   19,  -97,  -82, -123,   39,  -54,   23,   14,   11,   57,  -87, -125,   54,
+         -50,   57,   78,   68,  -74, -116, -104, -118,    0,   45,  -11,   23,   -3,   15,   50,  -42,
+         -22,   32,  -30,  120,  -39,  111,   32,  -92,  -82,  -23,  -34,   12,   97,  -15,  -92,   10,
+         -66,   79,  -88,   89,  -72,   24,  -79,   86,  -12,   -3,   21,  -63,  -65,  119,   89,  -93,
+         -67,   86,  -88,  -17,  -31,  -70,   29, -126,   12,  110,  -53,  -11,    4, -112,   71,  -82,
+         -34,  -85,  -22,   11, -119,   38,  -20,  122,   34,   16,  109, -126, -119,  116,  -16,  -94,
+         -36, -121,  -43,   89,  102,  -30,  -75,   74,  -85,   53, -120,   -5,   67,  -86,   68,  -42,
+         -69,  -25,  -35,   -3,  -47,  -56,  -83,   69,  -26,   13,   16,   88,   39,   14,   85,   46,
+        -100,   93,  -51,   83,   57,  -56,   35,  -29,   16,  -65,  -10,  -15,  -96,  -24,   89,   99,
+         104, -103,  -53,   77,   36, -126,  -60,   12,   28,   70,  -52,  -99,   -7,  -96,   34, -118,
+        -104,   -9,  -55,   43,  103,   -9,   23,   98,   87,   55,  124,  -64,  -11, -119,  -43,  -78
+    },
+    { // oc 8
+         -33,  123,   86,  -46,   98,   14,  -30,  109,   16,  -57,  -66,   90,  -19,  -47,   64,   26,
+         109,  -23,   72,   10, -124,   81,  -83,  101,   22, -102,   75,  -90,   78,   50,   33, -113,
+         101,   84,  111,  104,  -63,  -96,  -92,   93,   10, -122,  -14,  -69,   34,   95,   79,  -31,
+         105,  -89,  -57,   65,   47,   69,  -23,   35, -105, -107,  -97,  -36,  -15, -101,  -24,    9,
+        -113,  -16,   56,  112,   50,   18, -107,  -87,    7,  -92,   23,   25,   88,  -34,  -77,   82,
+         -10,   14,   19, -100,  -87,   25,  -75,  110,  -89,  -45, -112,   41,  126,    3,   42,   15,
+         -62,   88,  -93,   20, -108,   64,   54,  -68,  -54,  -22,  103,  119,   -5,   93,  -75, -115,
+        -111,   -7,  -94,  -47,   92,   90,  -76,  -19,   72,  -48,    0, -123,  -30,  -51,   96,  -31,
+         -78,   19,  -52,   32,  125,   16,  -70,   88,   77,  -56,   59,   23,  -79,  -31,  -61,   55,
+          19,   60,  -42,  100,  105,   69, -124,  -78,  -91,  -35,  126,   19, -104,  -25,  -75,  -75,
+         -47,  -28,  -39, -116, -112,   50,  -93,  -79,  -93,  -11,   66,  -78, -116,   26,  -44,   87,
+          83,   22,   55,  -33,   99,  -77,  110,   99,   34,   57, -112,  115,   56,  -82, -110,  112,
+          79,  119,   81,   39,  -60,  -14,  102,   -2,  -15,  -55,  -11,  -34, -110,    7,   92,  122,
+          41,  -13,   -2,   13,   24,  -14,  -51,   44,   -5,   67,  -90, -108,  -69, -103,  -67,  -98,
+         -87,    5,  -28,   48, -102,   44,  117, -119,  -15,   59,  -13,  -10,   88, -104,   81,   98,
+          58,   83, -126, -100,  -56,   75,  -96, -117,  111,  -41,  -24, -102,  -74,   93,  -74,    6,
+        -128,  -15,  -40,   32, -106,  -40,  -48,   66,  -50,  -77,  101,  -79, -128,   48,  -68,  -86,
+          27,  -12,   72,  -76,   74,   83,  -68, -114,   48, -108,  -31,  -21,   11,   90,   94,   42
+    },
+    { // oc 9
+         -95,  103,   13,  102,   96,  -54,  117,  -53,  -35,   78,  108, -121, -113,  -74,  121, -104,
+         125,   28,  -10,   99,  -12,   88,  -72,   27,  109,  116,  -30,   29,   -3,  103,  -83,  -24,
+          96,   24,   81,   38, -106,    6, -117,  120,  -72,   45,  114,  -47, -125,   96,   80,   58,
+          18, -101,   85,  -28,  106,  -65, -116,   71,   86,  -29,  103,    9,    0, -125,  -89,   19,
+          80,   84,   27, -126, -112, -109, -119,  -43,   63,   95,   -7,   -6,  -61,  -68,  -22, -123,
+         -96,  -40,  -81,  100,   94,  114,   32,  -39, -114,  -11,  -17,  -14,   -5,  -48,   66,  -61,
+        -118, -113,  103,  -62,  -24,  -40,   36,   89,   92,   36, -113, -126,  -70,   57, -118,   36,
+         103, -124,   12,  -79,   -9,   98,  120,   36,   58,  -47,   50,  -42,   -4,  -49,  -81,   29,
+         -54, -111,  -39,  114,  -66,  -24,  121,    0,   22, -120,   35,   54,    1,    6,   58,   45,
+        -125,   87,  -46,   99,  -51,  -69,  126,  124,  -13,  -23,  -28,  -64,   20,  -91,  -97,   66,
+         -89, -128,   54,   24,  -64, -123,   20,  -18,   15,   45,  -71,   81,  -82,  108,  -51,   -6,
+          84,   28,   81,  -60,  -63,  -34,  113,   35,  125,  119, -114,   88,  -95,   52,   92,  -94,
+         -68,  -15,  -10, -119,  107,  -19,  -73, -104,   92,   40,  -93,   85, -111,  -49,  -18,   73,
+        -123, -116,  125, -101,  117,  -19,  -59,  -40,  105,  103,   -9,  -94,  -76,  -14,  -73,   91,
+         -11,   74, -103,  -12,   25,   20,   45,   93,  -93,   58,  -75,  -33,   94,   50,  -91,  -75,
+           5,   19,  -44,  114,  -41,   36,  -17, -119, -124,  -78,   23,  -40,  122,   74,   53,   84,
+         106,   -7,  -45, -109,   66,   21,  -24,   88,  -27,  -19,   33,   68,   87,  -12,  -61,  -90,
+          -2,  -70,  -64, -102,  -78,   -9,    4,  121,  -95,  -20,   52,  -19,   79,   81,  126,  -29
+    },
+    { // oc 10
+          82,  -58,   80,  -45, -107,   67,  -58,   -5,   37,   12,  123,   27,   80,  -61,   96, -125,
+          64,   77,  -90,   -1,  -89,   39,  119,   -2, -118, -111,  -73,   91,  -60,   31,  103,  -93,
+           3,  -47,  -82,    9,  -62,  -94,   86,  -52,   47,   18,  -98,  113,   19,   46,   98, -108,
+          76,  107,  120,  -75,   99,   24,   80,  101,   -3,  -85,    0,   -6,  119,  105,  -85,  -73,
+         111,   33,   50,  -47,   92, -104,   48,  -15, -124, -101,  123,  -69, -113,   24,  105,   17,
+          60,   59, -113,  -87,  -33,   39,   -4,  -83,  -91,  110,  -60,  -30,   83,  -39, -102,  -75,
+         -31,   19,  112,  122,   27,  -25,  -91,  -40,  -44,  -97,  -67,  114,   62,   20,   59,  120,
+         -39,  -26,   84, -115, -114,  -35,   96,  125,   -2,  107,   16, -104, -107, -122,  126,   -9,
+          72,   27, -127,  -32,   31, -106,  -93,  110,   -1,   17,  -41,   42,   37, -123,  -42,  -73,
+          -8,   -3, -103,  -31,  -32,   68,   53,   -7,   64,  125,   10,  108,  105,   19,  -31,   77,
+         -88, -103,  -22,  117,   90,    1,   71,   44,  103,  -54,  -97,   32,   38,  -73,   17,   37,
+         -23,  -22,  -43,  107, -100,   75,   15,    3,  -98,  -48,  106,   74,   65, -103,   -8,   46,
+         101,   26,  -71, -120,  114,  -69,   16, -103,   84,  -41,  -40,   59,  118,    9,   93,   53,
+        -118,  -64,   61,  105,   17, -109,   -7,   76,   12, -100,  -83, -106,   37,    4,   78, -123,
+         -28,   21,   79,  -31,  -21, -100,   86,  -56,  -22,   53,  -19,    4,  -34, -115,   32,  -32,
+          76, -119,   81,  111,   37,  -27,  109,  122, -127,   -2,   -3,  -29,  118, -125,  -15,  115,
+         -12, -114,   99,   54,  -84,  117, -126,    1,   42,   56,   54,   28, -114,   31,  -75,  -56,
+         124,  -10,  126,  120,  -27,  -20,   14,  -47,  -49,  -30,  -57,  -44,   25,    4,  -89,    6
+    },
+    { // oc 11
+          91,   16,   31,  -80,   -9,   63,  -82,   83, -102,  116,  -38,  -13,  -14,  -15,  106,  -70,
+         -82,  -72,   17,   49,  -33,    1,  -67,   27,  -47,  -82, -101,   67,   97,   55,   34,  -31,
+         -67,  125, -110,   88,   82,  -51,   -9,  -91,   -5,  -92,  -13,  -41,   62,  -16,  -54,   60,
+         105, -120, -118,  108,  -81,   49,  -12,  -29,   88,   -5,  -79,   31,  -24,    5,   18, -122,
+         -60,  -88,   24, -123,  115,  -30,    4,  -63, -110,  110,  -52,  -38,  -59, -121,   62, -113,
+        -112,  121,   98,  -18,   41,   -3, -121,  -17,    0,  110,  -68,   31,  -61,  100,  -27,  121,
+          64,    8,   24,   37,  -23, -103,  -59,  -79,   65,   25,  -22, -103,  -16,  -35,  -79,   -8,
+          60, -126,  -30,  100,   21,   47, -116,    4,  108,   57,  -12,  -88,  -40,  115, -125,  -62,
+         -63,  -97,   99,  -91,   94,   27,   61,  -15,  -65,   93, -115,  115,   85, -125,   89,   19,
+          53,   -3,   87, -115,   39,    5,  -66,   46,  -26,   98,   97,  -97,   53,  -48,   40,   74,
+         121,  -25,   65,  -64,   19,    1,   28,   66,  -98,   55,   65, -128,   -7,    4, -114,   42,
+          66,  -44,   46,   59,  103, -104,  -90,  -24,  109,   69,  -86,  -86,   55,  -84,  116, -100,
+          53,   65,  -22,  -82,  -65, -109,  -26,  -85,    2,  -41,  -10,   96,  -87,   16,  -63,   32,
+         -29,  -69,   74,  -87,  -72,  126,   29,   -1,  115,   51,  -49,  -83,   44,   89,  -50,  114,
+          63,  -93,  -95,   56,   12,  102, -119,   81, -111,  116,   61,   46, -100,  -69,  -61,   -6,
+          29,   10,  111,   32,  -69,   53, -106, -118,   56,  -49, -112, -114, -111,  -18,  103,   53,
+         -12,  -35,  -78,  -99,   -2,  -67, -127,   33,   93, -111,   -6,    0,  -73,   35,  -32,    3,
+         -39,   97,  -80,   34,  -27, -127,    8,   37,  -87,  -31,  -27, -103,  108,  -97,   45,  119
+    },
+    { // oc 12
+         115,  -85, -122,  108,  -58,    3,   74,   13,   59,  -77,  -26,  -91,   51,  -28,   34,  126,
+         125, -126, -101,    9,  -59,  -41,   99,  -59,  -98,   15,  -80,  111,  -46,   42,  -37,    7,
+         -81,  -35,  115,    2,  -83,  -33,  -31,  -59,   35,  -42,   -3,  -47,  -50,   64,   19,  -73,
+          87,  -97,  -82,  -14,  -78,  -61,   47,  114,  -59,  -47,   73,  110,  -94,   71,   29,   98,
+          18,   82,   47, -101,  -57,    7, -119, -124,   83,  -73,   80, -125,   15,   11,   -4,  -12,
+         -75,  -77,  -30,   91,  -61,  -54,   16,   26, -100,  -51,   17,   10,  -86,   41,  -91,   -6,
+         -40, -113,  -68,   76, -112,  -57,   19,   92,  125,    9,  -71,   68,  -37,   83,  101,  -54,
+         122,  -16,  -41,   15,  -13,   -6,  -93,    0,  -19, -110,   97,  121,  107,   25, -101,  116,
+        -106,  -79,  -28,  -37,  -23,  -95,  -30,  105,  -86,  -42,  -56,   78,  -47,  -99,  -72,  -32,
+          66,  125,    3,    5,  -36,   49,   88,  -75,   87,  -19,   93,  111,  -26,   78,   14,   80,
+          -8,   -1,  105,   68,   48,   -2,  -68,   -7,   -6,   18,    9,  -82,  -21,   89,   58, -100,
+         -37, -112,   -4,   28,   78,  -13,   82,   87,  -98, -106,   39,  -74,   80,   40,   52,  -35,
+         -94,  -88,  -93,  -65,    2,  111,   27, -103,  -68,   84, -105,   89,   -4,  -57,  121,   62,
+          75,  -90,   49,  -39, -114, -116,  -61,  -80,  -26,   17,  103,   80,   80,   67,   62,  -88,
+        -119,  -33,  -13,   48,   68,   19, -123, -108,  -42,  -12,   33,  -18,  -13, -100,  -83,  -18,
+          81,  -43,  -17,   65,   97,  -68,  -20,  114,  -40,   25,  -12,  -30, -111,   31,  115,   34,
+        -117,  109,  111, -120,   77,  -83,   81,  -69,  -72,   85,   55,  -82,   49,  124,  -39,  -53,
+         -27,   79,  -22,   59,   84,  -94,   63,  -81,  -58,   79,   30, -118,   19,   31,  -32,  -81
+    },
+    { // oc 13
+        -122, -122,  -81,   -5,  -82, -126, -124,  -98,   61,  -53,  -66,   -3,  -20,   59,   93,   84,
+          78,  -48,  -86,  -60,   50,  -77,   14,   85,  -79,   -6, -123,   76,  115,   22,  -54, -115,
+          38,   20,   69,  -36,   53,   69,  -68,   43,   27,  -43,  109,  -42,   33,  -79,   21,   49,
+         -91,  107,  -80,   60,  122, -107,  114,  123,    0,   28,   68,  -65,  -76,  -68,  -53,  -73,
+         -23,   97,   49,  -97,  124,  114,   65,  -35,   -4,  -23,  -58, -125, -121,  -93, -114,  119,
+        -120, -111,  118,  -65,  -31,   58, -125,   47,  -18,  105,  110,   63,   38,   11,   35,  -42,
+         -69,   36,   31, -109,   13,   99,  -78,   11,   77,   31,    9,  -53, -126,   93,  117,   77,
+          91,  -18,   93,  -36,  -92,  -26,   64, -120,   25,  -15,  113,   93,   17,   92, -105, -127,
+          46,  -67,   17,   33,   85, -115,   22,    2,   60,   55,  -90,   61,   42, -123,  -23, -105,
+         -73,  -79,   82,  -54,  -54,  -85,   47, -124,   -3,   17,  115,   49,  106,   13,    3,   88,
+         113, -113, -126,    8,  -83, -102,   -4,  -64,   48,   69, -105,   95,    6,    9,  -37,  -60,
+          43,  -19,  -26,  120,  -88,   86, -112,  111,  -26,  -87,   53,   78,   19,   46,  -99,  -20,
+          57,    6,    8,  126,  -82,  115,   21,  -21,   70,  -12,  -32,  -19,   92,   -5,  -60,  -11,
+         120, -107,   73, -114,  -58,    4,  -60, -118,  -61,   24, -118,    0,   30,  -88,  -64, -109,
+          22,  -44,  -87,  111,  -69, -128,  -85,   85,  -95,  -77, -110,   65,   94,   78,   30,   75,
+           4, -101, -113,  -78, -110,  -52,  -55,  -87,   97, -108, -108,   76,   45,  120,  -62,   55,
+           0,  -80,  -82,  -45,  -16,  -62,   50,  126,    0,  -48,  -46,  -90,   24,   83,   47,  -19,
+         -80,  -85,  119,   64,   33,  -90,  -41,  -40,  -83,  -57,  -97,   70,  -25,   -8,  -63,  -89
+    },
+    { // oc 14
+         -84,  -78,   64,  120,  -66,   66, -128,  -84, -106,  -31,  124,  -37,  -51,   62,   92,    2,
+          59,   43,  -28, -110, -106,   24,  -45,   22,  -19,  -13,   -2,  -94,  -95,   25,  124,  -75,
+         -58,   80, -110,  108,  -58,  -39,  -80,   -4,  -98,  -33,   85,   38, -116,   -4,  116,   44,
+          27,  119,    3,  -92,   20,  -38,  -45,   27,  109,  103,   59,  111, -112,  -80,   45,   47,
+          41,   89, -105,  -36,   76,   57,  -53, -118,  -82,  -86,   56, -125,  -65,  106,  -60,   62,
+         -62,  -16,  -67,   -4, -119,   55, -120,   87, -119,   58,  -14,  115,   37,  -44, -102, -120,
+         -14,  -86,  122,  102, -101,  -78, -103,  -30,  -65,   34,    7,  122,  -36,  -52,   20,    0,
+         112,  -64,   31,  100,   31,   95,  -45, -111,   41,  -98,   20,  103,   76, -105,   68, -123,
+        -128,  -33,  116,    5,  -50,   10,  114,  -49,   61,  -92,   57,    8,   67, -111,    7,  112,
+          53, -100,   50,  -19,   -5, -100,  -29,  118,  -63, -125,  -68,  -46,  -11,   13,  -10,  126,
+        -112,   -4,  -80, -125,  104,   -2,  -96,   -8,  -26, -116,   79,   20, -101,  -50, -127,   99,
+          78,   28,   -1,  -96,   41,   13,  109,   46,   71,   99, -113,   68,    2,  -64,    2,  -98,
+          13, -124,  108,   98,   46,    6,   59, -103,  -50,  120,  -45,   59,   50,   77,   40,  116,
+          73,   30,   73,  109,  113,  -85,   27,  -33,  -62,  -52,   47,   12,   41,  -46,  -50,  -19,
+          27,    2,   41,  116,  -78,  108,  -57,   14,   83,   68,   26,   17,    4,  -31,   53, -111,
+         -43,   36,   93, -105,  -13,  -21,  -99,   45,   27,   48, -113,  -67,   68,   46,   68, -124,
+         -53,  -63,  -59,    6,  -23,   99,  -86,  -91,   51,  -50,  -52, -125,  -39,   24,    1,   -9,
+          -9,  106,  -64,  -78,  -94,  -21,  -19,   14,    4, -108,   65,  -68,  -77,  -19,  -62,    5
+    },
+    { // oc 15
+         110,   70,  -60,   96, -123, -117,   37, -128,   41,   -5, -119,   31,   16,  -69,   90,   61,
+         -61,  -43,  -21,  -78,  -47,   17,   44,  -52,  -54,  -77,    5,  126,   31,  -79, -106,   66,
+         -39,  -95,  101,  -36, -121,   14,  105, -113,   44,   76,   39,   19,  -81,  119,  -88,   67,
+        -118,  -86,   31,    7,   42,  122,   39,  -38,  124,   19,   -2,  -90,   55, -101,  -92,  -22,
+         -48,   22,  -35,  -71,  101,   17,   92,   81,  -14,   13,  -62,  109,   -6,  -40,   32,  100,
+          64,   42,  -17,   64,   26,  -74,  121,  -67,  -87,  -81,  119,  -97, -106,   72,   27,    5,
+          55,   -4,   60,   72,   57,  123,  -40,   53,  -97,  -15,   80, -121,   30, -105,  -10,  -76,
+          95,   97, -124,  -70,    5, -102,  -44,    3,   58,   85,  -39,   27,   -7,  -67,  -65,   73,
+          52,  125, -126,  -38,   96,  -11,  -34,  116,  -10,   64,   -3,   -9,  -53,   -5, -115,   -6,
+        -120,   70,  -44, -122,  -25,   33,   44,   -5, -128,  -69,  121,  -15,  -59, -126, -116,   -5,
+         -63,  126,  -62,  112,    9,   80,  -53, -126,  -33,  108,    2, -109,   54,   50,   -7,   70,
+         105,   75, -123,    6,  -36,  -28,    4,   -9,  100,    8,   16,  -92,   -3,   90, -100,  -76,
+         123,   37,   24,  118,  107,  -12,  -80,   77,   97,  -68,   73,  -14,    4, -112,  -69,  102,
+        -118, -116,  -47,   75,   -1,  -76,  -86,  -27,   58,  -36,   27,   56,  -98,   57,  -37,   46,
+         113,  -85,  -60,    1,   59,    6,   54,   -7,   68,   80,  119,  -14,   21,   52,   33,   96,
+          69,  -51,  -21,   28,  -69,  -22,   32,   -9,   54,  -25,   66,   78, -114,    5,    0,   27,
+         -85,  -14,  -38,  -18,  -17, -109,   51,  -15, -124, -126,   97,   73,  -80, -120,  -54,   -8,
+          77,  -65, -115,  -57,   92,  100,  109,  -24,   28,  103,  -23,  -65,   47,   92,    2, -115
+    },
+    { // oc 16
+         -69,   62,  -66,  -27,   67,   37,   61,    8,   28, -125,   -6,  121,   -4,  109, -122,   65,
+         119,  -99,   -1,  -93,   53,  116,  -93,  -95,  -20,  -12,   42,  -41,  -26,  -51, -103,   23,
+          18,  107,    5, -116,   64, -113,   -3,   49,   29,   76,  110,  -77,  125,  -65,  -91,   48,
+         -74,   72,  108,   -6,  -72,   47,  -88,  101,  -49,  -97,   49,  -81,    6,    7,   38,  101,
+         -54,   79,   54,  113,  -37,  -57,  -63,  -37,  -60,  123,   53,   51,   43,  125,   70,  112,
+           5,    5,   98,   31,  109,  117,  122,   95,  -67,    6,   38,  -95,   10,  125,  -85, -120,
+         125,  -89,   -5,  -54,   82,  -10,  -86,   79,  -71,  -82,  -41,   43,  -90,   20,   97,    4,
+         -38,   82,    6,    3, -101,  110,   46, -123,  -36,   59,  126,   31,  -19,   97,   52,   15,
+          87,  -48, -128,    7,  -95,  -55,   36,  104,   77, -105,   94,  -95,   90,  -84,  -45,   73,
+         118,  -43,  -56, -128, -100,  -17,   98,   -8,  -37, -114, -106,   -2, -113,  -72,   41,   42,
+          13,  -84,   82,  -91,  -15,  -72,   -5,   50,   38, -106,  -98,   29,  -71,  -15,   -8,   -7,
+          45,   30,   85,   49,   41,  123,  118,   56,   70,   79,   48,  -28,   68,   36, -107,  119,
+         -35,   26, -113,  -78,  -95, -116,  -89,  107,   64,   46,  -69,  -26,  -79,  -64,   -3,   35,
+          83,    7,  -88,   21,  115,  111,    7, -111,   42,  -36,   -2,   28,   42,  -39,   90,   18,
+        -106,  -39,  -38,  -54,  -31,   64,   99,   65,    4,   63,   -9,  -77,   55, -115, -117,  -18,
+          19,  -37,  -86,  -46,  103,   -1, -112,  116,  -44,   22,  -18,   -4,  123,  -63,  118,   -5,
+          46,  121,  -63,  -92,   32,   84,  -91,  -59,  -51,   84,  -56,   19,  -19,   65,  -84,  -61,
+         -92,   99,  -37,   -5,   -4,   77,  -48,  -84,  116,   94,   25, -108,  -32,   82,  -75, -128
+    },
+    { // oc 17
+          16, -100, -109,  -24,  -28,  -54,   54,  -17,   61,   32, -115,    2, -115,  119,   90,  -80,
+         -68,   96,   38,   95,  116,  -95,   30, -127,  -72,   45,   -5,  -39,  -54,  112,   96,   87,
+        -106,   79,  -87,  -42,   49, -120,   89,   52,  -73,  -74,  -78,  -58,   16,  109,    2,    4,
+         -71, -105,  -22,   85,  -16,   31,  -74,  106,    4,  104,   78,  -16,   80,   31,   86,  -18,
+          40,   77, -121,   52,  -20,   95,  109, -114,   -9,   62, -117,  -27, -106,  116,  -18,   76,
+         -34,   65,    9,   62,  -77,  -28,   49,   98,  -57,  -24,   98,    6,   83,   60,  -11,  -13,
+          79,    0,  -34,  -39,  -46,  122,  -28,   22, -128,   35,  -86,   62,   47,  -12,  -38,   32,
+         103,   45, -124,  -14, -124,   43,  -56,  -51,   70,   37,  -13,   42,  -71,   32,  -50,  -63,
+          52, -124,  -81,  -13,  123, -108,   -7,  -42,  100,  117,   78,  124,   77,   -9,  -32,  -53,
+           8,   63,  -73,   67,  -46,  115,  -14,  -82,   65, -109,   63, -104,   67,  -55,  110, -106,
+           4,   49,  -40, -128,   84,  -63,   42,   63,   89,    5, -116,  -93,   58,  -35, -109,   80,
+         -23,   37,  -48,  -29,  -42,  -33,    4,  105,   80,   90,  -17,  -98, -109, -128,  120,   10,
+          76,  -16,  -23,    4,   37,   59,  100,  101,  -56,  103,  -80,  101,  105,  -27,  -20, -102,
+         -31,  -75,  116, -102,  110,  -31,  -19,   45,   -4,  -97,   65,  -25,   33,  -80,   66, -127,
+         -42,   48,   83,  -35,  -76,   73,   40,  -86,  125,   63, -111, -121,   97, -122,   68,   74,
+        -122,  -52,    0,  104,   66,  -75,   97,   94,   38,  -34,   31,  -61,   99,   30,   38,  -97,
+          49,   84,   51, -127,  -35,   62,    0,   52,  -37,  -66,  -41,  -47,   37,  -87,   70,   28,
+         -73, -126,   18,  -55,  -18,  106,   22,   27,  -39,   22,   32,   58,   85,  -77,  -61, -101
+    },
+    { // oc 18
+          25,   66,  -74, -101,   78,   17,   89,    1,  -15,  -69,  -16,   35,   -5,   87,  -10,   70,
+        -120, -120, -115,  -37,  -34,  -54,   93,   53,  -96,   17,   33, -108,  -32,   12,   -9,  -55,
+         -68,  -10,  -84,   96,  -98,   66,  -24,  -64,  112,  -44,  -44,  -64,  -39,   27,  -39,   79,
+        -120,   15,   50,   46, -120,  101,  -10,    7, -106,   98,   16,   -1,   91,  -29, -124,   73,
+          -4,  126, -113,   74,   80,  -99,   18,   74,   21,   70,    8,  -85,  -67,   57, -101,   36,
+         106,  -82,  -88,  111,  102,  -90,   -8,   34,   74,  -18,    4,   12,    6,   47,  -23,   91,
+           2, -110,  -45,  -66,   20,  -28,   52,   39,   11, -125,  -70,  -52,   75,    7,  104,   53,
+          58,  -67,   19,  121,   14, -128,   56,  102,  -11,  -48,  110,   37,   62, -123,   23,  112,
+         -11,   85,   10,    7,   17,  103,   84,  -45,   25,   81,   87,   42, -127,  -32,   86,   40,
+          49,  -48,   32,  -92,  -99, -111,   60,  102,  106,  -16,   32,   63,   64, -126,    1,  -25,
+         -68, -109,  -66,  104,   89,   55,  -88,   28,   78,   23,  -64,   16,  100,    8,  -81,  -97,
+          97,  107, -118,   41,   82, -106,  120,   41,   51,   70, -120,   92, -100,   83,   90,   26,
+          -9,  -18,   17,   45,   64,    4,   99,  103,  124,  -20,   16,   63,  -40, -105,   53,  -96,
+          -1,  -24,   13,   -2,  -62,  -23,  -21,  -57,    5,   26, -102,  106,  -79, -128, -121,  -46,
+           4,  101,  -43,   94,  -85,  -12,  -59,  110,  -59,   -3,   69,  110,  -43,  -10,   94,  -39,
+        -127,    0, -117,   50,  -32, -123,  -56,  -25,  -81,   36,   46,  -11,  -32,  -26,  101,  113,
+        -103, -108,   55,  122,   95,   -5,   96, -128,  -53,  101,  -13,  125,  -27,  -65,   78,   -9,
+          76,  -40,   13,  -68,  -34,   74,  -93,  -51,   -2,   72,   83,  122,   44, -125,  -15,   69
+    },
+    { // oc 19
+          54,  -66,   66,  122,   52,  -83,  -93,  -89, -119, -111,  108,   58,   55,  123,   71,   46,
+         -70,   79,  -93,  -20,   -9, -126,   32,  -54,  -42,   87, -101,  -97,  -45,   75,  -71,  112,
+         -13,   99,  103,   83,  -93,  -53,   56,   90,   -6,   66,    8,  -16,   19,   89, -122, -100,
+          47,   12,  109,  -70,    7,   83,   12,   94,   50,   55,   77,  -23, -110, -116,   97,  123,
+         -38,   45,  -34,   73, -125,   71, -110,  101,   16,   91,  -28,   44, -128,   68,   -1,   16,
+          28,  -33,    1,  118,  -78,  125,   43,  -45,   77,   25,  -46, -113,  -45,  -80,   15,   21,
+          50,   67,   34,  -57,   36,  -93,  -67,  -78,  -40,  -76, -110,  -58, -105,   70,  -35,  -78,
+           6, -107,  110,  -97,   71,   -5,  -57,   55,   87,   96,   42,  -73,   37,   57,   75,  -64,
+          25,   32,  -89,  -80,   24,   54,  -42,   42,  103,   91, -107,  -49,   19,  110,   37,   25,
+          40,   46,   25,  -88,  112,    5,  -35,   59,  -66,  -45,   17,  104,   -2, -101,  120,  -12,
+        -104,   82,  125,   64,  -39,  -20,  -86,   84,   15,  -75,  102,   72,  -98,  -21,   94,   73,
+          11,   44,  -12,  -29, -102,   88, -112,   40,  -29, -105,  113,  -79,   98,    6,  -21, -123,
+          45,   63, -104,  123,  -59, -110,   65,  -83,  -41,   33,   50,   29, -111,   18,   30,   39,
+         -85,  -78,  119,  -35,   20, -120,  -71,  119,  115,   86, -114,   66, -116,   73,    9,   29,
+          10,  -66,   31,  109,  -61, -121,   70,  -12,   93, -116,   50,   21,   73,   97,   20,  -12,
+          68,   66,   24,  -66,  -70,   97, -117,  -49,    4,   12,  -61,  117,  -68,   55, -105,  121,
+         -82,   96,   96,  -97,    5,  -76,  -16, -108, -125,   34,   82,  -27,   -1,  -27,   41,    4,
+          39,  -37,   -4,   84,  -52,   20,  -93,   96, -103,  126,   71,  -25,  121,  -15,   -8,  -75
+    },
+    { // oc 20
+        -100,   93,  -41, -128,  106,   20,  113,  -71,  -67,   98,  -48,  120,   77,  -75,   72,  -29,
+         -89,  -46,  -72,   15,  123,  -38,   75,   -6,  -37,   96,  -42,  -36,   -2,  -35,  -34, -120,
+        -112,   -7,  -83,   67,  -75,  -23,   10,   70,  106,  -45,  -45,  100,  -20,  -28,  115,    7,
+         -58,  -16,   -3,  -34,  -22,  -81,  -17,   12,   85,  -43,   38,   -6,   45,  101,   75, -118,
+         107,   30,   64,  -89,  104,  -92,   -3,   66,   84,  -30, -126,  -39,  -34,  125,   44,   86,
+         -33,   42,    5,  -30,   -1,   59,  -70,  118,  -91,  116,  -65,   14,  117,  114,  -93,   -9,
+          16,  -62,   -7,  -38,  120,  -53,  -62,  -10,  -91, -103,   47,   -4,  -95,   93,   59,  -40,
+          57,  -45,   56,   18, -123,   87, -104, -100,  -10,  -30,  -17,  -55, -120,  -35,  -56,   10,
+        -107, -106,   75,   31,  -75, -119,  103,  -15,  -14,  -51,   60,   32,  -58,   87,  -76,   -1,
+          10,  -13,  125,   60,   13,   42, -115,  107, -115,   13, -114, -118,  -16,  -57,   58,    7,
+        -105,   60,   12,  101,   95,   50,   18, -119,   32,  -66, -106, -109,  -83, -123,   22, -119,
+          88,   41,   10,   15,  104,  -82,  -74, -105,  -24,  -47,   67,   64,    1,  -57,  -82, -121,
+          78,  -63,  -53,   62, -128,   -3,  -45,  101,   27,   37, -100,   93,   64,   31,   11,  107,
+          16,   53,  109,  -18, -119,  -19,  -40,   -8,  -34,   51,   22,    4,  113,   -1,   61,  118,
+         -60,  118,  119,   78,   -6,  -32,   16,  121,  -15,   75,  -33, -101,    0,  -41,   30,  -33,
+        -104, -112,  -12,  -99,  -56,  116,  -79,   -1,  -84,   35,   39,   80,  112,    4, -100,  119,
+          71,  107,    6,  -40,   96,  102,    5,   63,  122,   34,    3,  -42,  -12,  125,  -57,   29,
+           8, -114,  -10,  -13,    5,  -69,  -87, -123,  -98,   38,   51,    7, -127,   93, -126,   35
+    },
+    { // oc 21
+        -100,    0,  -86, -110,  -87,    1,   73,  121,   83,  -41,  -68,  -69,   11,  -40,  -59,   47,
+           1,  -56,  -38,  107,  124, -119,   65,  -74,  -55,   -5,  113,  -69,  112,   53,  -49,  -43,
+          27,   65,   93,   -8,   89,  119, -108,  -66,  -84,  -85,   77,  118,  123,   34, -127,  -36,
+         111,   88,  -88, -117,  116,  -31, -101,  117, -111,  -28,  124,   95,  -43,  -56,  104,  -94,
+         -30,  119,   96,  -28,  -32,  124,   30,   43, -114,   16,   18,   31,    4,  111,   38,  -67,
+         -40,  -42,   15,  -85,   48,   55,  -54,  -11,  -79,   53, -124,   53,   95,   36,  -71,  -95,
+         -86,  -87,  -12,   25, -100,  -27,  -99, -120,  -96,    3,  -69,   46,  -86,   78, -103,  104,
+          93,    1, -114,  -21,   36,   70,  -14,  -61,  -33,   45,  116,   73,   26,   24,   99, -111,
+        -126,   22,  -82,  -55,   28,   13,  -38,   32,   68,  -54,  -48,   95,   32,  122,  -17,  -24,
+         109,  -53,   17,   95,  -90,  -47,  114,  -41,  124,  -64,   76,   23,  -27, -101,   57,   34,
+          14,  -85,   44,    8,  -38,  -68,  -84,   18,  -63,   45,  -11,   87,   37,   -4,  -61,  -68,
+          33,   80,   47,   -7,   58,   94,   48,   31,   28,   10,  110,  111,   17, -126,   68,  -20,
+         107,  112,  -94,   87, -126,   87,  -10, -122,  -21,   21,  -95,   28,  125,   39,   22,   99,
+        -115,   47,    9,  -99,  -10,   76,  122,   75,  -98,  123,  -20,  -45,  -60,   16,   91,   36,
+        -117,  100,  -43,   44,   17,   -7,  -95,   35,  -57,  -27,   66,  -94,  -86,  -59,   28,  112,
+        -103,  -32,  125,   77,   49,  -66,   89,  -36,  -58,  -77,   68,   70,   14,   36,  -98,   45,
+         -77,   92,   -6,   90,  -53,  -24,   -4,  -55,  -83,   11,   50,   98,  -56,   34,   35,   96,
+         -25, -101, -113,  -18,  -42,  -97, -109,   68,  121,   27,   -1,   56,  -34,    9,   99,   82
+    },
+    { // oc 22
+         -59,   61,  -39,    9,    6,   20,  -52,   19,   87,   23,  -43,  -84,   43,   14,  106,  -44,
+          16, -100, -107, -119,   60,  -89,   64,   38,  -49,   42,   51,   25,  -83,   25,  -52,    2,
+          46,   39,  -58,   15,    1,  115,  -45,  -27,    9,  -11,  -75,   13,  -50,  -92,   38,  -63,
+          -1,  -69, -109,   73,  -95,  111,  -50,   20,  -76,  101, -109, -117, -102,   48,   -7,  -77,
+          68,    2,  114,  -59,   61,   63,   11,  -39,  -63,  -24,    9,  124,   53,   64,   66,  -24,
+        -101,  120,  -77,   60,   67,  -46,   41,   27, -109,  -82, -112,   61,  -98,  -76,   -5,   24,
+          50,   62,   65,   10,   14,   60,  -17,   70,  -88,  -28,   13,  104,   73,   35,   62,   94,
+         -79,  126, -108,   65,   57, -113,  -16,  -10, -124,  -80, -116,   48, -108,  102,  -74,   53,
+          54,  -51,  -33,  -11,  -19,  -65,  -47,   18,  110,   26,  103,  -28,   86,   62,   29,  -47,
+        -100,  -31,  -57,  -66, -100,   76,   50, -102,  -81,   76,  -36,  123,   14,   73,  -66,    5,
+         -32,   -3,   35,   51,  -74,   84,  -89,   63,  -31,   66,  -84,   77,   78,  -17,   96,   56,
+         -51,  -56,   89,   78,   11,   38,  -71,   50,   21,   57, -107,  -92,   60,   81,   61,   76,
+         -22,   81,   74,   63,   66,   13,  -68,   78, -102,  -71,   23,  -22,  -92,  -20,  -42,  -23,
+         -97,   82,  -47,  -83,   91,  -29,   28,   32,   21, -122,  -74,  -69,  -70,  -15,  -41,  -72,
+         -17,   42,   28,   68,  104,  -24,   48,    8,  -67,   50, -124,  -61,   36,  -38,  -27,   30,
+         -13,   83,   18,   21,   29, -128,   51,   18,  -43,   15,   68,   58,   67,  -67,   56,  -92,
+         -55, -123,  -19,   64,   35,   42, -113, -119,  -41,  -91,  -15,  -22, -126,  -97, -102, -103,
+         -62, -122,  -43,   57,  105,   88,   29,  -98,   21,   27,  -58,   98,  -90,   -1, -106,  -89
+    },
+    { // oc 23
+         -48,  -44,  -75,  -75, -102,  -14,   89,  -82,  111,   15, -107,   71,   65,  -91,  -72,  -60,
+          57, -117, -115,    0,  116,   29, -116,  -19,    6,   92,  -97,  -10, -101,  103,  120,   43,
+         -51, -103,  -70,  -77,  -49,  -10,   85,   -3,  -84, -125,  -24,  115,   97,  -91,   86, -105,
+         -46,  -62,  103,   12,  -69,  115,  -29,  -47,    9,   69,  -56,   94,   46,  -86,   -8,  110,
+           4,  -91,  119,   57,   56,  -83,  -14,   34,  -92,   92,   65,  101,   71, -128, -111,  -78,
+          93,  -21,  123,  -23,   -1,   12,  -15,  -62,  -40,   71,   75, -102,  121,  -48,  -43,  -13,
+          22,  118,  -41,  -23,  -50,  106,   34,  -46,  -48,   13,   31,  -56,   59,  -70,   17,  114,
+         -25,   91,   88,   26,  -71,   21,   75,   26,   21, -108,  -47, -123,   56,    3,   64,  -36,
+          -5,  -10, -127,  -67,  -44,  124,  116,  118,   21,  -40,   67,  -66,  108,   69,  -82,  -61,
+          79,   25,   16,  -22, -102,   28,  107,  -68,  -28,   -4,   25, -102,  -46,  -11,   97,  112,
+         122,  -20,  -33,  -28,   72,  122,   30,  -86,   43,   31,  -75,   20,  -58,   84, -120,   98,
+         -18,   22,   49, -117, -108,   43,  -32,   85,   57,  -37,   97,   60,  -83,   86,   40,   41,
+        -126,  -13, -118,  -14,  -30,  -80,  -31,  -64,  -64,   96, -105,   11,    1,   10,  -83,  115,
+        -106,  101,  -93,  -15, -126,  108,    3,  102,    7,  -75, -100,   46, -104,   -3,  -78,  -62,
+         -98,  122,  -80,  -85,  -29,   -2,  -19,  -80,  -31,   39,   29,  -37,  101,  -16,   47,   95,
+         -64,   97,   54,    5,   66,   -6,   -2,    7,  120, -114, -111,  -98,  -57,   -6,   84,  -13,
+         -66,   32,  -14,   24,  -84,   21,  -24,  118,  -96,   28, -123,   95,   84,   74, -111,  -59,
+          40,  -97,   53,  -41,    0,   32,    6,   67, -117,  -76,  -26,  107,   25,  -25, -105,  -39
+    },
+    { // oc 24
+          84,  -91,  106,  -71,  106,  -85,   61,   76,   57,  -32, -105,   67,  -59,   58,   51,   21,
+          79,   -3,   15,   55,   57,   61,    5,   22, -112,  125,  -81, -123,  -45,  -65,   -4,  116,
+         -29,  115,   23,   -3,  -60,  -41, -128,    4,   98,   93, -112,  -62,   -1,  110,  -68,  -93,
+          37,   33, -125, -103,    1,   77,  -51,   64,    2, -108,   14, -116,  -99,   68,  -71,  -67,
+         -51,   17,    3,   88, -106,   27,   -6,   41, -105,  -93,  -97,   72,   81,  122,  -31, -117,
+         -21,  -66,  103,   84,  -64,  -35,   37, -115,   56,  -12,   23,  -78, -111,  -77,   81, -120,
+          43,  -69,  -35, -107,   42,  -70,  -21,   42,   49,  -57,   -4,  -72,  -24,   21,   54,  -59,
+         117,   37,  -43,  -74,  -64,  -41, -104,  -51,    2,  -72,  125,  -77,   91,   90,  116,   90,
+         -14,  -90,  -74,  -30,  -46,  -54,   -6,    3,   78,  111,   76,  115,   56,  -87,  -90,  -88,
+         -71,   53,   10,   72, -102,  -67,    9,  -13,  -93,  -12, -115,   70,  102,   30,  -74,  109,
+         -82,   92,   55,  124,  -12,  -70,   84,   18,   91,  -92,  -20,   84,  -88,  -10,   -4, -105,
+          69,  -87,   18,  -74,   13,  -82,  -81,  -49,   85,   27,  -96,  -35,  -29,   23,   70,   51,
+          27,  113, -120,  -26,   55,  -74,   10,   67,   64,   57,    3,   86,   -9,   56,  -96,   99,
+         -44,   72, -124,   71,   70,   68,   20,   42,   21,   30,   12,   26,   47,  117,   85,   63,
+        -108,  -18,   62,  -18,   93,  121,  -61,  -99,  -94,  -43,  116,  122,  119,  -24,  123, -117,
+         -25,  -15,  -16,  106,   -4, -111,  122, -126,  -94,   59,  126,   53,   33,  -87,    4,  -25,
+         -65,  -57,  -22,   60,   85,   12,  120,    8, -113, -107,   37,  -68,  -91,  -33,  -45,  -39,
+          97,  -71,  119,  110,   59,   36, -123,  -64, -100,   76,   69,   37,   84,  108,  -71,    4
+    },
+    { // oc 25
+          30,  -96,  -47,  -16,  -81,  -89,  -61,  -16,  -99, -124,   77,  120,   75,   43,   38, -124,
+          44,   34,  -71,  -41,   42,  -92,   55,  -94,  -23,   85,   -6, -119,   47,   31,   75,  106,
+         -12,  -12,   65,  -69,   53, -117,   97, -113,   -7,  -56, -112,  -99,  -10,  -67,   95,    2,
+         -41, -115,   52,   51,  -38,  107,  -49,   11,    8, -122,  -36,   45,   37,   53,  -49,    1,
+          25,   15,  -84,  -13,   54,   43,   -1,   58,   -1,   41,   60,   82,  -34,  -44,   -7, -100,
+          17,   86,  -86,   79,  -95,  -14,   63,   17, -101,   28,   89,   89,   30,   19,   80,   16,
+         115,  117,  -61, -114,  114,  -38,  106,    5,  -45,   42, -116,  122,   91,   34,  -65,  -22,
+         -65,  100,   59,    3,   15, -123,  115,   39,   -1,  -90,   23,   58,  -42,  -12,    2,  122,
+         106,  117,   47,  -51,  -96,  -50, -114, -126,  -51,   56,   41,  -55, -125,   55,  -60,  113,
+         -47,   60,   97,    1,   68, -122,  101,  111, -110,  116,   31,   46, -104,   99, -111,   21,
+         -29,  -76, -127,  -65,   83,    6, -111,   61,   17, -115,   48,  -59,  -35,  114, -118, -125,
+          60,  108,  -54,  -66,   38,  -89,  -22,   71,   81,  120, -102, -116,   -4,  -43,  -80,  -93,
+          27,  -15,  102, -100,   52,  -19,   -9,  -35,    8,  -63,  -85,  -90,  -91,    0,   -7,   23,
+        -106, -113,  -26,   52,  -35,   34, -107, -105,  -68,  -24,  -26,  -61,   -5,  -46,    5,  -51,
+         -99,  -21,   37,  120,  112,  125,   27,   95,   36,  -39,   38,  -39, -116,   60,  -78,   24,
+          38, -125,   86, -105, -104,   12,   17,   37,   44,   72,   -1,    8,   31,   38,   26,  -47,
+          60,    2,   12,  -81, -125,  -87,  116,   60,  111,   19, -125,  -45,   37,  -11, -128,   -1,
+         -79,   79,   89,   -2, -116,  -92,   19,    5,  -27,   74,  -51,   56, -119,  117,   76,   69
+    },
+    { // oc 26
+         104,   25,  -82,   23,   94, -124,  -97,  116,  -62,   16,   15,   74,   93,  -72,  -77,   93,
+          61,  -19,  -44,   -4,   62,  -49,   39,   60,  -16, -117,   38, -102,   52,  -78,   73,  105,
+           5,  -57,  -36,  117,  -75,  -27,  -55,  121,  109, -104, -115,   11,   96,   26,   54,   95,
+         -95, -124,  119,  -76,   66,   27,   53,   84,  -94,   42, -103, -122, -100,   49,  -71,   96,
+          77, -104,   -5,   45,  -18,  105,    1,    7,  -17,  -49,   30,   92, -110,  -28,  -81,  126,
+         121,  -56,   98,   23,   13,  -11,   22,  -87,  121,  101,  -61,   93,   98, -113,  120,  -34,
+         -35,   15, -118,  -37, -105,   24,   72,   70,  -33, -115,  -20,   87,   70,   71,   59,   32,
+          80,   39,   22,    7,   66,  111,   74,  -42,   22, -101,  -25,   37,   73, -103,  -44,   75,
+           7,  -30,    7,   27,  -56,  102,   15, -113,  -46,  -29,  -15,   48,   61,   -2,  -55,   72,
+         -79,  -36,   23,  120,  -90,  -69,  -45,  -22,  -52,   87,  -21,  101, -127, -101,  -34,  118,
+        -112,   73,   75,  -74,  -22,   80,   74,  -49,    4,  -72, -104, -107, -110,  -86,   90,   -5,
+          30,   12,   19,   93,   48,   -6,  -93,   59,   -4,   27,   19,  107,  -17,   59,    6, -122,
+        -114,    9, -109,  -30, -127,   74,  -30,  -53,   78,   26,  -87,  113,   26,   73,   54,   17,
+        -123,   88,   29,   69,  102,   73, -123,   79,   37,   85,  -49,  -26, -125,   26,   50, -120,
+         -63, -122, -107,   -1,   38,  -35,  -20,  -18,    0,  108,  -41,   23, -105,  -93,   38,  -23,
+         -43,   -5,   77, -101,    7,   84,   44,   48,   88,   36,   94,  -89,   33,   66, -100,  -32,
+          47,   53,   89,   53,    5,   94,   57,   36,   91,   61,   58,  -48,  -80,  -96,   59, -121,
+          27,  -97,  110, -124,   -9,  -73,  -96,   48,    0,  -55,   47, -105,   55,   54,  -49,   95
+    },
+    { // oc 27
+          12,   79,  -67,    1, -121,   84,    0,   70,   60,  124,  -83,  110,  -23,   59,  -91,  -87,
+         -77,  -66,  -45,   72,    4,  124,  112,   84,  -41,  -33,   43, -115,  -58, -109,   53,   98,
+        -104,  -25,  -43,  -71,  120,   35,   81,   63,   74,   29,  -89,  -70,   35,   77,   -5,   87,
+         -89,  -38,  -42,    3, -108,   18,  -85,  -37,   16,  -77,   63,   16,   51, -113,  -22,  -60,
+         -30,  -27,   83,  -53,  -67,  107, -106,   98,  -77,   11,   94,   31,    4,  -16,  -67,   28,
+          37,   47,  -22,  -24,  -33,   88,   -5,   81, -126,   50,   39,  119,   30,  109,  106,  -80,
+          66,  -62,   45,  -36,   19,  -55,   71,  -26,  -39,  -19,  -22,    9,   86, -114,  -86,  -78,
+        -101, -111,   90,   73, -124,  -71,  -19,  -38, -112,  -64,  -16,  -18,  -42,  -85,  -89,   21,
+          42,  -71,  -67,   82,  -83,  122,  -78,   15, -115,  -22,  107,   87, -101,  -85,  -84,   53,
+         126,  -12,  123,  -44, -115,   87,  -41,  -65,  -87,  -60,   97,   45, -115,  -54,   -7,   31,
+          91,   53,   48,  -99,   97,  123,   72,  -86,  -59,   57,   31,  -60, -105,    7,  119,   43,
+         -39,   93,  -98,  -48, -120,  -86,  -38,  -62,  -55,   60,   -4,   69,  -84, -111,  113,   19,
+        -112,  -72,   95, -124,  -17,   58,  -13,    1,  -71,   13, -107,  110,   72, -124,  -59,   35,
+         -67, -118,   73,  -44,  122,   -1,   78,  105,  -40, -121,   58,   29,  -57,   13,   69,  126,
+          12,   36,  -96,   22,  -45, -117,  -64, -110, -116,   74,   32,  -33,   -9,   85,  -55,  -22,
+         121,   72,   52,   23,  102,   92, -124,  -60,   91,  -60,   84,  -34,   93,  -11,  -64,  115,
+          10, -109,   52,  -23,  -36,  116,   39,  -28,   49,  121,   31,  -18, -112,   22,  -55, -100,
+          91,  -12,  -18,   38,   69, -108, -108,  -81,  121,   96,  -72,  -83,   31,  -91,  -98,  -32
+    },
+    { // oc 28
+         -56,   22,  -90,   61,   47,   47,  -89, -114,  110,  104,    6,   69,   35,   -8,   59,  -69,
+          -1,   -4,  124, -101,  -78,   13,  -46,   -9,  126,  -62,   52,   84,    7,  103,    2,   65,
+         -20,  -77,   83,   56,   44,  -49,   46,  -54,  -13, -122,    0,   53,   -8,  -74,  -54,   90,
+         -94,   21,  -23,   94,   25,  105,  -29,  -60,  -96,  -27,  -84,  103,  -28,  104,  -12, -114,
+          -6,   37,  -54,   85,  -81,  126,   62,  -67,  -26,  -89,   93,  -72,   79,   79,   90,  -57,
+          50,   68,   64,   -9,  -62,   22,   33,   50,   25,  -81,  -45,   19,  -79, -127, -118,  -87,
+         115,  104,   62,  -16,  -20,  -97,   72,  115, -117,  -75,  122,   54,  126,  -80,  -40,   79,
+          27,   -4,   19,   54,   79, -114,   93,  122,  -65,   19,   -4,   -4,  -37,  100,   98, -110,
+         -74,   51,    3,  -83,   36, -105,  108,  102,    1,   92, -115,  -95,  -36,  -23, -116,  -73,
+          34,  -54,  -36, -105,  -13,  -69,   23,   89, -110,    4,  -80,  -12,  -20,  100,   74,  114,
+          81,  -42,  -43,  -16,   28,   -9,   11,   23,  120,  -28, -118,   27,   74,   86,   47,  -75,
+          84,   20,    1,  -45,   36,  116,  -29,  -67,  115,   60,   19,  -65,   86,  104,  116, -110,
+         -56,  -69, -102,   93,  110,   68,  -81, -106,  126,   98,  -50,   94,  -61,  -87,  -56,   63,
+         -58,   15,   63, -126,   76,  114,  101,   61,  -26,  -76,   97, -100,  -84,  -36,  102,  -85,
+          10,  -79,   70,  120,   80,   53,  -85,  -57,   12,  -96,  -96,  -72,  -73,  -28,  -73,   97,
+          65,   44,   56,   64,  110,  108,  -75,  -77,   24,  110,  -12, -115,   45,  -35,  -37,   -4,
+        -121,  -52, -116,  -33,  -35,   15,  -13,    1,   37,   -3,   28,  -14,  -31,   15,   38,   85,
+         -93,   42,   -4,   66,   87,  -93, -127, -105, -120,   34, -102,   81,   49, -114,   13,  -32
+    },
+    { // oc 29
+         -71,   12,   22,   17,   52,  -74,   74,   78,  -19, -116,   90,  -53,   88, -121,    5,   69,
+          97,  -12,  -10,  -83,   32,  109,   96,   94,  -68,   46,   60,   29,  -12,    5,   13,  -60,
+         -66,  -22,  -22,  -77,   45,  -82,  109,  -71,   66,   50,  -14,   36,   62,    7,  -12,    9,
+         -51,  -33,  -53,  -40,   95, -123,  -58,   17,  -90,  -37,  -42,    5, -101,   53,  -19,   98,
+          -7,  -94,  -56,    7,   49,   99,   76, -124,   72,    5,   34,  -13,  -87,  -40,   73,  -44,
+        -108, -117,   18,  -62,  108,   72, -117,  113,  -30,   33,  -14,   19,  -17,  -51,  -61,  117,
+         120,    4,   30,  -96, -109,  -44,  -41, -105,  -10,   10,  -50,   42,   -5,   -9,  -95,  125,
+          -9,  -74,   18, -113,   15,  -13,    8,   69,  -86,   22,   75,  -71,   23,  -53,   59,   84,
+         -85,  -19,   23,   49,    1,   86,  -26, -114,  123,   26,   81,  -35,  118,   23,   43,   84,
+           4, -102,   -4,   27,  -51,   92,   40, -116, -118,   12,  120,   17,   50,   13,  114,  115,
+          22,   68,   57,   86, -124,   70,  -65,   54,  -42,   94,   78,  119,  106,  -33,   96, -102,
+         -92,   57,   69,   28,   17,   -8,  125,  -97,  104, -120,  -24,  -53,  102,  -64,  -92,   23,
+         -35,   31,   40,   33,  -96,   53, -108, -112,  -84,  -42,  107,   34, -113,   91,  -46,  -83,
+         -60,   47,    1,  -89,  -14,  -48,  -31,   47,  -37,  -21,  -65,   87,  -80,   49,   75, -104,
+         122,  -23,   40,   92,  -70,    3,  -99,  -34,  -93,    6,  -44,  -21,   44,  -39,  -76,  -49,
+        -102,   26,  -15,  -70,  -32,  -58,  107,   -1,   97,  -67,  -16,   51,  -18,  114,  -51,   11,
+          -9,  -62,    2, -123,  112,   11,   46,  -11,  123,   65,  -79,  -52,   73,  115,   67, -117,
+        -125,   22,  -47,  -83,    7,  -39,  119,   72,  -96,   61,  -43,  -67,    5,   70,  -87,  -69
+    },
+    { // oc 30
+         -81,  -97,  -33, -128,   -9, -114,   96,  123,   79,  -31,    9, -121,   75,  115,   10,  -56,
+          -8,   97,  123,  111,   -6,   37,  123, -122,   23,   36,  -15, -101,  -25,  -36, -128,   79,
+          20,  -92,  -76,  -84,   87,   63,  124,   -9,   14,  -24,  -54,   -9,  -22,  -49, -120,  -91,
+         -68, -109,  -43,  -83, -100,   -4, -116,   38,   40,  105,  113, -118,  -54,   41,  126,   64,
+        -108,  -41, -128,   62,   42,    6,  111,  -89,  -64,    6,   72,   79,  116,  -52,  -23,   37,
+         126,  -86,   89,   88,  -20,  -78,  -85,   39,  -71, -117,   50,   79,   93,  108,   -6,  -80,
+         -66, -103,  -76,  -28, -104, -122,   -7,   11,  105,   29,  122, -106,   11,  -84,  -56,  122,
+         115, -100,  -72,  -23,  -83, -124,  -24,  -54,   -9,    5,   -4,   11,   79,  122, -104, -112,
+        -103,  -35, -110,   87,   34,   36,   99,   10,  121,   65,  -98,   13,  -98,  115,   18,  -83,
+         -54,  -10,  -60, -128,   -1,  -24, -125,  -28,  -95,  -23,  -97,  122,  -68,   17,  -31, -103,
+         -36,  -13,   10,   88,    7,  -22,   85,  -79,  -47, -103,  -25,   -7,  -23,   13, -107,  -77,
+         -12,   31,  -93,  115,  -74,  -93,  -60,  -69,   93,  -36,  -74,   12,   83,   86,  -73,  -89,
+         -88,  -41,  -26,  -88,   17,  -68,  102,  -44, -123,  100,  -21,  -35,   54,   -6,  -63,  -59,
+         -12,  -46, -121,   -4,   14,  -53,   -5,   28,  122,   99,  -51,  -33,  110,  106,   86,  -66,
+           2,   63,  104,  114,   54,  -33, -123, -103,  -25,  -91,   25,   57,  -38,   39,   54,  126,
+          37,   80,   95,  -21,   64,  -58,  -22,  -24,  -77,   78,  -13,  103,  125,  -73,   99,   -5,
+           6,   31,  -77,  -59,  -93,   91,  113, -122,  -22, -103,   65,   42,  -27, -100,  -95,  126,
+         -62,   43,    3,  119, -101,   94,   86,   80,   17,  115, -104,  116, -121,   51,   -3,  -75
+    },
+    { // oc 31
+         -63,  -25,  -48,   71,   96,  -10,    0,  -27, -126,   66,   63,   95, -119,   20,  -62,   76,
+          10,   58,  -89,  108,  -35,  -79,  -10,   28,   67,  -53,   35, -117,   19,  -15,  -61,  114,
+          21,  -18,  -19,    4,   24,   22,  -60,  -79, -114,  -22,   92,   18, -120, -118,  -65,   56,
+          -5,   30,  -59, -120,    8,  116,  -16, -108,  -69,   46,  -60,   49, -104,  -18,  -73, -103,
+         -89, -127,   61,   28,  -94,  -83,  -11,    8,   58,  -31, -118,   88,  -79, -110,  -83,   19,
+          43,   57,   88,  120,  109,   54,  108,  -10, -128,  -87,  -80,   52,  -58,  -45,  -73, -109,
+          47,  -94,  -95,   13,  -46,  -15,  -52,  -35,   11,  -42,   77,  -58,  -59,  -67,  -80,  -16,
+         103,  -95,   38,  -38,   29,  -58,   34, -124,  -11,  -35,  110,  -33,   90,  -44,  124,  -19,
+          96,  -25,   55,   50,  -91,   97,  -73,   20,   90,  -87,    9,  117,   19,   77,  -79, -107,
+         -54,   -2,   37, -116,  -75,  -87,   21,   85,   67,  -87,   95,  -90,   51,   84,  114,  -60,
+         -17,   50,   -3,   13,   97,  -11,  126,   53,   42,   10,  -18,   99,    3,    6,  -78,    3,
+          37,   30,   28,  -33,   77,   63,   52,  -34, -116,  -50,   34,  -27, -125,  -56,  125,  -14,
+          19,  101,  -56,    8,   89, -116,  110,  110, -111,  -49,  -15,  -83,   21,   63,  -51,  -53,
+          83,   22,   81,  112,   37,   25,   92,  -55,   92,  -39,    6,   43,   14, -103,   -6,  101,
+          66,   29,  -26,  -17,  114,  -62,  -78,   73,  -18,  126,   90,   29,   63, -112,   85,    5,
+         -72,   -5,   41,   84, -124,   21,   12,   92,    8,  -13,  -37, -121,    2,  -75,  -79,  112,
+         -90,  -89,    4,   99,  112, -124,   68,  -44,   -8,  -72,   44,  -37,   90,  -97,  -74,  -15,
+          -8,   14,   39,  -99, -126,  116, -107,  121,  -21,  -31,   65,  -79,   96,  -26,   87,  -15
+    }
+};
+
+#endif // SHIP_CONV_ROM_H
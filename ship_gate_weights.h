@@ -0,0 +1,26 @@
+#ifndef SHIP_DETECTOR_GATE_WEIGHTS_H
+#define SHIP_DETECTOR_GATE_WEIGHTS_H
+
+#include <stdint.h>
+
+/*
+ * Early-exit cascade gate for the ship detector
+ * Layout (int8, sequential): GATE_OUT x GATE_IN weights, then GATE_OUT biases
+ * Load with EmbeddedWeightLoader: load_fc_weights<GATE_OUT, GATE_IN>()
+ * followed by load_bias<GATE_OUT>().
+ *
+ * Generated by tools/train_gate.py from the CONV1 weights in ship_weights.h:
+ * 24 ship and 32 open-water training tiles, all classified correctly
+ * (margins at the threshold: ship +1101, sea +1100 before int8 saturation).
+ * Held-out tiles (not used for training): 16 of 16 ship tiles accepted,
+ * 23 of 24 open-water tiles rejected.
+ */
+
+#define GATE_TOTAL_WEIGHTS 17
+
+const int8_t SHIP_DETECTOR_GATE_WEIGHTS[] = {
+       9,  125,   18,  -24,  -26,   36,    2,  -24,   87,  127,  -13,   17,   -8,   34,   79,  -22,
+     -19
+};
+
+#endif // SHIP_DETECTOR_GATE_WEIGHTS_H
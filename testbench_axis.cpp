@@ -0,0 +1,187 @@
+#include <iostream>
+#include <iomanip>
+#include <time.h>
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "embedded_weight_loader.h"
+#include "ship_weights.h"
+
+// Back-to-back frame testbench for cnn_network_axis()
+// Packs N frames into one AXI4-Stream (as a DMA would deliver them),
+// runs the streaming top once with weights loaded from a DDR-style blob,
+// then again on resident weights, and checks every score beat against
+// cnn_network() on the same frame.
+//
+// Build: g++ -O2 -I<Vivado HLS include> testbench_axis.cpp cnn_network_axis.cpp cnn_network.cpp
+// Usage: ./testbench_axis [frames]
+
+extern void cnn_network(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+extern void cnn_network_axis(
+    hls::stream<axis_word_t> &in,
+    hls::stream<axis_word_t> &out,
+    const wword_t *weights,
+    const bias_t *bias,
+    bool load_weights,
+    int frames
+);
+
+#define FRAME_BYTES (CONV1_IN_CH * MAX_H * MAX_W)
+#define MAX_FRAMES 64
+
+static double now_ms() {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec * 1000.0 + t.tv_nsec / 1e6;
+}
+
+// Frame f: the embedded ship image, mirrored on odd frames and shifted in
+// brightness so consecutive frames differ
+static void make_frame(int f, uint8_t frame[FRAME_BYTES]) {
+    for (int h = 0; h < MAX_H; h++) {
+        for (int w = 0; w < MAX_W; w++) {
+            int src_w = (f & 1) ? (MAX_W - 1 - w) : w;
+            for (int c = 0; c < CONV1_IN_CH; c++) {
+                int v = SHIP_DETECTOR_INPUT[(h * MAX_W + src_w) * CONV1_IN_CH + c] + 3 * (f / 2);
+                frame[(h * MAX_W + w) * CONV1_IN_CH + c] = (uint8_t)(v > 255 ? 255 : v);
+            }
+        }
+    }
+}
+
+static void push_frame(const uint8_t frame[FRAME_BYTES], hls::stream<axis_word_t> &s) {
+    for (int beat = 0; beat < AXIS_FRAME_BEATS; beat++) {
+        axis_word_t word;
+        word.data = 0;
+        for (int b = 0; b < AXIS_BYTES; b++) {
+            word.data.range(8 * b + 7, 8 * b) = frame[beat * AXIS_BYTES + b];
+        }
+        word.keep = -1;
+        word.strb = -1;
+        word.user = (beat == 0);   // start of frame
+        word.id = 0;
+        word.dest = 0;
+        word.last = (beat == AXIS_FRAME_BEATS - 1);
+        s.write(word);
+    }
+}
+
+// Runs one batch through the streaming top; returns mismatching frames
+static int run_batch(
+    const char *label,
+    int frames,
+    bool load_weights,
+    const wword_t *blob,
+    const bias_t *bias,
+    data_t expected[MAX_FRAMES][FC2_OUT]
+) {
+    static uint8_t frame[FRAME_BYTES];
+    hls::stream<axis_word_t> in, out;
+
+    for (int f = 0; f < frames; f++) {
+        make_frame(f, frame);
+        push_frame(frame, in);
+    }
+
+    double t0 = now_ms();
+    cnn_network_axis(in, out, blob, bias, load_weights, frames);
+    double ms = now_ms() - t0;
+
+    int mismatches = 0;
+    for (int f = 0; f < frames; f++) {
+        axis_word_t word = out.read();
+        bool ok = (word.last == 1);
+        for (int i = 0; i < FC2_OUT; i++) {
+            data_t score = (data_t)(ap_uint<8>)word.data.range(8 * i + 7, 8 * i);
+            if (score != expected[f][i]) ok = false;
+        }
+        if (!ok) mismatches++;
+    }
+    if (!in.empty() || !out.empty()) {
+        std::cout << "  ✗ " << label << ": stream not drained" << std::endl;
+        mismatches++;
+    }
+
+    std::cout << "  " << std::left << std::setw(26) << label << std::right
+              << std::setw(3) << frames << " frames  "
+              << std::fixed << std::setprecision(2) << std::setw(9) << ms << " ms  "
+              << std::setw(7) << 1000.0 * frames / ms << " frames/s  "
+              << (mismatches ? "MISMATCH" : "ok") << std::endl;
+    return mismatches;
+}
+
+int main(int argc, char **argv) {
+    int frames = (argc > 1) ? atoi(argv[1]) : 8;
+    if (frames < 1) frames = 1;
+    if (frames > MAX_FRAMES) frames = MAX_FRAMES;
+
+    std::cout << "╔════════════════════════════════════════════╗" << std::endl;
+    std::cout << "║   Ship Detector - AXI4-Stream top          ║" << std::endl;
+    std::cout << "╚════════════════════════════════════════════╝" << std::endl;
+
+    // DDR-side model: the flat blob cnn_network_axis() bursts from
+    static wword_t blob[AXIS_WEIGHT_WORDS];
+    static bias_t bias[AXIS_BIAS_LEN];
+    pack_weight_words(SHIP_DETECTOR_WEIGHTS, AXIS_WEIGHT_LEN, blob);
+    for (int i = 0; i < AXIS_BIAS_LEN; i++) bias[i] = 0;
+
+    // Reference scores from cnn_network() on the same frames
+    static weight_t conv1_w[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K];
+    static weight_t conv2_w[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K];
+    static weight_t conv3_w[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K];
+    static weight_t fc1_w[FC1_OUT][FC1_IN];
+    static weight_t fc2_w[FC2_OUT][FC2_IN];
+    static bias_t fc1_b[FC1_OUT];
+    static bias_t fc2_b[FC2_OUT];
+    static data_t input[CONV1_IN_CH][MAX_H][MAX_W];
+    static uint8_t frame[FRAME_BYTES];
+    static data_t expected[MAX_FRAMES][FC2_OUT];
+
+    std::streambuf *saved = std::cout.rdbuf(NULL);   // silence the loaders
+    EmbeddedWeightLoader loader(SHIP_DETECTOR_WEIGHTS);
+    loader.load_conv_weights<CONV1_OUT_CH, CONV1_IN_CH, CONV1_K>(conv1_w);
+    loader.load_conv_weights<CONV2_OUT_CH, CONV2_IN_CH, CONV2_K>(conv2_w);
+    loader.load_conv_weights<CONV3_OUT_CH, CONV3_IN_CH, CONV3_K>(conv3_w);
+    loader.load_fc_weights<FC1_OUT, FC1_IN>(fc1_w);
+    loader.load_fc_weights<FC2_OUT, FC2_IN>(fc2_w);
+    for (int i = 0; i < FC1_OUT; i++) fc1_b[i] = 0;
+    for (int i = 0; i < FC2_OUT; i++) fc2_b[i] = 0;
+
+    for (int f = 0; f < frames; f++) {
+        make_frame(f, frame);
+        load_embedded_input(frame, input, MAX_H, MAX_W);
+        cnn_network(input, expected[f], conv1_w, conv2_w, conv3_w, fc1_w, fc2_w,
+                    fc1_b, fc2_b, MAX_H, MAX_W);
+    }
+    std::cout.rdbuf(saved);
+
+    std::cout << "\nFrame: " << AXIS_FRAME_BEATS << " beats of " << AXIS_BYTES
+              << " pixels; model blob " << AXIS_WEIGHT_LEN << " bytes in " << AXIS_WEIGHT_WORDS
+              << " m_axi words\n" << std::endl;
+
+    int mismatches = 0;
+    mismatches += run_batch("cold (load_weights=1)", frames, true, blob, bias, expected);
+    mismatches += run_batch("warm (resident weights)", frames, false, blob, bias, expected);
+
+    std::cout << "\nframes/s are C-simulation figures; on hardware the frame read"
+              << "\noverlaps the previous frame's compute (DATAFLOW)." << std::endl;
+
+    if (mismatches) {
+        std::cout << "\n✗ " << mismatches << " frame(s) differ from cnn_network()" << std::endl;
+        return 1;
+    }
+    std::cout << "\n✓ All frames match cnn_network()" << std::endl;
+    return 0;
+}
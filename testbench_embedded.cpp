@@ -3,6 +3,7 @@
 #include "cnn_utils.h"
 #include "embedded_weight_loader.h"
 #include "ship_weights.h"  // Generated header with embedded weights
+#include "cnn_profile.h"   // Per-layer timing (build with -DCNN_PROFILE)
 
 // External CNN function
 extern void cnn_network(
@@ -13,8 +14,8 @@ extern void cnn_network(
     weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
     weight_t fc1_weights[FC1_OUT][FC1_IN],
     weight_t fc2_weights[FC2_OUT][FC2_IN],
-    acc_t fc1_bias[FC1_OUT],
-    acc_t fc2_bias[FC2_OUT],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
     int H,
     int W
 );
@@ -38,8 +39,8 @@ int main() {
     static weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K];
     static weight_t fc1_weights[FC1_OUT][FC1_IN];
     static weight_t fc2_weights[FC2_OUT][FC2_IN];
-    static acc_t fc1_bias[FC1_OUT];
-    static acc_t fc2_bias[FC2_OUT];
+    static bias_t fc1_bias[FC1_OUT];
+    static bias_t fc2_bias[FC2_OUT];
     
     // ========================================
     // STEP 1: Load Weights from Embedded Array
@@ -114,6 +115,33 @@ int main() {
     std::cout << "\nPredicted class: " << max_idx 
               << " (value=" << (int)max_val << ")" << std::endl;
     
+#ifdef CNN_PROFILE
+    // ========================================
+    // Per-layer profile (warm cache, averaged)
+    // ========================================
+    const int profile_runs = 10;
+    std::cout << "\nProfiling " << profile_runs << " inferences per layer..." << std::endl;
+    cnn_profile_reset();
+    for (int run = 0; run < profile_runs; run++) {
+        cnn_network(
+            input, output,
+            conv1_weights, conv2_weights, conv3_weights,
+            fc1_weights, fc2_weights,
+            fc1_bias, fc2_bias,
+            128, 128
+        );
+    }
+    std::cout << std::endl;
+    cnn_profile_print_table(stdout);
+
+    FILE* json = fopen("cnn_profile.json", "w");
+    if (json) {
+        cnn_profile_write_json(json);
+        fclose(json);
+        std::cout << "\nProfile written to cnn_profile.json" << std::endl;
+    }
+#endif
+
     std::cout << "\n✓ Test complete! No files needed - everything embedded!" << std::endl;
     
     return 0;
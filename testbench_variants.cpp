@@ -0,0 +1,1214 @@
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include "cnn_types.h"
+#include "cnn_utils.h"
+#include "embedded_weight_loader.h"
+#include "ship_weights.h"  // Generated header with embedded weights
+#include "ship_gate_weights.h"
+#include "cnn_cache.h"
+#include "cnn_conv.h"
+#include "cnn_fc.h"
+#include "ship_conv_rom.h"
+#include "cnn_ddr_model.h"
+#include "cnn_systolic.h"
+
+// Cross-checks alternative execution paths against the reference
+// cnn_network() on the embedded ship image. Every check must be bit-exact.
+
+// External CNN functions
+extern void cnn_network(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+extern void cnn_scene_scan(
+    data_t input[CONV1_IN_CH][SCENE_MAX_H][SCENE_MAX_W],
+    data_t scores[SCENE_MAX_WIN_H][SCENE_MAX_WIN_W][FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+extern void cnn_scene_stream_band(
+    data_t band[CONV1_IN_CH][STREAM_BAND_H][STREAM_MAX_W],
+    data_t scores[STREAM_MAX_WIN_W][FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int band_rows,
+    int W,
+    bool first_band,
+    int *win_row
+);
+
+extern bool cnn_scene_stream_scan(
+    const data_t *scene,
+    data_t *scores,
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+extern void cnn_network_delta(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W,
+    bool reset,
+    int dirty_box[4]
+);
+
+// Working memory shared by all checks
+static data_t input[CONV1_IN_CH][MAX_H][MAX_W];
+static data_t reference[FC2_OUT];
+
+static weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K];
+static weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K];
+static weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K];
+static weight_t fc1_weights[FC1_OUT][FC1_IN];
+static weight_t fc2_weights[FC2_OUT][FC2_IN];
+static bias_t fc1_bias[FC1_OUT];
+static bias_t fc2_bias[FC2_OUT];
+static weight_t gate_weights[GATE_OUT][GATE_IN];
+static bias_t gate_bias[GATE_OUT];
+extern void cnn_network_cascade(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    weight_t gate_weights[GATE_OUT][GATE_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    bias_t gate_bias[GATE_OUT],
+    int gate_threshold,
+    bool *rejected,
+    int H,
+    int W
+);
+extern void cnn_network_int4(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    wpack_t conv1_weights[CONV1_OUT_CH][WPACK_LEN(CONV1_IN_CH * CONV1_K * CONV1_K)],
+    wpack_t conv2_weights[CONV2_OUT_CH][WPACK_LEN(CONV2_IN_CH * CONV2_K * CONV2_K)],
+    wpack_t conv3_weights[CONV3_OUT_CH][WPACK_LEN(CONV3_IN_CH * CONV3_K * CONV3_K)],
+    wpack_t fc1_weights[FC1_OUT][WPACK_LEN(FC1_IN)],
+    wpack_t fc2_weights[FC2_OUT][WPACK_LEN(FC2_IN)],
+    wscale4_t w4_scales[INT4_LAYERS],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+extern void cnn_network_ddr(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    const wword_t *fc1_weights,
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+extern void cnn_network_rom(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+
+extern void cnn_network_systolic(
+    data_t input[CONV1_IN_CH][MAX_H][MAX_W],
+    data_t output[FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int H,
+    int W
+);
+extern void cnn_network_pipeline(
+    data_t frames[PIPE_MAX_FRAMES][CONV1_IN_CH][MAX_H][MAX_W],
+    data_t scores[PIPE_MAX_FRAMES][FC2_OUT],
+    weight_t conv1_weights[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K],
+    weight_t conv2_weights[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K],
+    weight_t conv3_weights[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K],
+    weight_t fc1_weights[FC1_OUT][FC1_IN],
+    weight_t fc2_weights[FC2_OUT][FC2_IN],
+    bias_t fc1_bias[FC1_OUT],
+    bias_t fc2_bias[FC2_OUT],
+    int num_frames,
+    int H,
+    int W
+);
+
+// Mirror an index into [0, size) so scenes can be built from the 128x128 tile
+static int reflect(int i, int size) {
+    int period = 2 * size;
+    i %= period;
+    return (i < size) ? i : (period - 1 - i);
+}
+
+static void run_reference(data_t tile[CONV1_IN_CH][MAX_H][MAX_W], data_t out[FC2_OUT]) {
+    cnn_network(
+        tile, out,
+        conv1_weights, conv2_weights, conv3_weights,
+        fc1_weights, fc2_weights,
+        fc1_bias, fc2_bias,
+        MAX_H, MAX_W
+    );
+}
+
+static bool same_scores(const data_t a[FC2_OUT], const data_t b[FC2_OUT]) {
+    for (int i = 0; i < FC2_OUT; i++) {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+// Test scene mirrored out of the embedded tile, and its scan results
+static const int SCENE_H = MAX_H + 4 * SCENE_STRIDE;   // 5 window rows
+static const int SCENE_W = MAX_W + 3 * SCENE_STRIDE;   // 4 window columns
+static data_t scene[CONV1_IN_CH][SCENE_MAX_H][SCENE_MAX_W];
+static data_t scene_scores[SCENE_MAX_WIN_H][SCENE_MAX_WIN_W][FC2_OUT];
+
+// ========================================
+// Scene scan vs. per-tile cnn_network()
+// ========================================
+static bool check_scene_scan() {
+    const int H = SCENE_H;
+    const int W = SCENE_W;
+
+    static data_t tile[CONV1_IN_CH][MAX_H][MAX_W];
+    data_t expected[FC2_OUT];
+
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+                scene[c][y][x] = input[c][reflect(y, MAX_H)][reflect(x, MAX_W)];
+
+    cnn_scene_scan(
+        scene, scene_scores,
+        conv1_weights, conv2_weights, conv3_weights,
+        fc1_weights, fc2_weights,
+        fc1_bias, fc2_bias,
+        H, W
+    );
+
+    int mismatches = 0;
+    int windows = 0;
+    for (int wy = 0; wy < scene_window_count(H); wy++) {
+        for (int wx = 0; wx < scene_window_count(W); wx++) {
+            for (int c = 0; c < CONV1_IN_CH; c++)
+                for (int y = 0; y < MAX_H; y++)
+                    for (int x = 0; x < MAX_W; x++)
+                        tile[c][y][x] = scene[c][wy * SCENE_STRIDE + y][wx * SCENE_STRIDE + x];
+
+            run_reference(tile, expected);
+            if (!same_scores(expected, scene_scores[wy][wx])) mismatches++;
+            windows++;
+        }
+    }
+
+    // A scene larger than the on-chip maps must be rejected untouched
+    data_t kept = scene_scores[0][0][0];
+    scene_scores[0][0][0] = 42;
+    cnn_scene_scan(
+        scene, scene_scores,
+        conv1_weights, conv2_weights, conv3_weights,
+        fc1_weights, fc2_weights,
+        fc1_bias, fc2_bias,
+        SCENE_MAX_H + SCENE_STRIDE, W
+    );
+    bool oversize_ok = (scene_scores[0][0][0] == 42);
+    scene_scores[0][0][0] = kept;   // check_scene_stream() compares against these
+
+    std::cout << "  scene scan: " << windows << " windows, "
+              << mismatches << " mismatches, oversize scene "
+              << (oversize_ok ? "rejected" : "NOT rejected") << std::endl;
+    return mismatches == 0 && oversize_ok;
+}
+
+// ========================================
+// Row-band streaming vs. scene scan
+// ========================================
+static bool check_scene_stream() {
+    static data_t band[CONV1_IN_CH][STREAM_BAND_H][STREAM_MAX_W];
+    static data_t scores[STREAM_MAX_WIN_W][FC2_OUT];
+
+    int mismatches = 0;
+    int rows_emitted = 0;
+    for (int y0 = 0; y0 < SCENE_H; y0 += STREAM_BAND_H) {
+        int rows = (SCENE_H - y0 < STREAM_BAND_H) ? (SCENE_H - y0) : STREAM_BAND_H;
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int r = 0; r < rows; r++)
+                for (int x = 0; x < SCENE_W; x++)
+                    band[c][r][x] = scene[c][y0 + r][x];
+
+        int win_row;
+        cnn_scene_stream_band(
+            band, scores,
+            conv1_weights, conv2_weights, conv3_weights,
+            fc1_weights, fc2_weights,
+            fc1_bias, fc2_bias,
+            rows, SCENE_W, y0 == 0, &win_row
+        );
+        if (win_row < 0) continue;
+
+        for (int wx = 0; wx < scene_window_count(SCENE_W); wx++) {
+            if (!same_scores(scene_scores[win_row][wx], scores[wx])) mismatches++;
+        }
+        rows_emitted++;
+    }
+
+    if (rows_emitted != scene_window_count(SCENE_H)) mismatches++;
+
+    // Too wide a scene or too tall a band is refused without reading the band
+    int too_wide, too_tall;
+    cnn_scene_stream_band(band, scores, conv1_weights, conv2_weights, conv3_weights,
+                          fc1_weights, fc2_weights, fc1_bias, fc2_bias,
+                          STREAM_BAND_H, STREAM_MAX_W + SCENE_STRIDE, true, &too_wide);
+    cnn_scene_stream_band(band, scores, conv1_weights, conv2_weights, conv3_weights,
+                          fc1_weights, fc2_weights, fc1_bias, fc2_bias,
+                          STREAM_BAND_H + 1, SCENE_W, true, &too_tall);
+    bool refused = (too_wide == STREAM_BAD_GEOMETRY && too_tall == STREAM_BAD_GEOMETRY);
+
+    std::cout << "  scene stream: " << rows_emitted << " window rows, "
+              << mismatches << " mismatches, bad geometry "
+              << (refused ? "refused" : "NOT refused") << std::endl;
+    return mismatches == 0 && refused;
+}
+
+// ========================================
+// Strip-split streaming of a scene wider than STREAM_MAX_W
+// ========================================
+static bool check_scene_stream_strips() {
+    const int H = MAX_H;                                // 1 window row
+    const int W = STREAM_MAX_W + 4 * SCENE_STRIDE;      // 2 strips
+    const int win_w = scene_window_count(W);
+    static data_t wide[CONV1_IN_CH][H][W];
+    static data_t scores[(W - MAX_W) / SCENE_STRIDE + 1][FC2_OUT];
+    static data_t tile[CONV1_IN_CH][MAX_H][MAX_W];
+    data_t expected[FC2_OUT];
+
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int y = 0; y < H; y++)
+            for (int x = 0; x < W; x++)
+                wide[c][y][x] = input[c][reflect(y, MAX_H)][reflect(x, MAX_W)];
+
+    bool ok = cnn_scene_stream_scan(
+        &wide[0][0][0], &scores[0][0],
+        conv1_weights, conv2_weights, conv3_weights,
+        fc1_weights, fc2_weights,
+        fc1_bias, fc2_bias,
+        H, W
+    );
+
+    // First window, both sides of the strip seam, and the last window
+    const int seam = STREAM_STRIP_STEP / SCENE_STRIDE;
+    const int cols[] = { 0, seam - 1, seam, win_w - 1 };
+    int mismatches = 0;
+    for (int i = 0; i < 4; i++) {
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int y = 0; y < MAX_H; y++)
+                for (int x = 0; x < MAX_W; x++)
+                    tile[c][y][x] = wide[c][y][cols[i] * SCENE_STRIDE + x];
+        run_reference(tile, expected);
+        if (!same_scores(expected, scores[cols[i]])) mismatches++;
+    }
+
+    std::cout << "  scene stream strips: " << W << " px wide, " << win_w
+              << " windows, seam at column " << seam << ", "
+              << mismatches << " mismatches" << std::endl;
+    return ok && mismatches == 0;
+}
+
+// ========================================
+// Early-exit cascade: held-out ships accepted, sea tiles rejected,
+// accepted tiles exact
+// ========================================
+// Open water the gate was not trained on, as in Benchmark_int8:
+// grey-green base, stronger noise, swell along the rows, sun glint
+static void make_swell_tile(data_t t[CONV1_IN_CH][MAX_H][MAX_W]) {
+    int base[CONV1_IN_CH] = { 45 + rand() % 46, 70 + rand() % 41, 40 + rand() % 81 };
+    int amp = 12 + rand() % 17, swell = 6 + rand() % 15, period = 6 + rand() % 19;
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int h = 0; h < MAX_H; h++) {
+            int wave = (int)(swell * sin(2 * M_PI * h / period));
+            for (int w = 0; w < MAX_W; w++) {
+                int v = base[c] + wave + rand() % (2 * amp + 1) - amp;
+                if (rand() % 100 == 0) v = 255;
+                t[c][h][w] = (data_t)((v < 0 ? 0 : v > 255 ? 255 : v) - 128);
+            }
+        }
+}
+
+// Held-out ship tiles: a shifted crop (mirrored borders) for odd n, the
+// ship at half size on swell for even n
+static void make_heldout_ship(data_t t[CONV1_IN_CH][MAX_H][MAX_W], int n) {
+    if (n % 2) {
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int h = 0; h < MAX_H; h++)
+                for (int w = 0; w < MAX_W; w++) {
+                    int y = (h + 37 * n) % (2 * MAX_H), x = (w + 53 * n) % (2 * MAX_W);
+                    if (y >= MAX_H) y = 2 * MAX_H - 1 - y;
+                    if (x >= MAX_W) x = 2 * MAX_W - 1 - x;
+                    t[c][h][w] = input[c][y][x];
+                }
+        return;
+    }
+    make_swell_tile(t);
+    int oy = rand() % (MAX_H / 2 + 1), ox = rand() % (MAX_W / 2 + 1);
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int h = 0; h < MAX_H / 2; h++)
+            for (int w = 0; w < MAX_W / 2; w++)
+                t[c][oy + h][ox + w] = input[c][2 * h][2 * w];
+}
+
+static bool cascade(data_t tile[CONV1_IN_CH][MAX_H][MAX_W], data_t out[FC2_OUT], int threshold) {
+    bool rejected = false;
+    cnn_network_cascade(tile, out, conv1_weights, conv2_weights, conv3_weights,
+                        fc1_weights, fc2_weights, gate_weights,
+                        fc1_bias, fc2_bias, gate_bias, threshold, &rejected, MAX_H, MAX_W);
+    return rejected;
+}
+
+static bool check_cascade() {
+    static data_t sea[CONV1_IN_CH][MAX_H][MAX_W];
+    const int sea_tiles = 8, heldout_ships = 4;
+    data_t out[FC2_OUT];
+    data_t expected[FC2_OUT];
+    int mismatches = 0;
+
+    // The ship tile passes the shipped gate with scores identical to cnn_network()
+    bool ship_rejected = cascade(input, out, GATE_THRESHOLD_DEFAULT);
+    if (!ship_rejected && !same_scores(reference, out)) mismatches++;
+
+    // Ship recall on tiles the gate was not trained on
+    int ships_accepted = 0;
+    for (int n = 0; n < heldout_ships; n++) {
+        make_heldout_ship(sea, n);
+        if (!cascade(sea, out, GATE_THRESHOLD_DEFAULT)) ships_accepted++;
+    }
+
+    int rejected = 0;
+    for (int n = 0; n < sea_tiles; n++) {
+        make_swell_tile(sea);
+        if (cascade(sea, out, GATE_THRESHOLD_DEFAULT)) {
+            rejected++;
+            // A threshold of -128 never rejects: full network, exact scores
+            if (n == 0) {
+                run_reference(sea, expected);
+                if (cascade(sea, out, -128) || !same_scores(expected, out)) mismatches++;
+            }
+        }
+    }
+
+    std::cout << "  cascade: ship " << (ship_rejected ? "REJECTED" : "accepted") << ", "
+              << ships_accepted << "/" << heldout_ships << " held-out ships accepted, "
+              << rejected << "/" << sea_tiles << " held-out sea tiles rejected (skip rate "
+              << 100 * rejected / sea_tiles << "%), " << mismatches << " mismatches" << std::endl;
+    return !ship_rejected && ships_accepted == heldout_ships && rejected > 0 && mismatches == 0;
+}
+
+// ========================================
+// Result cache: misses run the network, hits replay it
+// ========================================
+static bool check_result_cache() {
+    static data_t other[CONV1_IN_CH][MAX_H][MAX_W];
+    data_t out[FC2_OUT];
+    int mismatches = 0;
+
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int y = 0; y < MAX_H; y++)
+            for (int x = 0; x < MAX_W; x++)
+                other[c][y][x] = input[c][MAX_H - 1 - y][x];
+
+    InferenceCache cache(1, InferenceCache::version_of(SHIP_DETECTOR_WEIGHTS, TOTAL_WEIGHTS));
+
+    bool hit1 = cnn_network_cached(cache, input, out, conv1_weights, conv2_weights, conv3_weights,
+                                   fc1_weights, fc2_weights, fc1_bias, fc2_bias, MAX_H, MAX_W);
+    if (hit1 || !same_scores(out, reference)) mismatches++;
+
+    bool hit2 = cnn_network_cached(cache, input, out, conv1_weights, conv2_weights, conv3_weights,
+                                   fc1_weights, fc2_weights, fc1_bias, fc2_bias, MAX_H, MAX_W);
+    if (!hit2 || !same_scores(out, reference)) mismatches++;
+
+    // A different tile must miss and evict the only entry
+    bool hit3 = cnn_network_cached(cache, other, out, conv1_weights, conv2_weights, conv3_weights,
+                                   fc1_weights, fc2_weights, fc1_bias, fc2_bias, MAX_H, MAX_W);
+    if (hit3 || cache.evictions() != 1) mismatches++;
+
+    std::cout << "  result cache: " << cache.hits() << " hits, " << cache.misses()
+              << " misses, " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+// ========================================
+// Temporal delta inference over a frame sequence
+// ========================================
+static bool check_temporal_delta() {
+    static data_t frame[CONV1_IN_CH][MAX_H][MAX_W];
+    data_t expected[FC2_OUT];
+    data_t out[FC2_OUT];
+    int dirty_box[4];
+    int mismatches = 0;
+
+    // Frames: original, patch in the middle, unchanged, patch at the
+    // bottom-right edge, then a completely different frame.
+    const int frames = 5;
+    for (int f = 0; f < frames; f++) {
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int y = 0; y < MAX_H; y++)
+                for (int x = 0; x < MAX_W; x++) {
+                    data_t v = input[c][y][x];
+                    if (f == 1 || f == 2) {
+                        if (y >= 50 && y < 61 && x >= 70 && x < 79) v = (data_t)(127 - c * 40);
+                    } else if (f == 3) {
+                        if (y >= 120 && x >= 118) v = (data_t)(-100 + c * 30);
+                    } else if (f == 4) {
+                        v = input[c][y][MAX_W - 1 - x];
+                    }
+                    frame[c][y][x] = v;
+                }
+
+        cnn_network_delta(
+            frame, out,
+            conv1_weights, conv2_weights, conv3_weights,
+            fc1_weights, fc2_weights,
+            fc1_bias, fc2_bias,
+            MAX_H, MAX_W, f == 0, dirty_box
+        );
+        run_reference(frame, expected);
+        if (!same_scores(expected, out)) mismatches++;
+
+        // The unchanged frame must not recompute anything
+        if (f == 2 && dirty_box[2] != dirty_box[0]) mismatches++;
+    }
+
+    std::cout << "  temporal delta: " << frames << " frames, "
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+// FC1 input taken from the embedded image (any int8 vector will do)
+static void make_fc1_input(data_t x[FC1_IN]) {
+    for (int i = 0; i < FC1_IN; i++) {
+        x[i] = input[i % CONV1_IN_CH][(i / 7) % MAX_H][(i * 13) % MAX_W];
+    }
+}
+
+// ========================================
+// Block-sparse FC1 vs. dense fc_layer on a pruned matrix
+// ========================================
+static bool check_sparse_fc() {
+    typedef fc_block_sparse<FC1_OUT, FC1_IN, FC1_SPARSE_BLOCK, FC1_SPARSE_MAX_BLOCKS> fc1_sparse_t;
+    const int blocks_per_row = FC1_IN / FC1_SPARSE_BLOCK;
+
+    static int8_t pruned_blob[FC1_OUT * FC1_IN];
+    static int8_t packed_blob[FC1_OUT * (1 + blocks_per_row + FC1_IN)];
+    static weight_t pruned[FC1_OUT][FC1_IN];
+    static fc1_sparse_t sparse;
+    static fc1_sparse_t unpacked;
+    data_t x[FC1_IN];
+    data_t out_dense[FC1_OUT];
+    data_t out_sparse[FC1_OUT];
+    data_t out_packed[FC1_OUT];
+
+    // The unpruned matrix does not fit the FC1_SPARSE_MAX_BLOCKS budget
+    for (int o = 0; o < FC1_OUT; o++)
+        for (int i = 0; i < FC1_IN; i++)
+            pruned_blob[o * FC1_IN + i] = (int8_t)(int)fc1_weights[o][i];
+    std::streambuf *saved = std::cout.rdbuf(NULL);   // expected refusal, keep the log clean
+    EmbeddedWeightLoader over_loader(pruned_blob);
+    bool refused = !over_loader.load_fc_weights_sparse(sparse);
+    std::cout.rdbuf(saved);
+
+    // Keep one block in ten (a 90%-pruned FC1)
+    for (int o = 0; o < FC1_OUT; o++)
+        for (int i = 0; i < FC1_IN; i++) {
+            bool keep = ((o + i / FC1_SPARSE_BLOCK) % 10) == 0;
+            pruned_blob[o * FC1_IN + i] = keep ? (int8_t)(int)fc1_weights[o][i] : 0;
+            pruned[o][i] = pruned_blob[o * FC1_IN + i];
+        }
+
+    EmbeddedWeightLoader dense_loader(pruned_blob);
+    if (!dense_loader.load_fc_weights_sparse(sparse)) return false;
+
+    size_t packed_bytes = pack_fc_block_sparse(sparse, packed_blob);
+    EmbeddedWeightLoader packed_loader(packed_blob);
+    if (!packed_loader.load_fc_weights_packed(unpacked)) return false;
+
+
+    make_fc1_input(x);
+    fc_layer<FC1_IN, FC1_OUT>(x, out_dense, pruned, fc1_bias, true);
+    fc_layer_sparse(x, out_sparse, sparse, fc1_bias, true);
+    fc_layer_sparse(x, out_packed, unpacked, fc1_bias, true);
+
+    int mismatches = 0;
+    for (int o = 0; o < FC1_OUT; o++) {
+        if (out_dense[o] != out_sparse[o]) mismatches++;
+        if (out_dense[o] != out_packed[o]) mismatches++;
+    }
+
+    // A block index past FC1_IN / FC1_SPARSE_BLOCK (row 0's first block)
+    packed_blob[1] = (int8_t)blocks_per_row;
+    saved = std::cout.rdbuf(NULL);
+    EmbeddedWeightLoader bad_loader(packed_blob);
+    bool bad_refused = !bad_loader.load_fc_weights_packed(unpacked);
+    std::cout.rdbuf(saved);
+
+    std::cout << "  sparse FC1: " << sparse.nnz_blocks << " blocks, "
+              << packed_bytes << " packed bytes, " << mismatches << " mismatches, unpruned "
+              << (refused ? "refused" : "ACCEPTED") << ", bad block index "
+              << (bad_refused ? "refused" : "ACCEPTED") << std::endl;
+    return mismatches == 0 && refused && bad_refused;
+}
+
+// ========================================
+// Zero-activation skipping vs. dense fc_layer
+// ========================================
+static bool check_zero_skip_fc() {
+    data_t x[FC1_IN];
+    data_t out_dense[FC1_OUT];
+    data_t out_skip[FC1_OUT];
+    data_t out2_dense[FC2_OUT];
+    data_t out2_skip[FC2_OUT];
+
+    // Post-ReLU style input: negatives become zero
+    make_fc1_input(x);
+    int zeros = 0;
+    for (int i = 0; i < FC1_IN; i++) {
+        if (x[i] < 0) x[i] = 0;
+        if (x[i] == 0) zeros++;
+    }
+
+    fc_layer<FC1_IN, FC1_OUT>(x, out_dense, fc1_weights, fc1_bias, true);
+    fc_layer_skip_zero<FC1_IN, FC1_OUT>(x, out_skip, fc1_weights, fc1_bias, true);
+    fc_layer<FC2_IN, FC2_OUT>(out_dense, out2_dense, fc2_weights, fc2_bias, false);
+    fc_layer_skip_zero<FC2_IN, FC2_OUT>(out_dense, out2_skip, fc2_weights, fc2_bias, false);
+
+    // The network's own FC precisions (act_t activations)
+    act_t xa[FC1_IN];
+    act_t outa_dense[FC1_OUT];
+    act_t outa_skip[FC1_OUT];
+    for (int i = 0; i < FC1_IN; i++) xa[i] = x[i];
+    fc_layer<FC1_IN, FC1_OUT, fc1_precision>(xa, outa_dense, fc1_weights, fc1_bias, true);
+    fc_layer_skip_zero<FC1_IN, FC1_OUT, fc1_precision>(xa, outa_skip, fc1_weights, fc1_bias, true);
+
+    int mismatches = 0;
+    for (int o = 0; o < FC1_OUT; o++) {
+        if (out_dense[o] != out_skip[o]) mismatches++;
+        if (outa_dense[o] != outa_skip[o]) mismatches++;
+    }
+    for (int o = 0; o < FC2_OUT; o++)
+        if (out2_dense[o] != out2_skip[o]) mismatches++;
+
+    std::cout << "  zero-skip FC: " << zeros << "/" << FC1_IN << " zero inputs, "
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+// ========================================
+// DDR-streamed FC1 vs. fc_layer, plus its transfer schedule
+// ========================================
+static bool check_ddr_fc() {
+    static int8_t blob[FC1_OUT * FC1_IN];
+    static wword_t words[FC1_DDR_WORDS];
+    data_t x[FC1_IN];
+    data_t out_dense[FC1_OUT];
+    data_t out_ddr[FC1_OUT];
+
+    for (int o = 0; o < FC1_OUT; o++)
+        for (int i = 0; i < FC1_IN; i++)
+            blob[o * FC1_IN + i] = (int8_t)(int)fc1_weights[o][i];
+    size_t n_words = pack_weight_words(blob, FC1_OUT * FC1_IN, words);
+
+    make_fc1_input(x);
+    fc_layer<FC1_IN, FC1_OUT>(x, out_dense, fc1_weights, fc1_bias, true);
+    fc_layer_ddr<FC1_IN, FC1_OUT, FC1_TILE_ROWS>(x, out_ddr, words, fc1_bias, true);
+
+    int mismatches = 0;
+    for (int o = 0; o < FC1_OUT; o++)
+        if (out_dense[o] != out_ddr[o]) mismatches++;
+
+    data_t out_net[FC2_OUT];
+    cnn_network_ddr(input, out_net, conv1_weights, conv2_weights, conv3_weights, words,
+                    fc2_weights, fc1_bias, fc2_bias, MAX_H, MAX_W);
+    if (!same_scores(out_net, reference)) mismatches++;
+
+    // Double buffering must hide every fetch but the first
+    DdrLink link = ddr_link_default();
+    DdrSchedule single = fc1_ddr_schedule(link, 1);
+    DdrSchedule dbl = fc1_ddr_schedule(link, 2);
+    long long bound = (long long)dbl.tiles * (dbl.fetch_cycles > dbl.compute_cycles
+        ? dbl.fetch_cycles : dbl.compute_cycles) + dbl.compute_cycles;
+    bool hidden = dbl.total_cycles <= bound;
+
+    std::cout << "  DDR FC1: " << n_words << " words, " << mismatches << " mismatches; "
+              << dbl.tiles << " tiles, single buffer " << single.total_cycles
+              << " cycles (" << (int)(single.gbps * 1000) << " MB/s), double "
+              << dbl.total_cycles << " cycles (" << (int)(dbl.gbps * 1000) << " MB/s)" << std::endl;
+    return mismatches == 0 && n_words == FC1_DDR_WORDS && hidden;
+}
+
+// ========================================
+// int4 network vs. cnn_network() on the dequantized weights
+// ========================================
+static void dequantize_int4(const int8_t* src, weight_t* dst, int count, int scale) {
+    for (int i = 0; i < count; i++) {
+        dst[i] = quantize_weight4(src[i], scale) * scale;
+    }
+}
+
+static bool check_int4_network() {
+    const int conv1_n = CONV1_IN_CH * CONV1_K * CONV1_K;
+    const int conv2_n = CONV2_IN_CH * CONV2_K * CONV2_K;
+    const int conv3_n = CONV3_IN_CH * CONV3_K * CONV3_K;
+    const int rows[5] = { CONV1_OUT_CH, CONV2_OUT_CH, CONV3_OUT_CH, FC1_OUT, FC2_OUT };
+    const int cols[5] = { conv1_n, conv2_n, conv3_n, FC1_IN, FC2_IN };
+
+    static int8_t packed_blob[FC1_OUT * FC1_IN];
+    static wpack_t c1[CONV1_OUT_CH][WPACK_LEN(conv1_n)];
+    static wpack_t c2[CONV2_OUT_CH][WPACK_LEN(conv2_n)];
+    static wpack_t c3[CONV3_OUT_CH][WPACK_LEN(conv3_n)];
+    static wpack_t f1[FC1_OUT][WPACK_LEN(FC1_IN)];
+    static wpack_t f2[FC2_OUT][WPACK_LEN(FC2_IN)];
+    static weight_t dq_c1[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K];
+    static weight_t dq_c2[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K];
+    static weight_t dq_c3[CONV3_OUT_CH][CONV3_IN_CH][CONV3_K][CONV3_K];
+    static weight_t dq_f1[FC1_OUT][FC1_IN];
+    static weight_t dq_f2[FC2_OUT][FC2_IN];
+    weight_t* dq[5] = { &dq_c1[0][0][0][0], &dq_c2[0][0][0][0], &dq_c3[0][0][0][0],
+                        &dq_f1[0][0], &dq_f2[0][0] };
+
+    // Pack the int8 model layer by layer into one int4 model file
+    size_t src = 0, packed_bytes = 0;
+    for (int l = 0; l < 5; l++) {
+        packed_bytes += pack_weights_int4(SHIP_DETECTOR_WEIGHTS + src, rows[l], cols[l],
+                                          packed_blob + packed_bytes);
+        dequantize_int4(SHIP_DETECTOR_WEIGHTS + src, dq[l], rows[l] * cols[l],
+                        choose_weight4_scale(SHIP_DETECTOR_WEIGHTS + src, (size_t)rows[l] * cols[l]));
+        src += (size_t)rows[l] * cols[l];
+    }
+
+    wscale4_t scales[INT4_LAYERS];
+    EmbeddedWeightLoader loader(packed_blob);
+    bool loaded = loader.load_weights_int4<CONV1_OUT_CH, conv1_n>(c1, scales[0])
+               && loader.load_weights_int4<CONV2_OUT_CH, conv2_n>(c2, scales[1])
+               && loader.load_weights_int4<CONV3_OUT_CH, conv3_n>(c3, scales[2])
+               && loader.load_weights_int4<FC1_OUT, FC1_IN>(f1, scales[3])
+               && loader.load_weights_int4<FC2_OUT, FC2_IN>(f2, scales[4]);
+
+    // Three shifted tiles mirrored out of the embedded image
+    int mismatches = 0;
+    const int tiles = 3;
+    static data_t tile[CONV1_IN_CH][MAX_H][MAX_W];
+    for (int t = 0; t < tiles; t++) {
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int h = 0; h < MAX_H; h++)
+                for (int w = 0; w < MAX_W; w++)
+                    tile[c][h][w] = input[c][reflect(h + 17 * t, MAX_H)][reflect(w + 5 * t, MAX_W)];
+
+        data_t out_int4[FC2_OUT], out_dq[FC2_OUT];
+        cnn_network_int4(tile, out_int4, c1, c2, c3, f1, f2, scales, fc1_bias, fc2_bias, MAX_H, MAX_W);
+        cnn_network(tile, out_dq, dq_c1, dq_c2, dq_c3, dq_f1, dq_f2, fc1_bias, fc2_bias, MAX_H, MAX_W);
+        if (!same_scores(out_int4, out_dq)) mismatches++;
+    }
+
+    std::cout << "  int4 network: " << packed_bytes << " packed bytes (vs "
+              << src << " int8), scales";
+    for (int l = 0; l < INT4_LAYERS; l++) std::cout << " " << scales[l];
+    std::cout << ", " << mismatches << "/" << tiles << " mismatches" << std::endl;
+    return loaded && mismatches == 0 && loader.get_offset() == packed_bytes;
+}
+
+// ========================================
+// Conv weight ROMs (generated header) vs the loaded model
+// ========================================
+static bool check_rom_network() {
+    int rom_diffs = 0;
+    for (int oc = 0; oc < CONV1_OUT_CH; oc++)
+        for (int ic = 0; ic < CONV1_IN_CH; ic++)
+            for (int kh = 0; kh < CONV1_K; kh++)
+                for (int kw = 0; kw < CONV1_K; kw++)
+                    if (CONV1_ROM[oc][ic][kh][kw] != conv1_weights[oc][ic][kh][kw]) rom_diffs++;
+    for (int oc = 0; oc < CONV2_OUT_CH; oc++)
+        for (int ic = 0; ic < CONV2_IN_CH; ic++)
+            for (int kh = 0; kh < CONV2_K; kh++)
+                for (int kw = 0; kw < CONV2_K; kw++)
+                    if (CONV2_ROM[oc][ic][kh][kw] != conv2_weights[oc][ic][kh][kw]) rom_diffs++;
+    for (int oc = 0; oc < CONV3_OUT_CH; oc++)
+        for (int ic = 0; ic < CONV3_IN_CH; ic++)
+            for (int kh = 0; kh < CONV3_K; kh++)
+                for (int kw = 0; kw < CONV3_K; kw++)
+                    if (CONV3_ROM[oc][ic][kh][kw] != conv3_weights[oc][ic][kh][kw]) rom_diffs++;
+
+    int mismatches = 0;
+    const int tiles = 3;
+    static data_t tile[CONV1_IN_CH][MAX_H][MAX_W];
+    for (int t = 0; t < tiles; t++) {
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int h = 0; h < MAX_H; h++)
+                for (int w = 0; w < MAX_W; w++)
+                    tile[c][h][w] = input[c][reflect(h + 11 * t, MAX_H)][reflect(w + 23 * t, MAX_W)];
+
+        data_t out_rom[FC2_OUT], out_ref[FC2_OUT];
+        cnn_network_rom(tile, out_rom, fc1_weights, fc2_weights, fc1_bias, fc2_bias, MAX_H, MAX_W);
+        run_reference(tile, out_ref);
+        if (!same_scores(out_rom, out_ref)) mismatches++;
+    }
+
+    std::cout << "  conv weight ROMs: " << rom_diffs << " weights differ from ship_weights.h, "
+              << mismatches << "/" << tiles << " mismatches" << std::endl;
+    return rom_diffs == 0 && mismatches == 0;
+}
+
+// ========================================
+// Shared systolic array vs. the per-layer loop nests
+// ========================================
+static bool check_systolic_network() {
+    static SystolicTiles tiles;
+    static data_t y_simple[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t y_systolic[CONV1_OUT_CH][MAX_H][MAX_W];
+
+    // Odd map size so the last pixel tile is partial
+    const int h = 13, w = 11;
+    int mismatches = 0;
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 2>(input, y_simple, conv1_weights, h, w);
+    conv_layer_systolic<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 2>(tiles, input, y_systolic, conv1_weights, h, w);
+    for (int oc = 0; oc < CONV1_OUT_CH; oc++)
+        for (int oh = 0; oh < conv_out_size(h, CONV1_K, 2); oh++)
+            for (int ow = 0; ow < conv_out_size(w, CONV1_K, 2); ow++)
+                if (y_simple[oc][oh][ow] != y_systolic[oc][oh][ow]) mismatches++;
+
+    const int frames = 2;
+    static data_t tile[CONV1_IN_CH][MAX_H][MAX_W];
+    systolic_stats() = SystolicStats();
+    for (int t = 0; t < frames; t++) {
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int y = 0; y < MAX_H; y++)
+                for (int x = 0; x < MAX_W; x++)
+                    tile[c][y][x] = input[c][reflect(y + 17 * t, MAX_H)][reflect(x + 5 * t, MAX_W)];
+
+        data_t out_sa[FC2_OUT], out_ref[FC2_OUT];
+        cnn_network_systolic(tile, out_sa, conv1_weights, conv2_weights, conv3_weights,
+                             fc1_weights, fc2_weights, fc1_bias, fc2_bias, MAX_H, MAX_W);
+        run_reference(tile, out_ref);
+        if (!same_scores(out_sa, out_ref)) mismatches++;
+    }
+
+    const SystolicStats& s = systolic_stats();
+    std::cout << "  systolic " << SA_ROWS << "x" << SA_COLS << ": " << mismatches << " mismatches; "
+              << s.passes / frames << " passes/frame, "
+              << (int)(s.utilization() * 100) << "% PE utilization ("
+              << (int)(100.0 * s.stall_cycles * SA_ROWS * SA_COLS / s.pe_cycles)
+              << "% of array cycles stalled on loads/write-back)" << std::endl;
+    return mismatches == 0;
+}
+
+// ========================================
+// Frame pipeline: every frame in a batch vs. cnn_network()
+// ========================================
+static bool check_pipeline_network() {
+    static data_t frames[PIPE_MAX_FRAMES][CONV1_IN_CH][MAX_H][MAX_W];
+    static data_t scores[PIPE_MAX_FRAMES][FC2_OUT];
+    const int n = 5;
+
+    for (int f = 0; f < n; f++)
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int y = 0; y < MAX_H; y++)
+                for (int x = 0; x < MAX_W; x++)
+                    frames[f][c][y][x] = input[c][reflect(y + 9 * f, MAX_H)][reflect(x + 31 * f, MAX_W)];
+
+    cnn_network_pipeline(frames, scores, conv1_weights, conv2_weights, conv3_weights,
+                         fc1_weights, fc2_weights, fc1_bias, fc2_bias, n, MAX_H, MAX_W);
+
+    int mismatches = 0;
+    for (int f = 0; f < n; f++) {
+        data_t out_ref[FC2_OUT];
+        run_reference(frames[f], out_ref);
+        if (!same_scores(scores[f], out_ref)) mismatches++;
+    }
+
+    std::cout << "  frame pipeline: " << PIPE_STAGES << " stages, "
+              << mismatches << "/" << n << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+// ========================================
+// Loop-tiled conv vs. conv_layer_simple()
+// ========================================
+static bool check_tiled_conv() {
+    static act_t x[CONV3_IN_CH][MAX_H][MAX_W];
+    static act_t y_simple[CONV3_OUT_CH][MAX_H][MAX_W];
+    static act_t y_tiled[CONV3_OUT_CH][MAX_H][MAX_W];
+    static data_t y1_simple[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t y1_tiled[CONV1_OUT_CH][MAX_H][MAX_W];
+    int mismatches = 0;
+
+    // CONV1 on the ship image (126 output rows: last row tile is partial)
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1>(input, y1_simple, conv1_weights, MAX_H, MAX_W);
+    conv_layer_tiled<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1, CONV_TILE_ROWS, CONV_TILE_OC>(
+        input, y1_tiled, conv1_weights, MAX_H, MAX_W);
+    for (int o = 0; o < CONV1_OUT_CH; o++)
+        for (int i = 0; i < MAX_H - CONV1_K + 1; i++)
+            for (int j = 0; j < MAX_W - CONV1_K + 1; j++)
+                if (y1_simple[o][i][j] != y1_tiled[o][i][j]) mismatches++;
+
+    // CONV3 (stride 2) with a channel tile that does not divide OUT_CH
+    const int h = 30, w = 29;
+    for (int c = 0; c < CONV3_IN_CH; c++)
+        for (int i = 0; i < h; i++)
+            for (int j = 0; j < w; j++)
+                x[c][i][j] = (c * 7 + i * 3 + j) % 128;
+    conv_layer_simple<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE,
+                      MAX_H, MAX_W, MAX_H, MAX_W, conv3_precision>(x, y_simple, conv3_weights, h, w);
+    conv_layer_tiled<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE, 3, 5,
+                     MAX_H, MAX_W, MAX_H, MAX_W, conv3_precision>(x, y_tiled, conv3_weights, h, w);
+    for (int o = 0; o < CONV3_OUT_CH; o++)
+        for (int i = 0; i < conv_out_size(h, CONV3_K, CONV3_STRIDE); i++)
+            for (int j = 0; j < conv_out_size(w, CONV3_K, CONV3_STRIDE); j++)
+                if (y_simple[o][i][j] != y_tiled[o][i][j]) mismatches++;
+
+    std::cout << "  tiled conv (" << CONV_TILE_ROWS << " rows x " << CONV_TILE_OC << " channels): "
+              << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+// Streams a map pixel-interleaved through conv_layer_stream() and compares
+// it with conv_layer_simple(); returns mismatches. `iterations` is the MAC
+// loop count the kernel itself reported (conv_stream_stats()), which must
+// be one per output pixel and channel.
+template<int IN_CH, int OUT_CH, int K, int STRIDE, typename P>
+static int check_stream_layer(typename P::in_type x[IN_CH][MAX_H][MAX_W],
+                              typename P::weight_type w[OUT_CH][IN_CH][K][K],
+                              int h, int w_in, long long &iterations) {
+    static typename P::out_type y[OUT_CH][MAX_H][MAX_W];
+    hls::stream<typename P::in_type> in;
+    hls::stream<typename P::out_type> out;
+    int mismatches = 0;
+
+    conv_layer_simple<IN_CH, OUT_CH, K, STRIDE, MAX_H, MAX_W, MAX_H, MAX_W, P>(x, y, w, h, w_in);
+    for (int i = 0; i < h; i++)
+        for (int j = 0; j < w_in; j++)
+            for (int c = 0; c < IN_CH; c++)
+                in.write(x[c][i][j]);
+    conv_stream_stats() = ConvStreamStats();
+    conv_layer_stream<IN_CH, OUT_CH, K, STRIDE, MAX_W, P>(in, out, w, h, w_in);
+    iterations = conv_stream_stats().mac_iterations;
+
+    long long positions = 0;
+    for (int i = 0; i < conv_out_size(h, K, STRIDE); i++)
+        for (int j = 0; j < conv_out_size(w_in, K, STRIDE); j++, positions++)
+            for (int o = 0; o < OUT_CH; o++)
+                if (out.empty() || out.read() != y[o][i][j]) mismatches++;
+    if (!in.empty() || !out.empty()) mismatches++;
+    if (iterations != positions * OUT_CH) mismatches++;
+    if (conv_stream_stats().macs != iterations * IN_CH * K * K) mismatches++;
+    return mismatches;
+}
+
+static bool check_stream_conv() {
+    static act_t x[CONV3_IN_CH][MAX_H][MAX_W];
+    long long conv1_iters, conv3_iters, stride1_iters;
+    int mismatches = 0;
+
+    // CONV1 (stride 1) on the ship image
+    mismatches += check_stream_layer<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1, default_precision>(
+        input, conv1_weights, MAX_H, MAX_W, conv1_iters);
+
+    // CONV3 (stride 2) at its size in cnn_network() and on an odd-sized map
+    const int h = 30, w = 30;
+    for (int c = 0; c < CONV3_IN_CH; c++)
+        for (int i = 0; i < MAX_H; i++)
+            for (int j = 0; j < MAX_W; j++)
+                x[c][i][j] = (c * 7 + i * 3 + j) % 128;
+    mismatches += check_stream_layer<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE, conv3_precision>(
+        x, conv3_weights, 31, 27, conv3_iters);
+    mismatches += check_stream_layer<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, CONV3_STRIDE, conv3_precision>(
+        x, conv3_weights, h, w, conv3_iters);
+
+    // The same layer streamed at stride 1: the kernel must skip the
+    // positions stride 2 does not need (a quarter of the MAC loop)
+    mismatches += check_stream_layer<CONV3_IN_CH, CONV3_OUT_CH, CONV3_K, 1, conv3_precision>(
+        x, conv3_weights, h, w, stride1_iters);
+    if (conv3_iters * CONV3_STRIDE * CONV3_STRIDE != stride1_iters) mismatches++;
+
+    std::cout << "  stream conv: " << mismatches << " mismatches, CONV3 MAC loop "
+              << conv3_iters << " iterations vs " << stride1_iters << " at stride 1 ("
+              << (double)stride1_iters / conv3_iters << "x fewer, counted in the kernel)" << std::endl;
+    return mismatches == 0;
+}
+
+// ========================================
+// DSP packing: packed MAC pairs vs. one multiply per MAC
+// ========================================
+template<typename IN_T>
+static int check_pack_fields(int trials, int lo_in, int hi_in) {
+    typedef dsp_pack<IN_T, weight_t> pack_t;
+    int mismatches = 0;
+
+    for (int t = 0; t < trials; t++) {
+        dsp_acc_t chain = 0;
+        long long exact_hi = 0, exact_lo = 0;
+        for (int n = 0; n < pack_t::chain; n++) {
+            // Every other trial drives a full chain of extreme operands
+            bool extreme = (t % 2 == 0);
+            int a_hi = extreme ? ((t / 2) % 2 ? lo_in : hi_in) : lo_in + rand() % (hi_in - lo_in + 1);
+            int a_lo = extreme ? ((t / 4) % 2 ? lo_in : hi_in) : lo_in + rand() % (hi_in - lo_in + 1);
+            int w = extreme ? ((t / 8) % 2 ? -128 : 127) : rand() % 256 - 128;
+            chain += (weight_t)w * pack_t::pack((IN_T)a_hi, (IN_T)a_lo);
+            exact_hi += (long long)w * a_hi;
+            exact_lo += (long long)w * a_lo;
+        }
+        acc_t hi = 0, lo = 0;
+        pack_t::accumulate(chain, hi, lo);
+        if (hi != exact_hi || lo != exact_lo) mismatches++;
+    }
+    return mismatches;
+}
+
+static bool check_dsp_packing() {
+    static act_t x[CONV2_IN_CH][MAX_H][MAX_W];
+    static weight_t w[CONV2_OUT_CH][CONV2_IN_CH][CONV2_K][CONV2_K];
+    static act_t y_mac[CONV2_OUT_CH][MAX_H][MAX_W];
+    static act_t y_pack[CONV2_OUT_CH][MAX_H][MAX_W];
+    static data_t y1_mac[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t y1_pack[CONV1_OUT_CH][MAX_H][MAX_W];
+
+    int field_errors = check_pack_fields<data_t>(2000, -128, 127) + check_pack_fields<act_t>(2000, 0, 127);
+
+    // Post-ReLU layer: small weights so the outputs stay off the clamps;
+    // odd width so the last pixel of every row is unpaired
+    const int h = 11, wd = 15;
+    for (int c = 0; c < CONV2_IN_CH; c++)
+        for (int i = 0; i < h; i++)
+            for (int j = 0; j < wd; j++)
+                x[c][i][j] = rand() % 128;
+    for (int o = 0; o < CONV2_OUT_CH; o++)
+        for (int c = 0; c < CONV2_IN_CH; c++)
+            for (int i = 0; i < CONV2_K; i++)
+                for (int j = 0; j < CONV2_K; j++)
+                    w[o][c][i][j] = rand() % 5 - 2;
+
+    int mismatches = 0;
+    for (int stride = 1; stride <= 2; stride++) {
+        if (stride == 1) {
+            conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1,
+                              MAX_H, MAX_W, MAX_H, MAX_W, conv2_precision, false>(x, y_mac, w, h, wd);
+            conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 1,
+                              MAX_H, MAX_W, MAX_H, MAX_W, conv2_precision, true>(x, y_pack, w, h, wd);
+        } else {
+            conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 2,
+                              MAX_H, MAX_W, MAX_H, MAX_W, conv2_precision, false>(x, y_mac, w, h, wd);
+            conv_layer_simple<CONV2_IN_CH, CONV2_OUT_CH, CONV2_K, 2,
+                              MAX_H, MAX_W, MAX_H, MAX_W, conv2_precision, true>(x, y_pack, w, h, wd);
+        }
+        for (int o = 0; o < CONV2_OUT_CH; o++)
+            for (int i = 0; i < conv_out_size(h, CONV2_K, stride); i++)
+                for (int j = 0; j < conv_out_size(wd, CONV2_K, stride); j++)
+                    if (y_mac[o][i][j] != y_pack[o][i][j]) mismatches++;
+    }
+
+    // Signed int8 input layer on the ship image
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                      MAX_H, MAX_W, MAX_H, MAX_W, default_precision, false>(input, y1_mac, conv1_weights, MAX_H, MAX_W);
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                      MAX_H, MAX_W, MAX_H, MAX_W, default_precision, true>(input, y1_pack, conv1_weights, MAX_H, MAX_W);
+    for (int o = 0; o < CONV1_OUT_CH; o++)
+        for (int i = 0; i < MAX_H - CONV1_K + 1; i++)
+            for (int j = 0; j < MAX_W - CONV1_K + 1; j++)
+                if (y1_mac[o][i][j] != y1_pack[o][i][j]) mismatches++;
+
+    std::cout << "  DSP packing: act_t shift " << dsp_pack<act_t, weight_t>::shift
+              << " chain " << dsp_pack<act_t, weight_t>::chain
+              << ", int8 shift " << dsp_pack<data_t, weight_t>::shift
+              << " chain " << dsp_pack<data_t, weight_t>::chain << "; "
+              << field_errors << " field errors, " << mismatches << " mismatches" << std::endl;
+    return field_errors == 0 && mismatches == 0;
+}
+
+// ========================================
+// Narrow per-layer precision at the accumulator extremes
+// ========================================
+static bool check_mixed_precision() {
+    static data_t x8[CONV1_IN_CH][MAX_H][MAX_W];
+    static data_t y8[CONV1_OUT_CH][MAX_H][MAX_W];
+    static act_t y7[CONV1_OUT_CH][MAX_H][MAX_W];
+    static weight_t w_conv[CONV1_OUT_CH][CONV1_IN_CH][CONV1_K][CONV1_K];
+    static weight_t w_fc[FC1_OUT][FC1_IN];
+    static data_t f8[FC1_IN];
+    static act_t f7[FC1_IN];
+    static bias_t bias[FC1_OUT];
+    data_t out8[FC1_OUT];
+    act_t out7[FC1_OUT];
+    int mismatches = 0;
+
+    // CONV1: -128 x -128 everywhere is the largest sum, +127 x -128 the smallest
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int h = 0; h < 8; h++)
+            for (int w = 0; w < 8; w++)
+                x8[c][h][w] = (w < 4) ? -128 : 127;
+    for (int o = 0; o < CONV1_OUT_CH; o++)
+        for (int c = 0; c < CONV1_IN_CH; c++)
+            for (int i = 0; i < CONV1_K; i++)
+                for (int j = 0; j < CONV1_K; j++)
+                    w_conv[o][c][i][j] = (o % 2) ? -128 : 127;
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1>(x8, y8, w_conv, 8, 8);
+    conv_layer_simple<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                      MAX_H, MAX_W, MAX_H, MAX_W, conv1_precision>(x8, y7, w_conv, 8, 8);
+    for (int o = 0; o < CONV1_OUT_CH; o++)
+        for (int h = 0; h < 6; h++)
+            for (int w = 0; w < 6; w++)
+                if (y8[o][h][w] != y7[o][h][w]) mismatches++;
+
+    // FC1: full-scale inputs against full-scale weights and biases
+    for (int i = 0; i < FC1_IN; i++) f8[i] = f7[i] = 127;
+    for (int o = 0; o < FC1_OUT; o++) {
+        for (int i = 0; i < FC1_IN; i++) w_fc[o][i] = (o % 2) ? -128 : 127;
+        bias[o] = (o % 4 < 2) ? -128 : 127;
+    }
+    fc_layer<FC1_IN, FC1_OUT>(f8, out8, w_fc, bias, true);
+    fc_layer<FC1_IN, FC1_OUT, fc1_precision>(f7, out7, w_fc, bias, true);
+    for (int o = 0; o < FC1_OUT; o++)
+        if (out8[o] != out7[o]) mismatches++;
+
+    std::cout << "  mixed precision extremes: " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+// ========================================
+// Compile-time accumulator bounds (int16 where provably safe)
+// ========================================
+static bool check_accumulator_bounds() {
+    const int conv1_n = CONV1_IN_CH * CONV1_K * CONV1_K;
+    static data_t x[CONV1_IN_CH][MAX_H][MAX_W];
+    static data_t y32[CONV1_OUT_CH][MAX_H][MAX_W];
+    static data_t y16[CONV1_OUT_CH][MAX_H][MAX_W];
+    static wpack_t w[CONV1_OUT_CH][WPACK_LEN(conv1_n)];
+    int mismatches = 0;
+
+    std::cout << "  accumulator bits: conv1 " << conv1_precision::acc_bits
+              << ", conv2 " << conv2_precision::acc_bits
+              << ", conv3 " << conv3_precision::acc_bits
+              << ", fc1 " << fc1_precision::acc_bits
+              << ", fc2 " << fc2_precision::acc_bits
+              << " (int4 conv1 " << conv1_int4_precision::acc_bits << ")" << std::endl;
+
+    // int4 CONV1 must land on int16: (-128) x (-8) x 27 = 27648
+    bool is_int16 = sizeof(conv1_int4_precision::acc_type) == sizeof(int16_t);
+    if (!is_int16) mismatches++;
+
+    for (int c = 0; c < CONV1_IN_CH; c++)
+        for (int h = 0; h < 8; h++)
+            for (int ww = 0; ww < 8; ww++)
+                x[c][h][ww] = (ww < 4) ? -128 : 127;
+    for (int o = 0; o < CONV1_OUT_CH; o++)
+        for (int b = 0; b < WPACK_LEN(conv1_n); b++)
+            w[o][b] = (o % 2) ? 0x88 : 0x77;   // all -8 / all +7
+    conv_layer_int4<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1>(x, y32, w, 16, 8, 8);
+    conv_layer_int4<CONV1_IN_CH, CONV1_OUT_CH, CONV1_K, 1,
+                    MAX_H, MAX_W, MAX_H, MAX_W, conv1_int4_precision>(x, y16, w, 16, 8, 8);
+    for (int o = 0; o < CONV1_OUT_CH; o++)
+        for (int h = 0; h < 6; h++)
+            for (int ww = 0; ww < 6; ww++)
+                if (y32[o][h][ww] != y16[o][h][ww]) mismatches++;
+
+    std::cout << "  int16 CONV1 (int4 weights): " << (is_int16 ? "selected" : "NOT selected")
+              << ", " << mismatches << " mismatches" << std::endl;
+    return mismatches == 0;
+}
+
+int main() {
+    std::cout << "=== Variant cross-check testbench ===" << std::endl;
+
+    EmbeddedWeightLoader loader(SHIP_DETECTOR_WEIGHTS);
+    loader.load_conv_weights<CONV1_OUT_CH, CONV1_IN_CH, CONV1_K>(conv1_weights);
+    loader.load_conv_weights<CONV2_OUT_CH, CONV2_IN_CH, CONV2_K>(conv2_weights);
+    loader.load_conv_weights<CONV3_OUT_CH, CONV3_IN_CH, CONV3_K>(conv3_weights);
+    loader.load_fc_weights<FC1_OUT, FC1_IN>(fc1_weights);
+    loader.load_fc_weights<FC2_OUT, FC2_IN>(fc2_weights);
+    for (int i = 0; i < FC1_OUT; i++) fc1_bias[i] = 0;
+    for (int i = 0; i < FC2_OUT; i++) fc2_bias[i] = 0;
+
+    EmbeddedWeightLoader gate_loader(SHIP_DETECTOR_GATE_WEIGHTS);
+    gate_loader.load_fc_weights<GATE_OUT, GATE_IN>(gate_weights);
+    gate_loader.load_bias<GATE_OUT>(gate_bias);
+
+    load_embedded_input(SHIP_DETECTOR_INPUT, input, MAX_H, MAX_W);
+    run_reference(input, reference);
+
+    int failures = 0;
+    std::cout << "\nRunning checks:" << std::endl;
+    if (!check_scene_scan()) failures++;
+    if (!check_scene_stream()) failures++;  // compares against the scene scan
+    if (!check_scene_stream_strips()) failures++;
+    if (!check_cascade()) failures++;
+    if (!check_result_cache()) failures++;
+    if (!check_temporal_delta()) failures++;
+    if (!check_sparse_fc()) failures++;
+    if (!check_zero_skip_fc()) failures++;
+    if (!check_ddr_fc()) failures++;
+    if (!check_int4_network()) failures++;
+    if (!check_rom_network()) failures++;
+    if (!check_systolic_network()) failures++;
+    if (!check_pipeline_network()) failures++;
+    if (!check_tiled_conv()) failures++;
+    if (!check_stream_conv()) failures++;
+    if (!check_dsp_packing()) failures++;
+    if (!check_mixed_precision()) failures++;
+    if (!check_accumulator_bounds()) failures++;
+
+    if (failures == 0) {
+        std::cout << "\n✓ All variants match cnn_network()" << std::endl;
+        return 0;
+    }
+    std::cout << "\n✗ " << failures << " variant(s) differ from cnn_network()" << std::endl;
+    return 1;
+}
@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""Analytic cycle model of cnn_network() (no HLS toolchain needed).
+
+Replays the loop nests of cnn_network.cpp layer by layer. For each
+pipelined loop the model takes the trip count, the target II from the
+PIPELINE pragma in the layer template, and the achieved II. The achieved
+II is the target, or the memory-port bound when the unrolled body reads
+more words from one array than its ports deliver per cycle. It predicts
+per-layer cycles and the end-to-end latency at a given clock.
+
+    python3 tools/hls_cycle_model.py [options]
+
+    --repo DIR            sources to read (default .)
+    --clock MHZ           kernel clock (default 100)
+    --size HxW            input size (default MAX_H x MAX_W)
+    -D NAME=VALUE         override a cnn_types.h/cnn_arch.h define, as the
+                          HLS cflags would (e.g. -D CONV_DSP_PACK=true)
+    --save FILE           write "layer cycles" lines (a baseline)
+    --baseline FILE       compare against a saved baseline; exits with
+                          status 1 if any layer is slower by more than
+    --tolerance PCT       (default 2) percent
+    --report DIR          validate against C-synthesis reports
+                          (<solution>/syn/report): achieved II of each
+                          layer template's pipelined loop, and the total
+                          latency of cnn_network if it is reported
+
+Assumptions:
+  - top-level `INTERFACE bram` ports are single-port (TOP_PORTS), internal
+    feature maps are unpartitioned dual-port BRAMs (MAP_PORTS)
+  - a pipelined loop of trip N costs (N - 1) * II + depth cycles, plus
+    LOOP_OVERHEAD per entry; loops with variable bounds are not flattened,
+    so a conv/pool row loop pays the pipeline fill once per row
+  - depth = memory read + multiply + adder tree + write-back
+
+tools/cnn_network_cycles.txt is the baseline for the current tree;
+regenerate it with --save when a change is meant to alter the schedule.
+"""
+
+import math
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from hls_ii_report import loop_rows   # noqa: E402
+
+TOP_PORTS = 1
+MAP_PORTS = 2
+MEM_LATENCY = 2
+MUL_LATENCY = 3
+LOOP_OVERHEAD = 2
+
+
+def define_value(v):
+    return int(v) if v.isdigit() else {"true": 1, "false": 0}.get(v, v)
+
+
+def read_defines(path):
+    defines = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"#define\s+(\w+)\s+(\w+)\b", line)
+            if m:
+                defines[m.group(1)] = define_value(m.group(2))
+    return defines
+
+
+def target_ii(sources, func):
+    """II of the first PIPELINE pragma in the body of template `func`."""
+    for text in sources:
+        m = re.search(r"\bvoid\s+%s\s*\(" % func, text)
+        if not m:
+            continue
+        p = re.search(r"#pragma HLS PIPELINE(?:\s+II=(\d+))?", text[m.end():])
+        if p:
+            return int(p.group(1) or 1)
+    sys.exit("no PIPELINE pragma found for " + func)
+
+
+def pipelined(trip, ii, depth):
+    return (trip - 1) * ii + depth + LOOP_OVERHEAD if trip > 0 else 0
+
+
+def port_ii(target, *reads):
+    """reads: (words per iteration, ports) for each array touched."""
+    ii = target
+    for words, ports in reads:
+        ii = max(ii, -(-words // ports))
+    return ii
+
+
+def tree(n):
+    return int(math.ceil(math.log2(n))) if n > 1 else 0
+
+
+class Layer:
+    def __init__(self, name, func, trip, rows, ii, depth):
+        self.name, self.func = name, func
+        self.trip, self.rows, self.ii, self.depth = trip, rows, ii, depth
+        self.cycles = rows * pipelined(trip, ii, depth)
+
+
+def conv(name, d, t, prefix, h, w, stride, input_is_port):
+    in_ch, out_ch, k = d[prefix + "_IN_CH"], d[prefix + "_OUT_CH"], d[prefix + "_K"]
+    oh, ow = (h - k) // stride + 1, (w - k) // stride + 1
+    pixels = 2 if d.get("CONV_DSP_PACK") else 1       # conv_layer_simple() DSP_PACK pairs
+    macs = in_ch * k * k
+    ii = port_ii(t["conv_layer_simple"],
+                 (macs * pixels, TOP_PORTS if input_is_port else MAP_PORTS),
+                 (macs, TOP_PORTS))
+    depth = MEM_LATENCY + MUL_LATENCY + tree(macs) + (2 if pixels == 2 else 0) + 1
+    return Layer(name, "conv_layer_simple", -(-ow // pixels), out_ch * oh, ii, depth), oh, ow
+
+
+def pool(name, func, d, t, ch, size, h, w):
+    oh, ow = h // size, w // size
+    ii = port_ii(t[func], (size * size, MAP_PORTS))
+    depth = MEM_LATENCY + tree(size * size) + (3 if func == "avg_pool" else 1) + 1
+    return Layer(name, func, ow, ch * oh, ii, depth), oh, ow
+
+
+def network(d, t, H, W):
+    layers = []
+    c1, h1, w1 = conv("conv1", d, t, "CONV1", H, W, 1, True)
+    p1, h2, w2 = pool("pool1", "avg_pool", d, t, d["CONV1_OUT_CH"], d["POOL1_SIZE"], h1, w1)
+    c2, h3, w3 = conv("conv2", d, t, "CONV2", h2, w2, 1, False)
+    p2, h4, w4 = pool("pool2", "avg_pool", d, t, d["CONV2_OUT_CH"], d["POOL2_SIZE"], h3, w3)
+    c3, h5, w5 = conv("conv3", d, t, "CONV3", h4, w4, d["CONV3_STRIDE"], False)
+    p3, _, _ = pool("pool3", "max_pool", d, t, d["CONV3_OUT_CH"], d["POOL3_SIZE"], h5, w5)
+    layers += [c1, p1, c2, p2, c3, p3]
+
+    # flatten<CONV3_OUT_CH, 8, 4>: innermost (width) loop pipelined
+    layers.append(Layer("flatten", "flatten", 4, d["CONV3_OUT_CH"] * 8,
+                        port_ii(t["flatten"], (1, MAP_PORTS)), MEM_LATENCY + 1))
+
+    # fc_layer(): one output per iteration, whole weight row unrolled
+    for name, n_in, n_out in (("fc1", d["FC1_IN"], d["FC1_OUT"]), ("fc2", d["FC2_IN"], d["FC2_OUT"])):
+        ii = port_ii(t["fc_layer"], (n_in, TOP_PORTS), (n_in, MAP_PORTS))
+        depth = MEM_LATENCY + MUL_LATENCY + tree(n_in) + 2
+        layers.append(Layer(name, "fc_layer", n_out, 1, ii, depth))
+        if name == "fc1":
+            layers.append(Layer("dropout", "dropout", n_out, 1,
+                                port_ii(t["dropout"], (1, MAP_PORTS)), MEM_LATENCY + 1))
+    return layers
+
+
+def save(path, layers):
+    with open(path, "w") as f:
+        for L in layers:
+            f.write("%s %d\n" % (L.name, L.cycles))
+        f.write("total %d\n" % sum(L.cycles for L in layers))
+    print("\nBaseline saved to " + path)
+
+
+def compare(path, layers, tolerance):
+    now = dict((L.name, L.cycles) for L in layers)
+    now["total"] = sum(L.cycles for L in layers)
+    regressions = 0
+    print("\n=== BASELINE COMPARISON (%s, tolerance %g%%) ===" % (path, tolerance))
+    print("%-10s %12s %12s %9s %s" % ("Layer", "base", "now", "change", "status"))
+    with open(path) as f:
+        for line in f:
+            parts = line.split()
+            if len(parts) != 2 or parts[0] not in now:
+                continue
+            base = int(parts[1])
+            change = 100.0 * (now[parts[0]] - base) / base if base else 0.0
+            slower = change > tolerance
+            regressions += slower
+            print("%-10s %12d %12d %+8.1f%% %s" % (parts[0], base, now[parts[0]], change,
+                                                   "REGRESSION" if slower else
+                                                   ("faster" if change < -tolerance else "ok")))
+    return regressions
+
+
+def validate(report_dir, layers):
+    """Achieved II per layer template vs the model, plus total latency."""
+    if not os.path.isdir(report_dir):
+        sys.exit("no report directory " + report_dir)
+    print("\n=== C-SYNTHESIS VALIDATION (%s) ===" % report_dir)
+    print("%-44s %-20s %8s %s" % ("Function", "Loop", "achieved", "model II (layers)"))
+    funcs = sorted(set(L.func for L in layers))
+    off = 0
+    for name in sorted(os.listdir(report_dir)):
+        if not name.endswith(".rpt"):
+            continue
+        func = name[:-len(".rpt")]
+        if func.endswith("_csynth"):
+            func = func[:-len("_csynth")]
+        template = next((f for f in funcs if func.startswith(f)), None)
+        if template is None:
+            continue
+        model = dict((L.ii, []) for L in layers if L.func == template)
+        for L in layers:
+            if L.func == template:
+                model[L.ii].append(L.name)
+        for loop, achieved, target, trip in loop_rows(os.path.join(report_dir, name)):
+            if target in ("-", "") or not achieved.isdigit():
+                continue
+            ok = int(achieved) in model
+            off += not ok
+            print("%-44s %-20s %8s %s%s" % (func[:44], loop[:20], achieved,
+                                             ", ".join("%d (%s)" % (ii, "/".join(n)) for ii, n in sorted(model.items())),
+                                             "" if ok else "  OFF"))
+
+    top = os.path.join(report_dir, "cnn_network_csynth.rpt")
+    if os.path.exists(top):
+        with open(top, errors="replace") as f:
+            text = f.read()
+        m = re.search(r"Latency \(cycles\).*?\n(?:.*\n)*?\s*\|\s*(\d+|\?)\s*\|\s*(\d+|\?)\s*\|", text)
+        if m and m.group(2).isdigit():
+            total = sum(L.cycles for L in layers)
+            rpt = int(m.group(2))
+            print("\ncnn_network latency: report %d, model %d (%+.1f%%)"
+                  % (rpt, total, 100.0 * (total - rpt) / rpt))
+        else:
+            print("\ncnn_network latency not in the report (variable H/W bounds)")
+    print("%d pipelined loop(s) with an II the model does not predict" % off)
+    return off
+
+
+def main():
+    args = sys.argv[1:]
+    if "-h" in args or "--help" in args:
+        sys.exit(__doc__)
+
+    def option(name, default=None):
+        if name in args:
+            i = args.index(name)
+            if i + 1 >= len(args):
+                sys.exit("missing value for " + name)
+            return args[i + 1]
+        return default
+
+    repo = option("--repo", ".")
+    clock_mhz = float(option("--clock", "100"))
+    d = read_defines(os.path.join(repo, "cnn_arch.h"))
+    d.update((k, v) for k, v in read_defines(os.path.join(repo, "cnn_types.h")).items() if k not in d)
+    for i, a in enumerate(args):
+        if a == "-D" and i + 1 < len(args):
+            name, _, v = args[i + 1].partition("=")
+            d[name] = define_value(v or "1")
+    size = option("--size", "%dx%d" % (d["MAX_H"], d["MAX_W"]))
+    H, W = (int(v) for v in size.lower().split("x"))
+
+    sources = []
+    for name in ("cnn_conv.h", "cnn_pool.h", "cnn_fc.h"):
+        with open(os.path.join(repo, name)) as f:
+            sources.append(f.read())
+    t = dict((f, target_ii(sources, f))
+             for f in ("conv_layer_simple", "avg_pool", "max_pool", "flatten", "fc_layer", "dropout"))
+
+    layers = network(d, t, H, W)
+    total = sum(L.cycles for L in layers)
+
+    print("cnn_network() cycle model: %dx%d input, %g MHz, DSP packing %s\n"
+          % (H, W, clock_mhz, "on" if d.get("CONV_DSP_PACK") else "off"))
+    print("%-10s %-18s %8s %6s %4s %6s %12s %6s %10s"
+          % ("Layer", "Template", "rows", "trip", "II", "depth", "cycles", "share", "ms"))
+    for L in layers:
+        print("%-10s %-18s %8d %6d %4d %6d %12d %5.1f%% %10.3f"
+              % (L.name, L.func, L.rows, L.trip, L.ii, L.depth, L.cycles,
+                 100.0 * L.cycles / total, L.cycles / (clock_mhz * 1e3)))
+    print("%-10s %-18s %8s %6s %4s %6s %12d %6s %10.3f"
+          % ("total", "", "", "", "", "", total, "", total / (clock_mhz * 1e3)))
+    print("\nLatency %.2f ms, %.2f frames/s at %g MHz" % (total / (clock_mhz * 1e3), clock_mhz * 1e6 / total, clock_mhz))
+
+    status = 0
+    if option("--save"):
+        save(option("--save"), layers)
+    if option("--baseline"):
+        if compare(option("--baseline"), layers, float(option("--tolerance", "2"))):
+            status = 1
+    if option("--report"):
+        if validate(option("--report"), layers):
+            status = 1
+    return status
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,309 @@
+#!/usr/bin/env python3
+"""Design-space exploration of the weight-ROM network (cnn_network_rom()).
+
+Sweeps the conv parallelism knobs CONV1/2/3_MAC_UNROLL (input channels per
+pipelined MAC step, see conv_layer_rom() in cnn_conv.h). Each unroll
+choice fixes that layer's array partitioning (U * K * K banks for the
+weight ROM and the input map) and its pixel II (IN_CH / U). For every
+point, an analytic model gives frames/s, DSPs and BRAM_18K, and the
+Pareto frontier is reported: no other point is at least as fast with at
+most as many DSPs and BRAMs.
+
+    python3 tools/hls_dse.py [options]
+
+    --arch PATH      layer geometry (default cnn_arch.h)
+    --clock MHZ      kernel clock for frames/s (default 100)
+    --part NAME      device to check fit against (default xc7z020)
+    --csv PATH       write every design point, not just the frontier
+    --emit DIR       write dse_<id>.h with the -D overrides of each
+                     frontier point (pass with -include for C-simulation)
+    --csynth         run C-synthesis of each frontier point with vitis_hls
+                     or vivado_hls, if one is on PATH, and compare the
+                     reported latency/DSP/BRAM against the model
+
+Model assumptions (they match the comments in cnn_types.h and cnn_conv.h):
+  - layers run back to back; a layer's cycles are its pipelined trip count
+    times its II, plus the pipeline depth
+  - one DSP per parallel int8 MAC (U * K * K per conv layer); fc_layer()
+    reads a whole weight row per output from a dual-port bram interface,
+    so it runs at II = IN / 2 on two shared MACs
+  - 8-bit (or 7-bit act_t) words pack 2048 per BRAM_18K; banks of at most
+    LUTRAM_WORDS words are mapped to LUTRAM; top-level bram ports (FC
+    weights and biases, input, output) are external and not counted
+"""
+
+import math
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+DEVICES = {
+    # part: (DSP48, BRAM_18K)
+    "xc7z010": (80, 120),
+    "xc7z020": (220, 280),
+    "xc7z030": (400, 530),
+    "xczu3eg": (360, 432),
+}
+BRAM_WORDS = 2048          # 2K x 9 mode for 8-bit words
+LUTRAM_WORDS = 64
+TOP = "cnn_network_rom"
+
+
+def read_defines(path):
+    defines = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"#define\s+(\w+)\s+(\d+)\b", line)
+            if m:
+                defines[m.group(1)] = int(m.group(2))
+    return defines
+
+
+def divisors(n):
+    return [d for d in range(1, n + 1) if n % d == 0]
+
+
+def brams(words, banks=1):
+    per_bank = -(-words // banks)
+    if per_bank <= LUTRAM_WORDS:
+        return 0
+    return banks * -(-per_bank // BRAM_WORDS)
+
+
+def geometry(d):
+    """Per-layer input/output sizes of cnn_network_rom() at MAX_H x MAX_W."""
+    g = {}
+    h, w = d["MAX_H"], d["MAX_W"]
+    strides = {"CONV1": 1, "CONV2": 1, "CONV3": d.get("CONV3_STRIDE", 1)}
+    pools = {"CONV1": "POOL1_SIZE", "CONV2": "POOL2_SIZE", "CONV3": "POOL3_SIZE"}
+    for name in ("CONV1", "CONV2", "CONV3"):
+        k, s = d[name + "_K"], strides[name]
+        oh, ow = (h - k) // s + 1, (w - k) // s + 1
+        p = d[pools[name]]
+        g[name] = {"in_ch": d[name + "_IN_CH"], "out_ch": d[name + "_OUT_CH"], "k": k,
+                   "oh": oh, "ow": ow, "pool": p, "ph": oh // p, "pw": ow // p}
+        h, w = oh // p, ow // p
+    return g
+
+
+def evaluate(d, g, unroll, clock_mhz):
+    """Model one design point; unroll maps CONVn -> MAC unroll."""
+    maps = d["MAX_H"] * d["MAX_W"]
+    cycles = d["CONV1_IN_CH"] * maps          # input copy into conv1_in
+    dsp = 0
+    bram = 0
+    layers = []
+
+    for name in ("CONV1", "CONV2", "CONV3"):
+        L, u = g[name], unroll[name]
+        macs = u * L["k"] * L["k"]
+        ii = L["in_ch"] // u
+        depth = 4 + int(math.ceil(math.log2(macs)))
+        conv = L["out_ch"] * L["oh"] * L["ow"] * ii + depth
+        # AvgPool/MaxPool read P * P words of an unpartitioned map per pixel
+        pool = L["out_ch"] * L["ph"] * L["pw"] * -(-L["pool"] * L["pool"] // 2)
+        cycles += conv + pool
+        dsp += macs
+
+        banks = u * L["k"] * L["k"]
+        bram += brams(L["out_ch"] * L["in_ch"] * L["k"] * L["k"], banks)   # weight ROM
+        bram += brams(L["in_ch"] * maps, banks)                            # input map
+        bram += brams(L["out_ch"] * maps)                                  # conv output
+        layers.append((name, u, ii, banks))
+
+    bram += brams(d["CONV3_OUT_CH"] * maps)   # pool3_out
+    bram += brams(d["FC1_IN"]) + brams(d["FC1_OUT"])
+    for n_in, n_out in ((d["FC1_IN"], d["FC1_OUT"]), (d["FC2_IN"], d["FC2_OUT"])):
+        cycles += n_out * -(-n_in // 2) + 8
+        dsp += 2
+
+    return {
+        "unroll": unroll,
+        "layers": layers,
+        "cycles": cycles,
+        "fps": clock_mhz * 1e6 / cycles,
+        "dsp": dsp,
+        "bram": bram,
+    }
+
+
+def pareto(points):
+    front = []
+    for p in points:
+        dominated = False
+        for q in points:
+            if q is p:
+                continue
+            if (q["fps"] >= p["fps"] and q["dsp"] <= p["dsp"] and q["bram"] <= p["bram"]
+                    and (q["fps"] > p["fps"] or q["dsp"] < p["dsp"] or q["bram"] < p["bram"])):
+                dominated = True
+                break
+        if not dominated:
+            front.append(p)
+    return sorted(front, key=lambda p: (p["dsp"], -p["fps"]))
+
+
+def point_id(p):
+    return "u" + "_".join(str(p["unroll"][n]) for n in ("CONV1", "CONV2", "CONV3"))
+
+
+def cflags(p):
+    return " ".join("-D%s_MAC_UNROLL=%d" % (n, p["unroll"][n]) for n in ("CONV1", "CONV2", "CONV3"))
+
+
+def emit_header(p, out_dir, clock_mhz):
+    path = os.path.join(out_dir, "dse_%s.h" % point_id(p))
+    with open(path, "w") as f:
+        f.write("// Generated by tools/hls_dse.py: %s design point\n" % TOP)
+        f.write("// Model: %.1f frames/s at %g MHz, %d DSP, %d BRAM_18K\n"
+                % (p["fps"], clock_mhz, p["dsp"], p["bram"]))
+        for name, u, ii, banks in p["layers"]:
+            f.write("#define %s_MAC_UNROLL %d   // II %d, %d banks\n" % (name, u, ii, banks))
+    return path
+
+
+# ---------------- Optional C-synthesis hook ----------------
+
+def find_hls():
+    for tool in ("vitis_hls", "vivado_hls"):
+        if shutil.which(tool):
+            return tool
+    return None
+
+
+def report_row(text, header_key, row_key):
+    """Cells of `row_key` in the first table whose header holds `header_key`."""
+    header = None
+    for line in text.splitlines():
+        cells = [c.strip() for c in line.strip().strip("|").split("|")]
+        if header is None:
+            if header_key in cells:
+                header = cells
+            continue
+        if cells and cells[0] == row_key and len(cells) == len(header):
+            return dict(zip(header, cells))
+    return {}
+
+
+def csynth(p, tool, repo, part, clock_mhz, work_dir):
+    proj = "dse_" + point_id(p)
+    tcl = os.path.join(work_dir, proj + ".tcl")
+    with open(tcl, "w") as f:
+        f.write("open_project -reset %s\n" % proj)
+        f.write("set_top %s\n" % TOP)
+        f.write("add_files %s -cflags \"-I%s %s\"\n"
+                % (os.path.join(repo, TOP + ".cpp"), repo, cflags(p)))
+        f.write("open_solution -reset solution1\n")
+        f.write("set_part {%s}\n" % part)
+        f.write("create_clock -period %g\n" % (1000.0 / clock_mhz))
+        f.write("csynth_design\nexit\n")
+
+    log = os.path.join(work_dir, proj + ".log")
+    with open(log, "w") as out:
+        rc = subprocess.call([tool, "-f", tcl], cwd=work_dir, stdout=out, stderr=subprocess.STDOUT)
+    rpt = os.path.join(work_dir, proj, "solution1", "syn", "report", TOP + "_csynth.rpt")
+    if rc != 0 or not os.path.exists(rpt):
+        return None
+
+    with open(rpt, errors="replace") as f:
+        text = f.read()
+    util = report_row(text, "BRAM_18K", "Total")
+    m = re.search(r"Latency \(cycles\).*?\n(?:.*\n)*?\s*\|\s*(\d+)\s*\|\s*(\d+)\s*\|", text)
+    return {
+        "cycles": int(m.group(2)) if m else None,
+        "dsp": util.get("DSP48E", util.get("DSP", "?")),
+        "bram": util.get("BRAM_18K", "?"),
+    }
+
+
+def main():
+    args = sys.argv[1:]
+
+    def option(name, default=None):
+        if name in args:
+            i = args.index(name)
+            if i + 1 >= len(args):
+                sys.exit("missing value for " + name)
+            return args[i + 1]
+        return default
+
+    arch = option("--arch", "cnn_arch.h")
+    clock_mhz = float(option("--clock", "100"))
+    part = option("--part", "xc7z020")
+    csv_path = option("--csv")
+    emit_dir = option("--emit")
+    if "-h" in args or "--help" in args:
+        sys.exit(__doc__)
+
+    d = read_defines(arch)
+    g = geometry(d)
+
+    points = []
+    for u1 in divisors(d["CONV1_IN_CH"]):
+        for u2 in divisors(d["CONV2_IN_CH"]):
+            for u3 in divisors(d["CONV3_IN_CH"]):
+                points.append(evaluate(d, g, {"CONV1": u1, "CONV2": u2, "CONV3": u3}, clock_mhz))
+    front = pareto(points)
+
+    dev_key = next((k for k in DEVICES if part.startswith(k)), None)
+    dsp_max, bram_max = DEVICES.get(dev_key, (None, None))
+
+    print("%d design points, %d on the Pareto frontier (frames/s vs DSP/BRAM_18K)" % (len(points), len(front)))
+    print("Model clock %g MHz%s\n" % (clock_mhz, ", device %s: %d DSP, %d BRAM_18K" % (dev_key, dsp_max, bram_max)
+                                        if dev_key else ""))
+    print("%-10s %6s %6s %6s %5s %5s %5s %6s %6s %10s %9s %s"
+          % ("point", "U1", "U2", "U3", "II1", "II2", "II3", "DSP", "BRAM", "cycles", "frames/s", "fits"))
+    for p in front:
+        ii = [layer[2] for layer in p["layers"]]
+        fits = "-" if not dev_key else (
+            "yes" if p["dsp"] <= dsp_max and p["bram"] <= bram_max else
+            "no (%s)" % ", ".join(r for r, over in (("DSP", p["dsp"] > dsp_max), ("BRAM", p["bram"] > bram_max)) if over))
+        print("%-10s %6d %6d %6d %5d %5d %5d %6d %6d %10d %9.1f %s"
+              % (point_id(p), p["unroll"]["CONV1"], p["unroll"]["CONV2"], p["unroll"]["CONV3"],
+                 ii[0], ii[1], ii[2], p["dsp"], p["bram"], p["cycles"], p["fps"], fits))
+
+    if dev_key and not any(p["dsp"] <= dsp_max and p["bram"] <= bram_max for p in front):
+        fixed = min(p["bram"] for p in points)
+        print("\nNo point fits %s: at least %d BRAM_18K go to feature maps sized"
+              " MAX_H x MAX_W for every layer" % (dev_key, fixed))
+
+    if csv_path:
+        with open(csv_path, "w") as f:
+            f.write("point,conv1_unroll,conv2_unroll,conv3_unroll,dsp,bram18k,cycles,fps,pareto\n")
+            for p in points:
+                f.write("%s,%d,%d,%d,%d,%d,%d,%.2f,%d\n"
+                        % (point_id(p), p["unroll"]["CONV1"], p["unroll"]["CONV2"], p["unroll"]["CONV3"],
+                           p["dsp"], p["bram"], p["cycles"], p["fps"], p in front))
+        print("\nAll points written to " + csv_path)
+
+    if emit_dir:
+        os.makedirs(emit_dir, exist_ok=True)
+        for p in front:
+            emit_header(p, emit_dir, clock_mhz)
+        print("\n%d variant headers written to %s" % (len(front), emit_dir))
+
+    if "--csynth" in args:
+        tool = find_hls()
+        if not tool:
+            print("\n--csynth: no vitis_hls/vivado_hls on PATH, model results only")
+            return 0
+        repo = os.path.dirname(os.path.abspath(arch))
+        work_dir = emit_dir or "dse_work"
+        os.makedirs(work_dir, exist_ok=True)
+        print("\nC-synthesis (%s, %s):" % (tool, part))
+        print("%-10s %10s %10s %6s %6s %6s %6s" % ("point", "cycles", "model", "DSP", "model", "BRAM", "model"))
+        for p in front:
+            r = csynth(p, tool, repo, part, clock_mhz, work_dir)
+            if r is None:
+                print("%-10s failed, see %s/dse_%s.log" % (point_id(p), work_dir, point_id(p)))
+                continue
+            print("%-10s %10s %10d %6s %6d %6s %6d"
+                  % (point_id(p), r["cycles"] if r["cycles"] is not None else "?", p["cycles"],
+                     r["dsp"], p["dsp"], r["bram"], p["bram"]))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,81 @@
+#!/usr/bin/env python3
+"""Report achieved vs target II of every pipelined loop after C-synthesis.
+
+Reads the Vivado HLS / Vitis HLS text reports (<solution>/syn/report/*.rpt)
+and prints one line per pipelined loop, flagging loops whose achieved II
+misses the target. Exits with status 1 if any loop misses.
+
+    python3 tools/hls_ii_report.py <solution>/syn/report [function_filter]
+
+Example, for the weight-ROM network (top cnn_network_rom):
+
+    python3 tools/hls_ii_report.py proj/solution1/syn/report conv_layer_rom
+"""
+
+import glob
+import os
+import sys
+
+
+def loop_rows(path):
+    """Yields (loop, achieved, target, trip) from the loop latency table."""
+    with open(path, errors="replace") as f:
+        lines = f.readlines()
+
+    in_loops = False
+    header = None
+    for line in lines:
+        stripped = line.strip()
+        if "Loop Name" in stripped:
+            header = [c.strip().lower() for c in stripped.strip("|").split("|")]
+            in_loops = True
+            continue
+        if not in_loops:
+            continue
+        if not stripped.startswith("|"):
+            if stripped and not stripped.startswith("+"):
+                in_loops = False
+            continue
+        cells = [c.strip() for c in stripped.strip("|").split("|")]
+        if len(cells) != len(header) or cells[0][:1] not in ("-", "+", "o"):
+            continue
+        row = dict(zip(header, cells))
+        name = cells[0].lstrip("-+o ").strip()
+        yield name, row.get("achieved", "-"), row.get("target", "-"), row.get("count", "-")
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    report_dir = sys.argv[1]
+    func_filter = sys.argv[2] if len(sys.argv) > 2 else ""
+
+    reports = sorted(glob.glob(os.path.join(report_dir, "*.rpt")))
+    if not reports:
+        sys.exit("no .rpt files in " + report_dir)
+
+    missed = 0
+    print("%-44s %-28s %8s %8s %8s" % ("Function", "Loop", "target", "achieved", "trip"))
+    for path in reports:
+        func = os.path.basename(path)[:-len(".rpt")]
+        if func.endswith("_csynth"):
+            func = func[:-len("_csynth")]
+        if func_filter not in func:
+            continue
+        for loop, achieved, target, trip in loop_rows(path):
+            if target in ("-", ""):
+                continue   # not pipelined
+            miss = achieved.isdigit() and target.isdigit() and int(achieved) > int(target)
+            missed += miss
+            print("%-44s %-28s %8s %8s %8s%s" % (func[:44], loop[:28], target, achieved, trip,
+                                                 "  MISSED" if miss else ""))
+
+    if missed:
+        print("\n%d pipelined loop(s) miss their target II" % missed)
+        return 1
+    print("\nAll pipelined loops meet their target II")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,334 @@
+#!/usr/bin/env python3
+"""Train the early-exit cascade gate and write ship_gate_weights.h.
+
+The gate of cnn_network_cascade() scores a tile from the global average
+of its 16 POOL1 channels: score = sat8(bias + sum_i w[i] * gap[i]), and
+tiles scoring below the threshold (GATE_THRESHOLD_DEFAULT) are rejected
+before CONV2. This tool computes those features exactly like the HLS
+code (CONV1 from SHIP_DETECTOR_WEIGHTS, ReLU clamp to 0..127, 2x2 average
+pool, global average, all integer), fits a logistic regression of ship
+vs. open water, and quantizes it to the int8 weights + bias the loader
+expects. The bias is placed as close to midway between the lowest ship
+score and the highest sea score as int8 allows; training fails unless
+every ship tile is accepted and every sea tile rejected.
+
+The quantized gate is then scored on held-out tiles that are not used
+for training: other sea statistics, other ship crops and sizes. The
+header is only written if every held-out ship tile is accepted. The
+held-out ship recall and sea rejection are printed and recorded in the
+header.
+
+    python3 tools/train_gate.py [options]
+
+    --weights FILE    ship_weights.h (default ship_weights.h)
+    --arch FILE       cnn_arch.h (default cnn_arch.h)
+    --out FILE        header to write (default ship_gate_weights.h)
+    --ship DIR        extra ship tiles, raw 128x128x3 HWC uint8 files
+    --sea DIR         extra open-water tiles, same format
+    --threshold N     gate threshold the bias is placed for (default 0)
+    --holdout-ship DIR  extra held-out ship tiles, same format
+    --holdout-sea DIR   extra held-out open-water tiles, same format
+    --seed N          seed for the synthetic training tiles (default 1)
+    --holdout-seed N  seed for the synthetic held-out tiles (default 2)
+
+Without --ship/--sea the training set is the embedded SHIP_DETECTOR_INPUT
+tile (flipped and brightness-shifted, and at half size on open water)
+against synthetic open water: a flat blue-green base per channel with
+uniform noise. The base and noise amplitude vary and cover the sea tiles
+Benchmark/Benchmark_int8.cpp uses. The held-out set uses other offsets,
+brightness and contrast for the ship, and its sea adds swell and sun
+glint with bases outside the training ranges. Retrain and re-validate
+with real labelled tiles when available.
+"""
+
+import math
+import os
+import random
+import re
+import sys
+
+PER_LINE = 16
+
+
+def read_defines(path):
+    defines = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"#define\s+(\w+)\s+(\d+)\b", line)
+            if m:
+                defines[m.group(1)] = int(m.group(2))
+    return defines
+
+
+def read_array(text, name, signed):
+    m = re.search(name + r"\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        sys.exit(name + " not found")
+    values = [int(v) for v in re.findall(r"-?\d+", m.group(1))]
+    if signed:
+        values = [v - 256 if v > 127 else v for v in values]
+    return values
+
+
+def tile_from_hwc(data, h, w):
+    """uint8 HWC bytes -> data_t CHW rows (value - 128, as load_embedded_input)."""
+    return [[[data[(y * w + x) * 3 + c] - 128 for x in range(w)] for y in range(h)] for c in range(3)]
+
+
+def gate_features(tile, conv1, d):
+    """GAP of POOL1, bit-exact with cnn_network_head() + global_avg_pool()."""
+    k, in_ch, out_ch, p = d["CONV1_K"], d["CONV1_IN_CH"], d["CONV1_OUT_CH"], d["POOL1_SIZE"]
+    h, w = len(tile[0]), len(tile[0][0])
+    h1, w1 = h - k + 1, w - k + 1
+    h2, w2 = h1 // p, w1 // p
+    features = []
+    for oc in range(out_ch):
+        rows = []
+        for y in range(h1):
+            acc = [0] * w1
+            for ic in range(in_ch):
+                for kh in range(k):
+                    src = tile[ic][y + kh]
+                    for kw in range(k):
+                        wt = conv1[oc][ic][kh][kw]
+                        if wt:
+                            acc = [a + wt * v for a, v in zip(acc, src[kw:kw + w1])]
+            rows.append([127 if a > 127 else (a if a > 0 else 0) for a in acc])
+        total = 0
+        for y in range(h2):
+            for x in range(w2):
+                s = 0
+                for i in range(p):
+                    for j in range(p):
+                        s += rows[y * p + i][x * p + j]
+                total += s // (p * p)
+        features.append(total // (h2 * w2))
+    return features
+
+
+def sea_tile(rng, h, w):
+    base = [rng.randint(5, 100), rng.randint(25, 115), rng.randint(40, 125)]
+    amp = rng.randint(4, 28)
+    return [[[base[c] + rng.randint(-amp, amp) - 128 for x in range(w)] for y in range(h)] for c in range(3)]
+
+
+def paste_half(sea, ship, oy, ox):
+    """The ship tile at half size over open water, top-left at (oy, ox)."""
+    h, w = len(ship[0]), len(ship[0][0])
+    for c in range(3):
+        for y in range(h // 2):
+            for x in range(w // 2):
+                sea[c][oy + y][ox + x] = ship[c][2 * y][2 * x]
+    return sea
+
+
+def ship_variants(tile):
+    out = []
+    for flip_v in (False, True):
+        for flip_h in (False, True):
+            t = [[row[::-1] if flip_h else row[:] for row in (ch[::-1] if flip_v else ch)] for ch in tile]
+            for shift in (0, -24, 24):
+                out.append([[[max(-128, min(127, v + shift)) for v in row] for row in ch] for ch in t])
+    return out
+
+
+def heldout_sea_tile(rng, h, w):
+    """Open water the training set never shows: grey/green bases outside the
+    training ranges, stronger noise, a swell pattern along the rows and
+    sparse sun glint."""
+    base = [rng.randint(45, 90), rng.randint(70, 110), rng.randint(40, 120)]
+    amp = rng.randint(12, 28)
+    swell = rng.randint(6, 20)
+    period = rng.randint(6, 24)
+    tile = []
+    for c in range(3):
+        ch = []
+        for y in range(h):
+            wave = int(swell * math.sin(2 * math.pi * y / period))
+            row = []
+            for x in range(w):
+                v = base[c] + wave + rng.randint(-amp, amp)
+                if rng.random() < 0.01:
+                    v = 255
+                row.append(max(0, min(255, v)) - 128)
+            ch.append(row)
+        tile.append(ch)
+    return tile
+
+
+def mirror(i, n):
+    i %= 2 * n
+    return i if i < n else 2 * n - 1 - i
+
+
+def heldout_ships(tile, rng, h, w):
+    """Ship tiles the training set never shows: shifted crops with mirrored
+    borders, brightness shifts and reduced contrast outside the training
+    augmentation, and the ship at half size on held-out open water."""
+    out = []
+    for n in range(1, 5):
+        dy, dx = 13 * 2 * n, 29 * 2 * n
+        out.append([[[ch[mirror(y + dy, h)][mirror(x + dx, w)] for x in range(w)] for y in range(h)]
+                    for ch in tile])
+    for shift in (-48, -12, 12, 48):
+        out.append([[[max(-128, min(127, v + shift)) for v in row] for row in ch] for ch in tile])
+    for gain in (0.5, 0.75):
+        out.append([[[int(v * gain) for v in row] for row in ch] for ch in tile])
+    for _ in range(6):
+        out.append(paste_half(heldout_sea_tile(rng, h, w), tile, rng.randint(0, h // 2), rng.randint(0, w // 2)))
+    return out
+
+
+def load_dir(path, h, w):
+    tiles = []
+    for name in sorted(os.listdir(path)):
+        with open(os.path.join(path, name), "rb") as f:
+            data = f.read()
+        if len(data) != h * w * 3:
+            sys.exit("%s: expected %d bytes, got %d" % (name, h * w * 3, len(data)))
+        tiles.append(tile_from_hwc(bytearray(data), h, w))
+    return tiles
+
+
+def fit_logistic(xs, ys, steps=4000, lr=0.5):
+    """Gradient descent on features scaled to 0..1, without an intercept:
+    the gate bias is a single int8, so the boundary has to pass close to
+    the origin. Returns weights on the raw features."""
+    n = len(xs[0])
+    z = [[v / 127.0 for v in x] for x in xs]
+    w = [0.0] * n
+    for _ in range(steps):
+        g = [0.0] * n
+        for x, y in zip(z, ys):
+            s = sum(wi * xi for wi, xi in zip(w, x))
+            e = 1.0 / (1.0 + math.exp(-max(-30.0, min(30.0, s)))) - y
+            for i in range(n):
+                g[i] += e * x[i]
+        w = [wi - lr * (gi / len(z) + 1e-3 * wi) for wi, gi in zip(w, g)]
+    return [v / 127.0 for v in w]
+
+
+def quantize(raw_w, xs, ys, threshold):
+    """int8 weights (largest scale first) and an int8 bias that accepts every
+    ship tile and rejects every sea tile, as close to midway as int8 allows.
+    Returns (weights, bias, ship margin, sea margin) at the threshold."""
+    peak = max(abs(v) for v in raw_w)
+    for top in range(127, 0, -1):
+        qw = [int(round(v / peak * top)) for v in raw_w]
+        dots = [sum(a * b for a, b in zip(qw, x)) for x in xs]
+        ship = min(s for s, y in zip(dots, ys) if y)
+        sea = max(s for s, y in zip(dots, ys) if not y)
+        # ship + bias >= threshold > sea + bias
+        lo, hi = max(-128, threshold - ship), min(127, threshold - 1 - sea)
+        if lo > hi:
+            continue
+        bias = min(hi, max(lo, threshold - (ship + sea + 1) // 2))
+        return qw, bias, ship + bias - threshold, threshold - 1 - (sea + bias)
+    sys.exit("no int8 gate separates the training tiles")
+
+
+def gate_accepts(qw, bias, features, threshold):
+    """cnn_network_cascade(): sat8(bias + w . gap) >= threshold."""
+    score = bias + sum(a * b for a, b in zip(qw, features))
+    return max(-128, min(127, score)) >= threshold
+
+
+def write_header(path, qw, bias, n_ship, n_sea, margins, heldout):
+    with open(path, "w") as f:
+        f.write("#ifndef SHIP_DETECTOR_GATE_WEIGHTS_H\n#define SHIP_DETECTOR_GATE_WEIGHTS_H\n\n")
+        f.write("#include <stdint.h>\n\n")
+        f.write("/*\n")
+        f.write(" * Early-exit cascade gate for the ship detector\n")
+        f.write(" * Layout (int8, sequential): GATE_OUT x GATE_IN weights, then GATE_OUT biases\n")
+        f.write(" * Load with EmbeddedWeightLoader: load_fc_weights<GATE_OUT, GATE_IN>()\n")
+        f.write(" * followed by load_bias<GATE_OUT>().\n")
+        f.write(" *\n")
+        f.write(" * Generated by tools/train_gate.py from the CONV1 weights in ship_weights.h:\n")
+        f.write(" * %d ship and %d open-water training tiles, all classified correctly\n" % (n_ship, n_sea))
+        f.write(" * (margins at the threshold: ship +%d, sea +%d before int8 saturation).\n"
+                % margins)
+        f.write(" * Held-out tiles (not used for training): %d of %d ship tiles accepted,\n"
+                " * %d of %d open-water tiles rejected.\n" % heldout)
+        f.write(" */\n\n")
+        values = qw + [bias]
+        f.write("#define GATE_TOTAL_WEIGHTS %d\n\n" % len(values))
+        f.write("const int8_t SHIP_DETECTOR_GATE_WEIGHTS[] = {\n")
+        for i in range(0, len(values), PER_LINE):
+            chunk = ", ".join("%4d" % v for v in values[i:i + PER_LINE])
+            f.write("    %s%s\n" % (chunk, "," if i + PER_LINE < len(values) else ""))
+        f.write("};\n\n#endif // SHIP_DETECTOR_GATE_WEIGHTS_H\n")
+
+
+def main():
+    args = sys.argv[1:]
+    if "-h" in args or "--help" in args:
+        sys.exit(__doc__)
+
+    def option(name, default=None):
+        if name in args:
+            i = args.index(name)
+            if i + 1 >= len(args):
+                sys.exit("missing value for " + name)
+            return args[i + 1]
+        return default
+
+    d = read_defines(option("--arch", "cnn_arch.h"))
+    with open(option("--weights", "ship_weights.h")) as f:
+        text = f.read()
+    h, w = d["MAX_H"], d["MAX_W"]
+    k, in_ch, out_ch = d["CONV1_K"], d["CONV1_IN_CH"], d["CONV1_OUT_CH"]
+
+    flat = read_array(text, "SHIP_DETECTOR_WEIGHTS", True)
+    conv1 = [[[[flat[((oc * in_ch + ic) * k + kh) * k + kw] for kw in range(k)]
+               for kh in range(k)] for ic in range(in_ch)] for oc in range(out_ch)]
+    ship = tile_from_hwc(read_array(text, "SHIP_DETECTOR_INPUT", False), h, w)
+
+    rng = random.Random(int(option("--seed", "1")))
+    ships = ship_variants(ship)
+    ships += [paste_half(sea_tile(rng, h, w), t, rng.randint(0, h // 2), rng.randint(0, w // 2))
+              for t in ships[::3] for _ in range(3)]
+    seas = [sea_tile(rng, h, w) for _ in range(32)]
+    if option("--ship"):
+        ships += load_dir(option("--ship"), h, w)
+    if option("--sea"):
+        seas += load_dir(option("--sea"), h, w)
+
+    holdout_rng = random.Random(int(option("--holdout-seed", "2")))
+    holdout_ships = heldout_ships(ship, holdout_rng, h, w)
+    holdout_seas = [heldout_sea_tile(holdout_rng, h, w) for _ in range(24)]
+    if option("--holdout-ship"):
+        holdout_ships += load_dir(option("--holdout-ship"), h, w)
+    if option("--holdout-sea"):
+        holdout_seas += load_dir(option("--holdout-sea"), h, w)
+
+    xs, ys = [], []
+    for label, tiles in ((1, ships), (0, seas)):
+        for t in tiles:
+            xs.append(gate_features(t, conv1, d))
+            ys.append(label)
+        print("%-4s tiles: %d" % ("ship" if label else "sea", len(tiles)))
+
+    raw_w = fit_logistic(xs, ys)
+    threshold = int(option("--threshold", "0"))
+    qw, bias, ship_margin, sea_margin = quantize(raw_w, xs, ys, threshold)
+
+    print("weights: %s" % " ".join(str(v) for v in qw))
+    print("bias:    %d (threshold %d)" % (bias, threshold))
+    print("margins: ship +%d, sea +%d" % (ship_margin, sea_margin))
+
+    recall = sum(gate_accepts(qw, bias, gate_features(t, conv1, d), threshold) for t in holdout_ships)
+    rejected = sum(not gate_accepts(qw, bias, gate_features(t, conv1, d), threshold) for t in holdout_seas)
+    print("held-out: %d of %d ship tiles accepted (recall %.0f%%), %d of %d sea tiles rejected"
+          % (recall, len(holdout_ships), 100.0 * recall / len(holdout_ships), rejected, len(holdout_seas)))
+
+    out = option("--out", "ship_gate_weights.h")
+    if recall < len(holdout_ships):
+        sys.exit("gate misses %d held-out ship tiles, not writing %s"
+                 % (len(holdout_ships) - recall, out))
+    write_header(out, qw, bias, len(ships), len(seas), (ship_margin, sea_margin),
+                 (recall, len(holdout_ships), rejected, len(holdout_seas)))
+    print("wrote " + out)
+
+
+if __name__ == "__main__":
+    main()
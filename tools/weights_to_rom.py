@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+"""Generate ship_conv_rom.h: the conv weights as initialized const arrays.
+
+HLS maps const arrays with initializers to on-chip ROMs, which can then be
+partitioned to feed the unrolled conv MACs (see conv_layer_rom() in
+cnn_conv.h). The values are taken from SHIP_DETECTOR_WEIGHTS in
+ship_weights.h and the layer geometry from cnn_arch.h, so rerun this
+whenever either changes:
+
+    python3 tools/weights_to_rom.py [ship_weights.h] [cnn_arch.h] [ship_conv_rom.h]
+"""
+
+import re
+import sys
+
+LAYERS = ("CONV1", "CONV2", "CONV3")
+PER_LINE = 16
+
+
+def read_defines(path):
+    defines = {}
+    with open(path) as f:
+        for line in f:
+            m = re.match(r"#define\s+(\w+)\s+(\d+)\b", line)
+            if m:
+                defines[m.group(1)] = int(m.group(2))
+    return defines
+
+
+def read_weights(path, count):
+    with open(path) as f:
+        text = f.read()
+    m = re.search(r"SHIP_DETECTOR_WEIGHTS\[\]\s*=\s*\{(.*?)\};", text, re.S)
+    if not m:
+        sys.exit("SHIP_DETECTOR_WEIGHTS not found in " + path)
+    values = [int(v) for v in re.findall(r"-?\d+", m.group(1))[:count]]
+    if len(values) < count:
+        sys.exit("%s holds %d weights, need %d" % (path, len(values), count))
+    # Same narrowing as the int8_t array (and EmbeddedWeightLoader)
+    return [v - 256 if v > 127 else v for v in values]
+
+
+def emit_layer(out, name, values, out_ch, in_ch, k):
+    per_oc = in_ch * k * k
+    out.write("// %s: [%d][%d][%d][%d] (OUT_CH, IN_CH, K, K)\n" % (name, out_ch, in_ch, k, k))
+    out.write("static const weight_t %s_ROM[%s_OUT_CH][%s_IN_CH][%s_K][%s_K] = {\n"
+              % (name, name, name, name, name))
+    for oc in range(out_ch):
+        row = values[oc * per_oc:(oc + 1) * per_oc]
+        out.write("    { // oc %d\n" % oc)
+        for i in range(0, per_oc, PER_LINE):
+            chunk = ", ".join("%4d" % v for v in row[i:i + PER_LINE])
+            last = i + PER_LINE >= per_oc
+            out.write("        %s%s\n" % (chunk, "" if last else ","))
+        out.write("    }%s\n" % ("" if oc == out_ch - 1 else ","))
+    out.write("};\n\n")
+
+
+def main():
+    weights_path = sys.argv[1] if len(sys.argv) > 1 else "ship_weights.h"
+    arch_path = sys.argv[2] if len(sys.argv) > 2 else "cnn_arch.h"
+    out_path = sys.argv[3] if len(sys.argv) > 3 else "ship_conv_rom.h"
+
+    d = read_defines(arch_path)
+    shapes = [(d[l + "_OUT_CH"], d[l + "_IN_CH"], d[l + "_K"]) for l in LAYERS]
+    total = sum(o * i * k * k for o, i, k in shapes)
+    values = read_weights(weights_path, total)
+
+    with open(out_path, "w") as out:
+        out.write("#ifndef SHIP_CONV_ROM_H\n#define SHIP_CONV_ROM_H\n\n")
+        out.write('#include "cnn_types.h"\n\n')
+        out.write("/*\n * Auto-generated by tools/weights_to_rom.py from %s\n" % weights_path)
+        out.write(" * Conv weights as initialized const arrays (on-chip ROMs in HLS)\n */\n\n")
+        offset = 0
+        for name, (o, i, k) in zip(LAYERS, shapes):
+            n = o * i * k * k
+            emit_layer(out, name, values[offset:offset + n], o, i, k)
+            offset += n
+        out.write("#endif // SHIP_CONV_ROM_H\n")
+
+    print("wrote %s (%d conv weights)" % (out_path, total))
+
+
+if __name__ == "__main__":
+    main()